@@ -55,6 +55,18 @@ static void jso_io_pointers_set(jso_io *io, jso_ctype *pos)
 	JSO_IO_STR_SET_START(io);
 }
 
+JSO_API jso_io *jso_io_alloc(void)
+{
+	const jso_allocator *allocator = jso_mm_get_allocator();
+	jso_io *io = jso_allocator_calloc(allocator, 1, sizeof(jso_io));
+
+	if (io != NULL) {
+		JSO_IO_ALLOCATOR(io) = allocator;
+	}
+
+	return io;
+}
+
 JSO_API void jso_io_buffer_init(jso_io *io, jso_ctype *buf, size_t size)
 {
 	JSO_IO_SIZE(io) = size;
@@ -88,7 +100,7 @@ static jso_rc jso_io_buffer_alloc_new(jso_io *io, size_t size)
 	jso_ctype *buf;
 
 	/* use calloc to suppress valgrind warnings */
-	buf = (jso_ctype *) jso_calloc(size + 1, sizeof(jso_ctype));
+	buf = (jso_ctype *) jso_allocator_calloc(JSO_IO_ALLOCATOR(io), size + 1, sizeof(jso_ctype));
 
 	if (!buf) {
 		return JSO_FAILURE;
@@ -105,8 +117,8 @@ static jso_rc jso_io_buffer_alloc_extend(jso_io *io, size_t size)
 
 	jso_io_buffer_diffs_save(io, &diffs);
 	JSO_IO_SIZE(io) = JSO_MAX(JSO_IO_SIZE(io) * 2, size + 1);
-	JSO_IO_BUFFER(io)
-			= (jso_ctype *) jso_realloc(JSO_IO_BUFFER(io), JSO_IO_SIZE(io) * sizeof(jso_ctype));
+	JSO_IO_BUFFER(io) = (jso_ctype *) jso_allocator_realloc(
+			JSO_IO_ALLOCATOR(io), JSO_IO_BUFFER(io), JSO_IO_SIZE(io) * sizeof(jso_ctype));
 	if (!JSO_IO_BUFFER(io)) {
 		return JSO_FAILURE;
 	}
@@ -147,7 +159,7 @@ JSO_API jso_rc jso_io_buffer_alloc_ex(jso_io *io, size_t size, int flags)
 	}
 
 	not_used = JSO_IO_SIZE(io) - (size_t) (JSO_IO_LIMIT(io) - JSO_IO_BUFFER(io));
-	if (not_used <= size) {
+	if (not_used >= size) {
 		/* There is enough space in the buffer
 		 * so we don't need to do anything. */
 		return JSO_SUCCESS;
@@ -166,7 +178,8 @@ JSO_API jso_rc jso_io_buffer_alloc_ex(jso_io *io, size_t size, int flags)
 		case JSO_IO_BUFFER_ALLOC_STRATEGY_ROTATE:
 			return jso_io_buffer_alloc_rotate(io, size);
 		case JSO_IO_BUFFER_ALLOC_STRATEGY_EXTEND:
-			return jso_io_buffer_alloc_extend(io, size);
+			return jso_io_buffer_alloc_extend(
+					io, (size_t) (JSO_IO_LIMIT(io) - JSO_IO_BUFFER(io)) + size);
 		default:
 			return JSO_FAILURE;
 	}
@@ -177,6 +190,12 @@ JSO_API jso_rc jso_io_buffer_alloc(jso_io *io, size_t size)
 	return jso_io_buffer_alloc_ex(io, size, JSO_IO_BUFFER_ALLOC_STRATEGY_AUTO);
 }
 
+JSO_API void jso_io_buffer_free(jso_io *io)
+{
+	jso_allocator_free(JSO_IO_ALLOCATOR(io), JSO_IO_BUFFER(io));
+	JSO_IO_BUFFER(io) = NULL;
+}
+
 JSO_API jso_rc jso_io_pipe(jso_io *src_io, jso_io *dst_io)
 {
 	size_t read = (size_t) (JSO_IO_LIMIT(src_io) - JSO_IO_CURSOR(src_io));
@@ -42,13 +42,14 @@ static size_t jso_io_file_read(jso_io *io, size_t size)
 		return size;
 	}
 
-	/* make sure that we have enough space in the buffer */
-	if (jso_io_buffer_alloc(io, size) == JSO_FAILURE) {
+	/* make sure that we have enough space for the missing characters in the buffer */
+	if (jso_io_buffer_alloc(io, size - buffered) == JSO_FAILURE) {
 		return 0;
 	}
 
-	/* read data from file */
-	count = fread(JSO_IO_LIMIT(io), sizeof(jso_ctype), JSO_IO_SIZE(io) - buffered,
+	/* read data from file to the free space of the buffer */
+	count = fread(JSO_IO_LIMIT(io), sizeof(jso_ctype),
+			JSO_IO_SIZE(io) - (size_t) (JSO_IO_LIMIT(io) - JSO_IO_BUFFER(io)),
 			JSO_IO_FILE_HANDLE_GET(io));
 	if (count > 0) {
 		JSO_IO_LIMIT(io) += count;
@@ -92,8 +93,8 @@ static jso_rc jso_io_file_free(jso_io *io)
 	jso_rc rc = jso_io_file_close(io);
 
 	if (JSO_IO_BUFFER(io))
-		jso_free(JSO_IO_BUFFER(io));
-	jso_free(io);
+		jso_io_buffer_free(io);
+	JSO_IO_DEALLOC(io);
 
 	return rc;
 }
@@ -78,8 +78,8 @@ static int jso_io_memory_error(jso_io *io)
 
 static jso_rc jso_io_memory_free(jso_io *io)
 {
-	jso_free(JSO_IO_BUFFER(io));
-	jso_free(io);
+	jso_io_buffer_free(io);
+	JSO_IO_DEALLOC(io);
 
 	return JSO_SUCCESS;
 }
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/* MAP_ANONYMOUS and madvise are not part of the strict C standard mode */
+#define _DEFAULT_SOURCE
+
+#include "jso_io_mmap.h"
+
+#include "../jso.h"
+
+#if defined(HAVE_SYS_MMAN_H) && defined(HAVE_MMAP)
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* get the mapping size that always contains at least one byte after the file data */
+static size_t jso_io_mmap_size(size_t size)
+{
+	size_t page_size = (size_t) sysconf(_SC_PAGESIZE);
+	return (size / page_size + 1) * page_size;
+}
+
+static size_t jso_io_mmap_read(jso_io *io, size_t size)
+{
+	size_t buffered = (size_t) (JSO_IO_LIMIT(io) - JSO_IO_CURSOR(io));
+
+	/* the whole file is already in the buffer */
+	return buffered < size ? buffered : size;
+}
+
+static size_t jso_io_mmap_write(jso_io *io, const jso_ctype *buffer, size_t size)
+{
+	return 0;
+}
+
+static int jso_io_mmap_printf(jso_io *io, const char *format, ...)
+{
+	return 0;
+}
+
+static jso_rc jso_io_mmap_flush(jso_io *io)
+{
+	return JSO_SUCCESS;
+}
+
+static int jso_io_mmap_error(jso_io *io)
+{
+	return JSO_IO_ERROR_CODE(io);
+}
+
+static jso_rc jso_io_mmap_free(jso_io *io)
+{
+	int rc = munmap(JSO_IO_BUFFER(io), jso_io_mmap_size(JSO_IO_SIZE(io)));
+	JSO_IO_DEALLOC(io);
+
+	return rc == 0 ? JSO_SUCCESS : JSO_FAILURE;
+}
+
+/* map the file followed by the zero filled anonymous memory */
+static jso_ctype *jso_io_mmap_map(int fd, size_t size)
+{
+	size_t map_size = jso_io_mmap_size(size);
+
+	/* the zero page after the data is reserved first and the file is mapped over it */
+	void *addr = mmap(NULL, map_size, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (addr == MAP_FAILED) {
+		return NULL;
+	}
+	if (size > 0) {
+		if (mmap(addr, size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED) {
+			munmap(addr, map_size);
+			return NULL;
+		}
+#ifdef HAVE_MADVISE
+		madvise(addr, size, MADV_SEQUENTIAL);
+#endif
+	}
+
+	return (jso_ctype *) addr;
+}
+
+JSO_API jso_io *jso_io_mmap_open(const char *filename)
+{
+	struct stat sbuf;
+	jso_ctype *buf = NULL;
+	jso_io *io;
+
+	int fd = open(filename, O_RDONLY);
+	if (fd < 0) {
+		return NULL;
+	}
+	if (fstat(fd, &sbuf) == 0 && S_ISREG(sbuf.st_mode)) {
+		buf = jso_io_mmap_map(fd, (size_t) sbuf.st_size);
+	}
+	/* the mapping is kept after closing the descriptor */
+	close(fd);
+	if (buf == NULL) {
+		return NULL;
+	}
+
+	/* alloc io and set ops */
+	io = JSO_IO_ALLOC();
+	if (io == NULL) {
+		munmap(buf, jso_io_mmap_size((size_t) sbuf.st_size));
+		return NULL;
+	}
+	JSO_IO_OP(io, read) = jso_io_mmap_read;
+	JSO_IO_OP(io, write) = jso_io_mmap_write;
+	JSO_IO_OP(io, printf) = jso_io_mmap_printf;
+	JSO_IO_OP(io, flush) = jso_io_mmap_flush;
+	JSO_IO_OP(io, error) = jso_io_mmap_error;
+	JSO_IO_OP(io, free) = jso_io_mmap_free;
+
+	jso_io_buffer_init(io, buf, (size_t) sbuf.st_size);
+	JSO_IO_LIMIT(io) = buf + sbuf.st_size;
+	JSO_IO_WHOLE(io) = JSO_TRUE;
+
+	return io;
+}
+
+#else
+
+JSO_API jso_io *jso_io_mmap_open(const char *filename)
+{
+	return NULL;
+}
+
+#endif
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/**
+ * @file jso_io_mmap.h
+ * @brief Memory mapped file IO
+ */
+
+#ifndef JSO_IO_MMAP_H
+#define JSO_IO_MMAP_H
+
+#include "../jso_io.h"
+
+/**
+ * Open memory mapped IO for the regular file.
+ *
+ * The whole file is mapped read only and the buffer points directly to the mapping so no data
+ * is copied. The mapping is always followed by at least one zero byte that terminates
+ * the scanning.
+ *
+ * @param filename file path
+ * @return New mapped IO or NULL if the file is not a regular file or mapping is not supported.
+ */
+JSO_API jso_io *jso_io_mmap_open(const char *filename);
+
+#endif /* JSO_IO_MMAP_H */
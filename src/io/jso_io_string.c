@@ -54,7 +54,7 @@ static int jso_io_string_error(jso_io *io)
 
 static jso_rc jso_io_string_free(jso_io *io)
 {
-	jso_free(io);
+	JSO_IO_DEALLOC(io);
 
 	return JSO_SUCCESS;
 }
@@ -72,8 +72,10 @@ static jso_io *jso_io_string_open(jso_ctype *buf, size_t size)
 	JSO_IO_OP(io, error) = jso_io_string_error;
 	JSO_IO_OP(io, free) = jso_io_string_free;
 
-	/* pre-allocate buffer */
+	/* pre-allocate buffer - the whole string is already available */
 	jso_io_buffer_init(io, buf, size);
+	JSO_IO_LIMIT(io) = buf + size;
+	JSO_IO_WHOLE(io) = JSO_TRUE;
 
 	return io;
 }
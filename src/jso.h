@@ -32,11 +32,14 @@
 #include "../config.h"
 
 #include "jso_types.h"
+#include "jso_mm.h"
+#include "jso_arena.h"
 #include "jso_assert.h"
 #include "jso_dbg.h"
 #include "jso_value.h"
 #include "jso_error.h"
 #include "jso_array.h"
+#include "jso_list.h"
 #include "jso_object.h"
 #include "jso_re.h"
 #include "jso_virt.h"
@@ -146,34 +149,4 @@ static inline jso_virt_string *jso_string_to_virt_string(jso_string *str)
 	JSO_USE(uv1); \
 	JSO_USE(uv2)
 
-/* memeroy functions - just redefinitions for future extending (checking) */
-
-#ifndef jso_malloc
-/**
- * @brief Memory allocation
- */
-#define jso_malloc malloc
-#endif
-
-#ifndef jso_realloc
-/**
- * @brief Memory reallocation
- */
-#define jso_realloc realloc
-#endif
-
-#ifndef jso_calloc
-/**
- * @brief Memory allocation with zeroing all bytes
- */
-#define jso_calloc calloc
-#endif
-
-#ifndef jso_free
-/**
- * @brief Memory freeing
- */
-#define jso_free free
-#endif
-
 #endif /* JSO_H */
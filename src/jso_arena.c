@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2012-2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include "jso.h"
+#include "jso_arena.h"
+
+#include <string.h>
+
+/* align size to the arena alignment */
+#define JSO_ARENA_ALIGN(_size) \
+	(((_size) + (JSO_ARENA_ALIGNMENT - 1)) & ~((size_t) JSO_ARENA_ALIGNMENT - 1))
+
+/* size of the block header */
+#define JSO_ARENA_BLOCK_HEADER_SIZE JSO_ARENA_ALIGN(sizeof(jso_arena_block))
+
+/* get start of the block data */
+#define JSO_ARENA_BLOCK_DATA(_block) ((jso_ctype *) (_block) + JSO_ARENA_BLOCK_HEADER_SIZE)
+
+/* arena allocator allocation callback */
+static void *jso_arena_allocator_alloc(size_t size, void *ctx)
+{
+	return jso_arena_malloc((jso_arena *) ctx, size);
+}
+
+/* arena allocator reallocation callback */
+static void *jso_arena_allocator_realloc(void *ptr, size_t size, void *ctx)
+{
+	return jso_arena_realloc((jso_arena *) ctx, ptr, size);
+}
+
+/* arena allocator freeing callback - memory is released with the whole arena */
+static void jso_arena_allocator_free(void *ptr, void *ctx)
+{
+}
+
+/* alloc and init arena */
+JSO_API jso_arena *jso_arena_alloc(size_t block_size)
+{
+	jso_arena *arena = jso_malloc(sizeof(jso_arena));
+	if (arena == NULL) {
+		return NULL;
+	}
+	jso_arena_init(arena, block_size);
+
+	return arena;
+}
+
+/* init arena */
+JSO_API void jso_arena_init(jso_arena *arena, size_t block_size)
+{
+	memset(arena, 0, sizeof(jso_arena));
+	arena->block_size = block_size > 0 ? JSO_ARENA_ALIGN(block_size) : JSO_ARENA_BLOCK_SIZE;
+	arena->parent = jso_mm_get_allocator();
+	arena->allocator.alloc = jso_arena_allocator_alloc;
+	arena->allocator.realloc = jso_arena_allocator_realloc;
+	arena->allocator.free = jso_arena_allocator_free;
+	arena->allocator.ctx = arena;
+}
+
+/* free blocks from the supplied one till the end block (exclusive) */
+static void jso_arena_free_blocks(jso_arena *arena, jso_arena_block *block, jso_arena_block *end)
+{
+	const jso_allocator *parent = arena->parent;
+	while (block != end) {
+		jso_arena_block *prev = block->prev;
+		parent->free(block, parent->ctx);
+		block = prev;
+	}
+}
+
+/* release all memory but the first block */
+JSO_API void jso_arena_clear(jso_arena *arena)
+{
+	jso_arena_block *first = arena->block;
+	if (first == NULL) {
+		return;
+	}
+	while (first->prev != NULL) {
+		first = first->prev;
+	}
+	jso_arena_free_blocks(arena, arena->block, first);
+	arena->block = first;
+	arena->pos = JSO_ARENA_BLOCK_DATA(first);
+	arena->last = NULL;
+}
+
+/* free arena and its memory */
+JSO_API void jso_arena_free(jso_arena *arena)
+{
+	const jso_allocator *parent = arena->parent;
+	jso_arena_free_blocks(arena, arena->block, NULL);
+	parent->free(arena, parent->ctx);
+}
+
+/* allocate new block with at least size bytes of data */
+static jso_ctype *jso_arena_add_block(jso_arena *arena, size_t size)
+{
+	/* allocations bigger than half of the block get their own block */
+	jso_bool dedicated = size > arena->block_size / 2;
+	size_t data_size = dedicated ? size : arena->block_size;
+	if (data_size > SIZE_MAX - JSO_ARENA_BLOCK_HEADER_SIZE) {
+		return NULL;
+	}
+
+	const jso_allocator *parent = arena->parent;
+	jso_arena_block *block
+			= parent->alloc(JSO_ARENA_BLOCK_HEADER_SIZE + data_size, parent->ctx);
+	if (block == NULL) {
+		return NULL;
+	}
+	jso_ctype *data = JSO_ARENA_BLOCK_DATA(block);
+	block->end = data + data_size;
+
+	if (dedicated && arena->block != NULL) {
+		/* keep bumping in the current block */
+		block->prev = arena->block->prev;
+		arena->block->prev = block;
+	} else {
+		block->prev = arena->block;
+		arena->block = block;
+		arena->pos = data + size;
+		arena->last = data;
+	}
+
+	return data;
+}
+
+/* allocate memory from arena */
+JSO_API void *jso_arena_malloc(jso_arena *arena, size_t size)
+{
+	size = JSO_ARENA_ALIGN(size);
+	if (arena->block != NULL && size <= (size_t) (arena->block->end - arena->pos)) {
+		jso_ctype *ptr = arena->pos;
+		arena->pos += size;
+		arena->last = ptr;
+		return ptr;
+	}
+
+	return jso_arena_add_block(arena, size);
+}
+
+/* find the end of the block containing the supplied pointer */
+static jso_ctype *jso_arena_find_block_end(jso_arena *arena, jso_ctype *ptr)
+{
+	for (jso_arena_block *block = arena->block; block; block = block->prev) {
+		if (ptr >= JSO_ARENA_BLOCK_DATA(block) && ptr < block->end) {
+			return block->end;
+		}
+	}
+	return ptr;
+}
+
+/* reallocate memory from arena */
+JSO_API void *jso_arena_realloc(jso_arena *arena, void *ptr, size_t size)
+{
+	if (ptr == NULL) {
+		return jso_arena_malloc(arena, size);
+	}
+
+	jso_ctype *old = (jso_ctype *) ptr;
+	size_t aligned_size = JSO_ARENA_ALIGN(size);
+	if (old == arena->last && aligned_size <= (size_t) (arena->block->end - old)) {
+		/* extend or shrink the last allocation in place */
+		arena->pos = old + aligned_size;
+		return old;
+	}
+
+	jso_ctype *new = jso_arena_malloc(arena, size);
+	if (new == NULL) {
+		return NULL;
+	}
+	/* the old size is not known but it cannot exceed its block end (regions can overlap) */
+	size_t available = (size_t) (jso_arena_find_block_end(arena, old) - old);
+	memmove(new, old, JSO_MIN(size, available));
+
+	return new;
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2012-2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+/**
+ * @file jso_arena.h
+ * @brief Arena (region) memory allocator
+ */
+
+#ifndef JSO_ARENA_H
+#define JSO_ARENA_H
+
+#include "jso_types.h"
+#include "jso_mm.h"
+
+/**
+ * @brief Default size of the arena block.
+ */
+#define JSO_ARENA_BLOCK_SIZE (64 * 1024)
+
+/**
+ * @brief Alignment of all arena allocations.
+ */
+#define JSO_ARENA_ALIGNMENT 8
+
+/**
+ * @brief Arena memory block.
+ */
+typedef struct _jso_arena_block {
+	/** previously allocated block */
+	struct _jso_arena_block *prev;
+	/** end of the block memory */
+	jso_ctype *end;
+} jso_arena_block;
+
+/**
+ * @brief Arena (region) allocator.
+ *
+ * The memory is allocated by bumping pointer in the current block and it can be released only
+ * all at once by @ref jso_arena_clear or @ref jso_arena_free. The blocks are allocated
+ * by the allocator that was current when the arena was initialized.
+ */
+struct _jso_arena {
+	/** current block */
+	jso_arena_block *block;
+	/** position of the next allocation in the current block */
+	jso_ctype *pos;
+	/** last allocation that can be extended in place */
+	jso_ctype *last;
+	/** size of newly allocated blocks */
+	size_t block_size;
+	/** allocator that allocates blocks */
+	const jso_allocator *parent;
+	/** allocator that allocates from this arena */
+	jso_allocator allocator;
+};
+
+/**
+ * Allocate and initialize new arena.
+ *
+ * @param block_size block size or 0 for @ref JSO_ARENA_BLOCK_SIZE
+ * @return New arena or NULL on failure.
+ */
+JSO_API jso_arena *jso_arena_alloc(size_t block_size);
+
+/**
+ * Initialize arena.
+ *
+ * @param arena arena
+ * @param block_size block size or 0 for @ref JSO_ARENA_BLOCK_SIZE
+ */
+JSO_API void jso_arena_init(jso_arena *arena, size_t block_size);
+
+/**
+ * Release all arena memory so the arena can be reused.
+ *
+ * The first allocated block is kept so the next use does not need to allocate it again.
+ *
+ * @param arena arena
+ */
+JSO_API void jso_arena_clear(jso_arena *arena);
+
+/**
+ * Free arena and all its memory.
+ *
+ * @param arena arena allocated by @ref jso_arena_alloc
+ */
+JSO_API void jso_arena_free(jso_arena *arena);
+
+/**
+ * Allocate memory from arena.
+ *
+ * @param arena arena
+ * @param size number of bytes to allocate
+ * @return Pointer to the allocated memory or NULL on failure.
+ */
+JSO_API void *jso_arena_malloc(jso_arena *arena, size_t size);
+
+/**
+ * Reallocate memory from arena.
+ *
+ * The last allocation is extended in place if possible. Otherwise new memory is allocated
+ * and the old content is copied.
+ *
+ * @param arena arena
+ * @param ptr previously allocated memory from the same arena or NULL
+ * @param size new number of bytes
+ * @return Pointer to the reallocated memory or NULL on failure.
+ */
+JSO_API void *jso_arena_realloc(jso_arena *arena, void *ptr, size_t size);
+
+/**
+ * Get allocator that allocates from the arena.
+ *
+ * The freeing is a no-op as the memory is released only with the whole arena.
+ *
+ * @param arena arena
+ * @return Allocator that can be passed to @ref jso_mm_set_allocator.
+ */
+static inline const jso_allocator *jso_arena_get_allocator(jso_arena *arena)
+{
+	return &arena->allocator;
+}
+
+/**
+ * Start allocating from the arena in the current thread.
+ *
+ * @param arena arena or NULL to keep the current allocator
+ * @return The previous allocator that has to be passed to @ref jso_arena_leave.
+ */
+static inline const jso_allocator *jso_arena_enter(jso_arena *arena)
+{
+	return jso_mm_enter(arena != NULL ? &arena->allocator : NULL);
+}
+
+/**
+ * Stop allocating from the arena in the current thread.
+ *
+ * @param previous allocator returned by @ref jso_arena_enter
+ */
+static inline void jso_arena_leave(const jso_allocator *previous)
+{
+	jso_mm_leave(previous);
+}
+
+#endif /* JSO_ARENA_H */
@@ -24,6 +24,7 @@
 #include "jso.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 /* alloc and init new array */
 JSO_API jso_array *jso_array_alloc()
@@ -40,68 +41,85 @@ JSO_API void jso_array_init(jso_array *arr)
 /* clear all array items without clearing values */
 JSO_API void jso_array_clear(jso_array *arr)
 {
-	if (!arr)
+	if (!arr || (JSO_ARRAY_FLAGS(arr) & JSO_ARRAY_FLAG_ARENA))
 		return;
 	if (JSO_ARRAY_REFCOUNT(arr) > 0) {
 		--JSO_ARRAY_REFCOUNT(arr);
 		return;
 	}
-	jso_array_element *tmp, *el = arr->head;
-	while (el) {
-		tmp = el->next;
-		jso_free(el);
-		el = tmp;
-	}
+	jso_free(arr->elements);
+	arr->elements = NULL;
+	arr->len = 0;
+	arr->capacity = 0;
 }
 
 /* free array and its elements */
 JSO_API void jso_array_free(jso_array *arr)
 {
-	if (!arr)
+	if (!arr || (JSO_ARRAY_FLAGS(arr) & JSO_ARRAY_FLAG_ARENA))
 		return;
 	if (JSO_ARRAY_REFCOUNT(arr) > 0) {
 		--JSO_ARRAY_REFCOUNT(arr);
 		return;
 	}
-	jso_array_element *tmp, *el = arr->head;
-	while (el) {
-		jso_value_free(&el->val);
-		tmp = el->next;
-		jso_free(el);
-		el = tmp;
+	for (size_t i = 0; i < arr->len; i++) {
+		jso_value_free(&arr->elements[i]);
 	}
+	jso_free(arr->elements);
 	jso_free(arr);
 }
 
+/* reallocate elements to the exact capacity */
+static jso_rc jso_array_set_capacity(jso_array *arr, size_t capacity)
+{
+	if (capacity > SIZE_MAX / sizeof(jso_value)) {
+		return JSO_FAILURE;
+	}
+	jso_value *elements = jso_realloc(arr->elements, capacity * sizeof(jso_value));
+	if (!elements)
+		return JSO_FAILURE;
+	arr->elements = elements;
+	arr->capacity = capacity;
+	return JSO_SUCCESS;
+}
+
+/* reserve space for at least size elements */
+JSO_API jso_rc jso_array_reserve(jso_array *arr, size_t size)
+{
+	if (size <= arr->capacity) {
+		return JSO_SUCCESS;
+	}
+	return jso_array_set_capacity(arr, size);
+}
+
+/* make sure that there is space for one more element */
+static inline jso_rc jso_array_grow(jso_array *arr)
+{
+	if (arr->len < arr->capacity) {
+		return JSO_SUCCESS;
+	}
+	if (arr->capacity > SIZE_MAX / 2) {
+		return JSO_FAILURE;
+	}
+	return jso_array_set_capacity(arr, JSO_MAX(arr->capacity * 2, JSO_ARRAY_MIN_CAPACITY));
+}
+
 /* append element to the array */
 JSO_API jso_rc jso_array_append(jso_array *arr, jso_value *val)
 {
-	jso_array_element *el = jso_malloc(sizeof(jso_array_element));
-	if (!el)
+	if (jso_array_grow(arr) == JSO_FAILURE)
 		return JSO_FAILURE;
-	el->val = *val;
-	el->next = NULL;
-	if (!arr->head) {
-		arr->head = arr->tail = el;
-	} else {
-		arr->tail->next = el;
-		arr->tail = el;
-	}
-	++arr->len;
+	arr->elements[arr->len++] = *val;
 	return JSO_SUCCESS;
 }
 
 /* push element to the array */
 JSO_API jso_rc jso_array_push(jso_array *arr, jso_value *val)
 {
-	jso_array_element *el = jso_malloc(sizeof(jso_array_element));
-	if (!el)
+	if (jso_array_grow(arr) == JSO_FAILURE)
 		return JSO_FAILURE;
-	el->val = *val;
-	el->next = arr->head;
-	arr->head = el;
-	if (!arr->tail)
-		arr->tail = el;
+	memmove(&arr->elements[1], &arr->elements[0], arr->len * sizeof(jso_value));
+	arr->elements[0] = *val;
 	++arr->len;
 	return JSO_SUCCESS;
 }
@@ -109,53 +127,36 @@ JSO_API jso_rc jso_array_push(jso_array *arr, jso_value *val)
 /* pop the head element from the array */
 JSO_API jso_rc jso_array_pop(jso_array *arr)
 {
-	jso_array_element *el = arr->head;
-	if (!el)
+	if (arr->len == 0)
 		return JSO_FAILURE;
 	--arr->len;
-	if (el == arr->tail)
-		arr->head = arr->tail = NULL;
-	else
-		arr->head = arr->head->next;
-	jso_free(el);
+	memmove(&arr->elements[0], &arr->elements[1], arr->len * sizeof(jso_value));
 	return JSO_SUCCESS;
 }
 
 /* get array element at the supplied index */
 JSO_API jso_rc jso_array_index(jso_array *arr, size_t index, jso_value **value)
 {
-	if (arr->len == 0 || index >= arr->len) {
+	if (index >= arr->len) {
 		return JSO_FAILURE;
 	}
-	jso_array_element *el = arr->head;
-	JSO_ASSERT_NOT_NULL(el);
-	for (size_t i = 0; i < index; i++) {
-		el = el->next;
-		JSO_ASSERT_NOT_NULL(el);
-	}
-	*value = &el->val;
+	*value = &arr->elements[index];
 	return JSO_SUCCESS;
 }
 
 /* call cbk function for each element in array */
 JSO_API void jso_array_apply(jso_array *arr, jso_array_callback cbk)
 {
-	size_t pos = 0;
-	jso_array_element *el = arr->head;
-	while (el) {
-		cbk(pos++, &el->val);
-		el = el->next;
+	for (size_t pos = 0; pos < arr->len; pos++) {
+		cbk(pos, &arr->elements[pos]);
 	}
 }
 
 /* call cbk function with arg for each element in array */
 JSO_API void jso_array_apply_with_arg(jso_array *arr, jso_array_with_arg_callback cbk, void *arg)
 {
-	size_t pos = 0;
-	jso_array_element *el = arr->head;
-	while (el) {
-		cbk(pos++, &el->val, arg);
-		el = el->next;
+	for (size_t pos = 0; pos < arr->len; pos++) {
+		cbk(pos, &arr->elements[pos], arg);
 	}
 }
 
@@ -166,46 +167,89 @@ JSO_API jso_bool jso_array_equals(jso_array *arr1, jso_array *arr2)
 		return JSO_FALSE;
 	}
 
-	jso_array_element *el1 = arr1->head, *el2 = arr2->head;
-	while (el1 && el2) {
-		if (!jso_value_equals(&el1->val, &el2->val)) {
+	for (size_t i = 0; i < arr1->len; i++) {
+		if (!jso_value_equals(&arr1->elements[i], &arr2->elements[i])) {
 			return JSO_FALSE;
 		}
-		el1 = el1->next;
-		el2 = el2->next;
 	}
 
-	return el1 == el2;
+	return JSO_TRUE;
 }
 
 /* check item types */
 JSO_API jso_bool jso_array_are_all_items_of_type(jso_array *arr, jso_value_type type)
 {
-	jso_array_element *el = arr->head;
-	while (el) {
-		if (JSO_TYPE(el->val) != type) {
+	for (size_t i = 0; i < arr->len; i++) {
+		if (JSO_TYPE(arr->elements[i]) != type) {
 			return JSO_FALSE;
 		}
-		el = el->next;
 	}
 
 	return JSO_TRUE;
 }
 
+/* check uniqueness by comparing all pairs */
+static jso_bool jso_array_is_unique_by_pairs(jso_array *arr)
+{
+	for (size_t i = 0; i < arr->len; i++) {
+		for (size_t j = i + 1; j < arr->len; j++) {
+			if (jso_value_equals(&arr->elements[i], &arr->elements[j])) {
+				return JSO_FALSE;
+			}
+		}
+	}
+
+	return JSO_TRUE;
+}
+
+/**
+ * @brief Slot of the temporary hash set used for uniqueness check.
+ */
+typedef struct _jso_array_unique_slot {
+	/** element hash */
+	jso_uint32 hash;
+	/** element pointer or NULL if the slot is empty */
+	jso_value *value;
+} jso_array_unique_slot;
+
 /* check uniqueness */
 JSO_API jso_bool jso_array_is_unique(jso_array *arr)
 {
-	jso_array_element *el = arr->head, *el2;
-	while (el) {
-		el2 = el->next;
-		while (el2) {
-			if (jso_value_equals(&el->val, &el2->val)) {
+	size_t len = arr->len;
+	if (len <= JSO_ARRAY_UNIQUE_PAIRS_MAX_LEN) {
+		return jso_array_is_unique_by_pairs(arr);
+	}
+
+	/* keep the load factor at most 0.5 with power of two capacity for masking */
+	size_t capacity = JSO_ARRAY_MIN_CAPACITY;
+	while (capacity < len * 2) {
+		if (capacity > SIZE_MAX / 2 / sizeof(jso_array_unique_slot)) {
+			return jso_array_is_unique_by_pairs(arr);
+		}
+		capacity *= 2;
+	}
+	jso_array_unique_slot *slots = jso_calloc(capacity, sizeof(jso_array_unique_slot));
+	if (slots == NULL) {
+		return jso_array_is_unique_by_pairs(arr);
+	}
+
+	size_t mask = capacity - 1;
+	for (size_t i = 0; i < len; i++) {
+		jso_value *val = &arr->elements[i];
+		jso_uint32 hash = jso_value_hash(val);
+		size_t index = hash & mask;
+		while (slots[index].value != NULL) {
+			if (slots[index].hash == hash && jso_value_equals(slots[index].value, val)) {
+				jso_free(slots);
 				return JSO_FALSE;
 			}
-			el2 = el2->next;
+			index = (index + 1) & mask;
 		}
-		el = el->next;
+		slots[index].hash = hash;
+		slots[index].value = val;
 	}
 
+	jso_free(slots);
+
 	return JSO_TRUE;
 }
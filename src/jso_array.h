@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012-2024 Jakub Zelenka. All rights reserved.
+ * Copyright (c) 2012-2025 Jakub Zelenka. All rights reserved.
  *
  * Permission is hereby granted, free of charge, to any person obtaining a
  * copy of this software and associated documentation files (the "Software"),
@@ -32,25 +32,37 @@
 #include "jso_types.h"
 
 /**
- * @brief Array element.
+ * @brief Array flag defining whether the array is owned by an arena.
  */
-typedef struct _jso_array_element {
-	jso_value val;
-	struct _jso_array_element *next;
-} jso_array_element;
+#define JSO_ARRAY_FLAG_ARENA 1
+
+/**
+ * @brief Array flag defining whether the array collects values of the duplicate object keys.
+ */
+#define JSO_ARRAY_FLAG_DUPLICATES 2
+
+/**
+ * @brief Minimal number of elements allocated for a non empty array.
+ */
+#define JSO_ARRAY_MIN_CAPACITY 8
+
+/**
+ * @brief Maximal array length for which uniqueness is checked by comparing all pairs.
+ */
+#define JSO_ARRAY_UNIQUE_PAIRS_MAX_LEN 8
 
 /**
  * @brief Array main structure.
  *
- * Currently array is implemented as a linked list.
+ * The array is implemented as a contiguous vector of values that grows geometrically.
  */
 struct _jso_array {
-	/* array first element */
-	jso_array_element *head;
-	/* array last element */
-	jso_array_element *tail;
+	/* array elements */
+	jso_value *elements;
 	/* array length */
 	size_t len;
+	/* array allocated capacity */
+	size_t capacity;
 	/* array reference count */
 	jso_uint16 refcount;
 	/* array flags */
@@ -65,6 +77,22 @@ struct _jso_array {
  */
 #define JSO_ARRAY_LEN(_arr) (_arr)->len
 
+/**
+ * Get capacity of the supplied array.
+ *
+ * @param _arr pointer to @ref jso_array
+ * @return Number of elements that fit into the array without reallocation.
+ */
+#define JSO_ARRAY_CAPACITY(_arr) (_arr)->capacity
+
+/**
+ * Get elements of the supplied array.
+ *
+ * @param _arr pointer to @ref jso_array
+ * @return Pointer to the first element.
+ */
+#define JSO_ARRAY_ELEMENTS(_arr) (_arr)->elements
+
 /**
  * Get array flags of the supplied array.
  *
@@ -119,6 +147,16 @@ JSO_API void jso_array_clear(jso_array *arr);
  */
 JSO_API void jso_array_free(jso_array *arr);
 
+/**
+ * Reserve space for the supplied number of elements.
+ *
+ * @param arr array
+ * @param size number of elements that the array should be able to hold
+ * @return @ref JSO_SUCCESS on success, otherwise @ref JSO_FAILURE.
+ * @note The capacity is never decreased.
+ */
+JSO_API jso_rc jso_array_reserve(jso_array *arr, size_t size);
+
 /**
  * Append value to the end of the array.
  *
@@ -131,6 +169,9 @@ JSO_API jso_rc jso_array_append(jso_array *arr, jso_value *val);
 /**
  * Push value to the beginning of the array.
  *
+ * All existing elements are moved so it is linear in the array length. The @ref jso_list
+ * should be used if pushing to the beginning is frequent.
+ *
  * @param arr array
  * @param val value
  * @return @ref JSO_SUCCESS on success, otherwise @ref JSO_FAILURE.
@@ -140,6 +181,8 @@ JSO_API jso_rc jso_array_push(jso_array *arr, jso_value *val);
 /**
  * Remove value from the beginning of the array.
  *
+ * The removed value is not freed.
+ *
  * @param arr array
  * @return @ref JSO_SUCCESS on success, otherwise @ref JSO_FAILURE.
  */
@@ -193,7 +236,10 @@ JSO_API jso_bool jso_array_are_all_items_of_type(jso_array *arr, jso_value_type
 /**
  * Check if array has only unieque items.
  *
- * @param arr1 first array
+ * Items are put into a temporary hash set keyed by @ref jso_value_hash so the check
+ * has expected linear complexity. Small arrays are checked by comparing all pairs.
+ *
+ * @param arr array
  * @return @ref JSO_TRUE if the array has unique items, otherwise @ref JSO_FALSE.
  */
 JSO_API jso_bool jso_array_is_unique(jso_array *arr);
@@ -203,10 +249,13 @@ JSO_API jso_bool jso_array_is_unique(jso_array *arr);
  *
  * @param arr array to copy
  * @return The copied array.
+ * @note Arena owned arrays are not reference counted.
  */
 static inline jso_array *jso_array_copy(jso_array *arr)
 {
-	++JSO_ARRAY_REFCOUNT(arr);
+	if (!(JSO_ARRAY_FLAGS(arr) & JSO_ARRAY_FLAG_ARENA)) {
+		++JSO_ARRAY_REFCOUNT(arr);
+	}
 	return arr;
 }
 
@@ -217,9 +266,10 @@ static inline jso_array *jso_array_copy(jso_array *arr)
  */
 #define JSO_ARRAY_FOREACH(_arr, _val) \
 	do { \
-		struct _jso_array_element *_array_el; \
-		for (_array_el = (_arr)->head; _array_el; _array_el = _array_el->next) { \
-			_val = &_array_el->val;
+		jso_value *_array_el = (_arr)->elements; \
+		jso_value *_array_end = _array_el + (_arr)->len; \
+		for (; _array_el < _array_end; ++_array_el) { \
+			_val = _array_el;
 
 /**
  * @brief Macro to end iteration of the array.
@@ -24,10 +24,12 @@
 #include "jso.h"
 #include "jso_cli.h"
 #include "jso_parser.h"
+#include "jso_ndjson.h"
 #include "jso_encoder.h"
 #include "jso_schema.h"
 
 #include "io/jso_io_file.h"
+#include "io/jso_io_mmap.h"
 
 #include <stdlib.h>
 #include <stdio.h>
@@ -36,7 +38,10 @@
 static jso_rc jso_cli_param_callback_depth(const char *value, jso_cli_options *options);
 static jso_rc jso_cli_param_callback_output(const char *value, jso_cli_options *options);
 static jso_rc jso_cli_param_callback_help(jso_cli_options *options);
+static jso_rc jso_cli_param_callback_ndjson(jso_cli_options *options);
 static jso_rc jso_cli_param_callback_schema(const char *value, jso_cli_options *options);
+static jso_rc jso_cli_param_callback_threads(const char *value, jso_cli_options *options);
+static jso_rc jso_cli_param_callback_validate(jso_cli_options *options);
 
 // clang-format off
 const jso_cli_param jso_cli_default_params[] = {
@@ -52,6 +57,12 @@ const jso_cli_param jso_cli_default_params[] = {
 		"This help text",
 		jso_cli_param_callback_help
 	)
+	JSO_CLI_PARAM_ENTRY_FLAG(
+		"ndjson",
+		'n',
+		"Parse newline delimited JSON records",
+		jso_cli_param_callback_ndjson
+	)
 	JSO_CLI_PARAM_ENTRY_VALUE(
 		"output-type",
 		'o',
@@ -64,6 +75,18 @@ const jso_cli_param jso_cli_default_params[] = {
 		"JsonSchema file used for validation",
 		jso_cli_param_callback_schema
 	)
+	JSO_CLI_PARAM_ENTRY_VALUE(
+		"threads",
+		't',
+		"Number of threads parsing newline delimited JSON records",
+		jso_cli_param_callback_threads
+	)
+	JSO_CLI_PARAM_ENTRY_FLAG(
+		"validate",
+		'v',
+		"Only check that the input is valid JSON without printing it",
+		jso_cli_param_callback_validate
+	)
 	JSO_CLI_PARAM_ENTRY_END
 };
 // clang-format on
@@ -98,7 +121,14 @@ static void jso_cli_print_parsing_error(
 
 	if (error_type == JSO_ERROR_SCHEMA) {
 		jso_schema_error *schema_error = JSO_ESCHEMAE_P(error);
-		JSO_IO_PRINTF(options->es, "Schema error: %s\n", schema_error->message);
+		const char *path = jso_schema_error_path(schema_error);
+		if (*path != '\0') {
+			JSO_IO_PRINTF(options->es, "Schema error at %s: %s\n", path,
+					jso_schema_error_message(schema_error));
+		} else {
+			JSO_IO_PRINTF(
+					options->es, "Schema error: %s\n", jso_schema_error_message(schema_error));
+		}
 		return;
 	}
 
@@ -112,8 +142,9 @@ static void jso_cli_print_parsing_error(
 			JSO_ELOC_P(error).first_line, JSO_ELOC_P(error).first_column);
 }
 
-static jso_rc jso_cli_parse_file_ex(
-		const char *file_path, jso_cli_options *options, jso_value *result, const char *file_type)
+/* read the whole file into the IO buffer */
+static jso_io *jso_cli_read_file(
+		const char *file_path, jso_cli_options *options, const char *file_type)
 {
 	jso_io *io;
 	off_t filesize;
@@ -123,7 +154,7 @@ static jso_rc jso_cli_parse_file_ex(
 	filesize = jso_io_file_size(file_path);
 	if (filesize < 0) {
 		JSO_IO_PRINTF(options->es, "Getting file size for %s '%s' failed\n", file_type, file_path);
-		return JSO_FAILURE;
+		return NULL;
 	}
 	bytes_to_read = (size_t) filesize;
 
@@ -131,7 +162,7 @@ static jso_rc jso_cli_parse_file_ex(
 	io = jso_io_file_open(file_path, "r");
 	if (!io) {
 		JSO_IO_PRINTF(options->es, "Opening the %s '%s' failed\n", file_type, file_path);
-		return JSO_FAILURE;
+		return NULL;
 	}
 	/* read the whole file into the buffer */
 	do {
@@ -142,17 +173,39 @@ static jso_rc jso_cli_parse_file_ex(
 	/* check the read data */
 	if (bytes_read_total == 0) {
 		JSO_IO_PRINTF(options->es, "No data in the %s '%s'\n", file_type, file_path);
-		return JSO_FAILURE;
+		JSO_IO_FREE(io);
+		return NULL;
 	}
 	/* check the read data */
 	if (bytes_read_total < bytes_to_read) {
 		JSO_IO_PRINTF(options->es, "Only %lu of %lu read from the %s '%s'\n", bytes_read_total,
 				bytes_to_read, file_type, file_path);
-		return JSO_FAILURE;
+		JSO_IO_FREE(io);
+		return NULL;
 	}
 
 	if (!JSO_IO_CURSOR(io)) {
 		JSO_IO_PRINTF(options->es, "Cursor of the %s is not set\n", file_type);
+		JSO_IO_FREE(io);
+		return NULL;
+	}
+
+	return io;
+}
+
+static jso_rc jso_cli_parse_file_ex(const char *file_path, jso_cli_options *options,
+		jso_value *result, const char *file_type, jso_bool validate)
+{
+	/* regular files are mapped without copying, other files are read into the buffer */
+	jso_io *io = jso_io_mmap_open(file_path);
+	if (io == NULL) {
+		io = jso_cli_read_file(file_path, options, file_type);
+		if (io == NULL) {
+			return JSO_FAILURE;
+		}
+	} else if (JSO_IO_SIZE(io) == 0) {
+		JSO_IO_PRINTF(options->es, "No data in the %s '%s'\n", file_type, file_path);
+		JSO_IO_FREE(io);
 		return JSO_FAILURE;
 	}
 
@@ -160,6 +213,7 @@ static jso_rc jso_cli_parse_file_ex(
 	jso_parser_options_init(&parser_options);
 	parser_options.max_depth = options->max_depth;
 	parser_options.schema = options->schema;
+	parser_options.validate = validate;
 	jso_rc rc = jso_parse_io(io, &parser_options, result);
 	if (rc == JSO_FAILURE) {
 		jso_cli_print_parsing_error(file_path, options, result);
@@ -174,21 +228,86 @@ static jso_rc jso_cli_parse_file_ex(
 JSO_API jso_rc jso_cli_parse_file(
 		const char *file_path, jso_cli_options *options, jso_value *result)
 {
-	return jso_cli_parse_file_ex(file_path, options, result, "file");
+	return jso_cli_parse_file_ex(file_path, options, result, "file", options->validate);
 }
 
-static jso_rc jso_cli_process_file(const char *file_path, jso_cli_options *options)
+static void jso_cli_print_result(jso_cli_options *options, jso_value *result, jso_rc rc)
 {
-	jso_value result;
-	jso_rc rc = jso_cli_parse_file(file_path, options, &result);
-
 	if (options->output_type == JSO_OUTPUT_DEBUG) {
-		jso_value_dump(&result, options->os);
+		jso_value_dump(result, options->os);
 	} else if (rc == JSO_SUCCESS) {
 		jso_encoder_options enc_options;
 		enc_options.max_depth = JSO_ENCODER_DEPTH_UNLIMITED;
 		enc_options.pretty = options->output_type == JSO_OUTPUT_PRETTY;
-		jso_encode(&result, options->os, &enc_options);
+		enc_options.double_mode = JSO_ENCODER_DOUBLE_MODE_SHORTEST;
+		enc_options.double_precision = 0;
+		jso_encode(result, options->os, &enc_options);
+	}
+}
+
+/**
+ * @brief Context of the NDJSON record callback.
+ */
+typedef struct _jso_cli_ndjson_ctx {
+	const char *file_path;
+	jso_cli_options *options;
+} jso_cli_ndjson_ctx;
+
+/* print the record or its error and continue with the next record */
+static jso_rc jso_cli_ndjson_callback(void *ctx, jso_ndjson_record *record)
+{
+	jso_cli_ndjson_ctx *cctx = ctx;
+	jso_cli_options *options = cctx->options;
+
+	if (JSO_TYPE(record->value) == JSO_TYPE_ERROR) {
+		JSO_IO_PRINTF(options->es, "Record %zu on line %zu: ", record->index, record->line);
+		jso_cli_print_parsing_error(cctx->file_path, options, &record->value);
+		jso_cli_print_result(options, &record->value, JSO_FAILURE);
+	} else if (!options->validate) {
+		jso_cli_print_result(options, &record->value, JSO_SUCCESS);
+		JSO_IO_PRINTF(options->os, "\n");
+	}
+
+	return JSO_SUCCESS;
+}
+
+static jso_rc jso_cli_process_ndjson_file(const char *file_path, jso_cli_options *options)
+{
+	/* regular files are mapped, other files are read in parts */
+	jso_io *io = jso_io_mmap_open(file_path);
+	if (io == NULL) {
+		io = jso_io_file_open(file_path, "r");
+		if (io == NULL) {
+			JSO_IO_PRINTF(options->es, "Opening the file '%s' failed\n", file_path);
+			return JSO_FAILURE;
+		}
+	}
+
+	jso_ndjson_options ndjson_options;
+	jso_ndjson_options_init(&ndjson_options);
+	ndjson_options.parser.max_depth = options->max_depth;
+	ndjson_options.parser.schema = options->schema;
+	ndjson_options.parser.validate = options->validate;
+	ndjson_options.threads = options->threads;
+	jso_cli_ndjson_ctx ctx = { file_path, options };
+	jso_rc rc = jso_ndjson_parse_io(io, &ndjson_options, jso_cli_ndjson_callback, &ctx);
+
+	JSO_IO_FREE(io);
+
+	return rc;
+}
+
+static jso_rc jso_cli_process_file(const char *file_path, jso_cli_options *options)
+{
+	if (options->ndjson) {
+		return jso_cli_process_ndjson_file(file_path, options);
+	}
+
+	jso_value result;
+	jso_rc rc = jso_cli_parse_file(file_path, options, &result);
+
+	if (!options->validate) {
+		jso_cli_print_result(options, &result, rc);
 	}
 
 	jso_value_free(&result);
@@ -215,6 +334,13 @@ static jso_rc jso_cli_param_callback_help(jso_cli_options *options)
 	return JSO_SUCCESS;
 }
 
+static jso_rc jso_cli_param_callback_ndjson(jso_cli_options *options)
+{
+	options->ndjson = JSO_TRUE;
+
+	return JSO_SUCCESS;
+}
+
 static jso_rc jso_cli_param_callback_output(const char *value, jso_cli_options *options)
 {
 	if (!value) {
@@ -248,7 +374,7 @@ static jso_rc jso_cli_param_callback_schema(const char *value, jso_cli_options *
 	}
 
 	jso_value result;
-	jso_rc rc = jso_cli_parse_file_ex(value, options, &result, "schema file");
+	jso_rc rc = jso_cli_parse_file_ex(value, options, &result, "schema file", JSO_FALSE);
 
 	if (options->output_type == JSO_OUTPUT_DEBUG) {
 		jso_value_dump(&result, options->os);
@@ -268,6 +394,25 @@ static jso_rc jso_cli_param_callback_schema(const char *value, jso_cli_options *
 	return rc;
 }
 
+static jso_rc jso_cli_param_callback_threads(const char *value, jso_cli_options *options)
+{
+	if (!value) {
+		JSO_IO_PRINTF(options->es, "Option threads requires value\n");
+		return JSO_FAILURE;
+	}
+
+	options->threads = atoi(value);
+
+	return JSO_SUCCESS;
+}
+
+static jso_rc jso_cli_param_callback_validate(jso_cli_options *options)
+{
+	options->validate = JSO_TRUE;
+
+	return JSO_SUCCESS;
+}
+
 JSO_API void jso_cli_options_init_pre(jso_cli_options *options)
 {
 	options->max_depth = 0;
@@ -276,6 +421,9 @@ JSO_API void jso_cli_options_init_pre(jso_cli_options *options)
 	options->os = jso_io_file_open_stream(stdout);
 	options->es = jso_io_file_open_stream(stderr);
 	options->schema = NULL;
+	options->ndjson = JSO_FALSE;
+	options->threads = 0;
+	options->validate = JSO_FALSE;
 }
 
 JSO_API void jso_cli_options_init_post(jso_cli_options *options)
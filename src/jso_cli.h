@@ -60,6 +60,12 @@ typedef struct _jso_cli_options {
 	jso_io *es;
 	/** JsonSchema to use for validation */
 	jso_schema *schema;
+	/** whether the input contains newline delimited JSON records */
+	jso_bool ndjson;
+	/** number of threads parsing the newline delimited JSON records */
+	jso_uint threads;
+	/** whether the input is only checked to be valid without printing it */
+	jso_bool validate;
 } jso_cli_options;
 
 /**
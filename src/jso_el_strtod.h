@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/**
+ * @file jso_el_strtod.h
+ * @brief Header for Eisel-Lemire decimal to double conversion
+ */
+
+#ifndef JSO_EL_STRTOD_H
+#define JSO_EL_STRTOD_H
+
+#include "jso_types.h"
+
+/**
+ * Maximal number of decimal digits that always fit to the significand.
+ */
+#define JSO_EL_STRTOD_MAX_DIGITS 19
+
+/**
+ * Convert decimal significand and exponent to double.
+ *
+ * It uses Clinger's fast path for small values and Eisel-Lemire algorithm for the rest. The
+ * algorithm can very rarely fail to determine the correct rounding. In such case the string
+ * needs to be converted by @ref jso_dg_strtod.
+ *
+ * @param mantissa exact decimal significand
+ * @param exp10 decimal exponent
+ * @param negative whether the number is negative
+ * @param result pointer where the resulted double will be saved
+ * @return @ref JSO_TRUE if the result is correctly rounded, otherwise @ref JSO_FALSE
+ * @note This is an internal function that is not exported.
+ */
+jso_bool jso_el_strtod(jso_uint64 mantissa, int exp10, jso_bool negative, double *result);
+
+#endif /* JSO_EL_STRTOD_H */
@@ -25,6 +25,8 @@
 #include "jso_io.h"
 #include "jso_object.h"
 #include "jso_encoder.h"
+#include "jso_number.h"
+#include "jso_simd.h"
 
 #include <stdio.h>
 #include <string.h>
@@ -32,19 +34,53 @@
 
 #define JSO_INT_BUFFER_SIZE 32
 
-static inline jso_rc jso_encoder_output_jstr(jso_encoder *encoder, jso_ctype *str, size_t len)
+static jso_rc jso_encoder_encode_value(jso_encoder *encoder, jso_value *val);
+
+/* write the buffered output to the output IO */
+static jso_rc jso_encoder_flush(jso_encoder *encoder)
 {
-	return JSO_IO_WRITE(encoder->output, str, len) == len ? JSO_SUCCESS : JSO_FAILURE;
+	size_t len = encoder->buffer_len;
+
+	encoder->buffer_len = 0;
+	if (len > 0 && JSO_IO_WRITE(encoder->output, encoder->buffer, len) != len) {
+		return JSO_FAILURE;
+	}
+
+	return JSO_SUCCESS;
+}
+
+static inline jso_rc jso_encoder_output_jstr(
+		jso_encoder *encoder, const jso_ctype *str, size_t len)
+{
+	if (len > JSO_ENCODER_BUFFER_SIZE - encoder->buffer_len) {
+		if (jso_encoder_flush(encoder) == JSO_FAILURE) {
+			return JSO_FAILURE;
+		}
+		/* big strings are written directly */
+		if (len > JSO_ENCODER_BUFFER_SIZE) {
+			return JSO_IO_WRITE(encoder->output, str, len) == len ? JSO_SUCCESS : JSO_FAILURE;
+		}
+	}
+	memcpy(encoder->buffer + encoder->buffer_len, str, len);
+	encoder->buffer_len += len;
+
+	return JSO_SUCCESS;
 }
 
 static inline jso_rc jso_encoder_output_cstr(jso_encoder *encoder, const char *str, size_t len)
 {
-	return jso_encoder_output_jstr(encoder, (jso_ctype *) str, len);
+	return jso_encoder_output_jstr(encoder, (const jso_ctype *) str, len);
 }
 
 static inline jso_rc jso_encoder_output_cchar(jso_encoder *encoder, char c)
 {
-	return jso_encoder_output_cstr(encoder, &c, 1);
+	if (encoder->buffer_len == JSO_ENCODER_BUFFER_SIZE
+			&& jso_encoder_flush(encoder) == JSO_FAILURE) {
+		return JSO_FAILURE;
+	}
+	encoder->buffer[encoder->buffer_len++] = (jso_ctype) c;
+
+	return JSO_SUCCESS;
 }
 
 static inline jso_rc jso_encoder_pretty_print_indent(jso_encoder *encoder)
@@ -122,8 +158,8 @@ static jso_rc jso_encoder_encode_int(jso_encoder *encoder, jso_int val)
 
 static jso_rc jso_encoder_encode_double(jso_encoder *encoder, jso_double val)
 {
-	char buf[128], *p;
-	int len;
+	char buf[JSO_NUMBER_DOUBLE_BUFFER_SIZE], *p;
+	size_t len;
 	/* this is noop as jso_double is always double */
 	double dv = (double) val;
 
@@ -131,60 +167,71 @@ static jso_rc jso_encoder_encode_double(jso_encoder *encoder, jso_double val)
 		return JSO_FAILURE;
 	}
 
-	len = snprintf(buf, sizeof(buf), "%.17g", dv);
-
-	p = strchr(buf, ',');
-	if (p) {
-		*p = '.';
+	switch (encoder->options.double_mode) {
+		case JSO_ENCODER_DOUBLE_MODE_PRECISION:
+			len = jso_number_format_double_precision(buf, dv, encoder->options.double_precision);
+			break;
+		case JSO_ENCODER_DOUBLE_MODE_LEGACY:
+			len = (size_t) snprintf(buf, sizeof(buf), "%.17g", dv);
+			p = strchr(buf, ',');
+			if (p) {
+				*p = '.';
+			}
+			break;
+		default:
+			len = jso_number_format_double(buf, dv);
+			break;
 	}
 
 	return jso_encoder_output_cstr(encoder, buf, len);
 }
 
-static jso_rc jso_encoder_encode_string(jso_encoder *encoder, jso_string *str)
+/* output escape sequence for the character */
+static jso_rc jso_encoder_output_escape(jso_encoder *encoder, jso_ctype c)
 {
-	size_t pos;
-	char c;
-
-	jso_encoder_output_cchar(encoder, '"');
-	for (pos = 0; pos < JSO_STRING_LEN(str); pos++) {
-		c = JSO_STRING_VAL(str)[pos];
-
-		switch (c) {
-			case '"':
-				jso_encoder_output_cstr(encoder, "\\\"", 2);
-				break;
-
-			case '\\':
-				jso_encoder_output_cstr(encoder, "\\\\", 2);
-				break;
-
-			case '/':
-				jso_encoder_output_cstr(encoder, "\\/", 2);
-				break;
-
-			case '\b':
-				jso_encoder_output_cstr(encoder, "\\b", 2);
-				break;
-
-			case '\f':
-				jso_encoder_output_cstr(encoder, "\\f", 2);
-				break;
-
-			case '\n':
-				jso_encoder_output_cstr(encoder, "\\n", 2);
-				break;
-
-			case '\r':
-				jso_encoder_output_cstr(encoder, "\\r", 2);
-				break;
+	static const char hex[] = "0123456789abcdef";
+	char unicode[] = { '\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xf] };
+
+	switch (c) {
+		case '"':
+			return jso_encoder_output_cstr(encoder, "\\\"", 2);
+		case '\\':
+			return jso_encoder_output_cstr(encoder, "\\\\", 2);
+		case '/':
+			return jso_encoder_output_cstr(encoder, "\\/", 2);
+		case '\b':
+			return jso_encoder_output_cstr(encoder, "\\b", 2);
+		case '\f':
+			return jso_encoder_output_cstr(encoder, "\\f", 2);
+		case '\n':
+			return jso_encoder_output_cstr(encoder, "\\n", 2);
+		case '\r':
+			return jso_encoder_output_cstr(encoder, "\\r", 2);
+		case '\t':
+			return jso_encoder_output_cstr(encoder, "\\t", 2);
+		default:
+			return jso_encoder_output_cstr(encoder, unicode, sizeof(unicode));
+	}
+}
 
-			case '\t':
-				jso_encoder_output_cstr(encoder, "\\t", 2);
-				break;
+static jso_rc jso_encoder_encode_string(jso_encoder *encoder, jso_string *str)
+{
+	const jso_ctype *pos = JSO_STRING_VAL(str);
+	const jso_ctype *end = pos + JSO_STRING_LEN(str);
+	size_t span;
 
-			default:
-				jso_encoder_output_cchar(encoder, c);
+	if (jso_encoder_output_cchar(encoder, '"') == JSO_FAILURE) {
+		return JSO_FAILURE;
+	}
+	while (pos < end) {
+		/* the characters that do not need escaping are copied in bulk */
+		span = jso_simd_escape_span(pos, (size_t) (end - pos));
+		if (span > 0 && jso_encoder_output_jstr(encoder, pos, span) == JSO_FAILURE) {
+			return JSO_FAILURE;
+		}
+		pos += span;
+		if (pos < end && jso_encoder_output_escape(encoder, *pos++) == JSO_FAILURE) {
+			return JSO_FAILURE;
 		}
 	}
 
@@ -208,7 +255,7 @@ static jso_rc jso_encoder_encode_array(jso_encoder *encoder, jso_array *arr)
 			jso_encoder_output_cstr(encoder, ",", 1);
 		}
 		jso_encoder_pretty_print_elsep(encoder);
-		jso_encoder_encode(encoder, val);
+		jso_encoder_encode_value(encoder, val);
 	}
 	JSO_ARRAY_FOREACH_END;
 
@@ -244,7 +291,7 @@ static jso_rc jso_encoder_encode_object(jso_encoder *encoder, jso_object *obj)
 		jso_encoder_encode_string(encoder, key);
 		jso_encoder_output_cstr(encoder, ":", 1);
 		jso_encoder_pretty_print_kvsep(encoder);
-		jso_encoder_encode(encoder, val);
+		jso_encoder_encode_value(encoder, val);
 	}
 	JSO_OBJECT_FOREACH_END;
 
@@ -264,9 +311,10 @@ JSO_API void jso_encoder_init(jso_encoder *encoder, jso_io *output, jso_encoder_
 	encoder->output = output;
 	memcpy(&encoder->options, options, sizeof(jso_encoder_options));
 	encoder->depth = 0;
+	encoder->buffer_len = 0;
 }
 
-JSO_API jso_rc jso_encoder_encode(jso_encoder *encoder, jso_value *val)
+static jso_rc jso_encoder_encode_value(jso_encoder *encoder, jso_value *val)
 {
 	switch (JSO_TYPE_P(val)) {
 		case JSO_TYPE_NULL:
@@ -292,6 +340,17 @@ JSO_API jso_rc jso_encoder_encode(jso_encoder *encoder, jso_value *val)
 	}
 }
 
+JSO_API jso_rc jso_encoder_encode(jso_encoder *encoder, jso_value *val)
+{
+	jso_rc rc = jso_encoder_encode_value(encoder, val);
+
+	if (jso_encoder_flush(encoder) == JSO_FAILURE) {
+		return JSO_FAILURE;
+	}
+
+	return rc;
+}
+
 JSO_API jso_rc jso_encode(jso_value *val, jso_io *output, jso_encoder_options *options)
 {
 	jso_encoder encoder;
@@ -52,6 +52,23 @@
  */
 #define JSO_ENCODER_PRETTY_KVSEP " "
 
+/**
+ * Size of the encoder output buffer.
+ */
+#define JSO_ENCODER_BUFFER_SIZE 8192
+
+/**
+ * @brief Double formatting mode of the encoder.
+ */
+typedef enum {
+	/** the shortest representation that converts back to the same value */
+	JSO_ENCODER_DOUBLE_MODE_SHORTEST = 0,
+	/** the representation with the configured number of significant digits */
+	JSO_ENCODER_DOUBLE_MODE_PRECISION,
+	/** the legacy `%.17g` representation */
+	JSO_ENCODER_DOUBLE_MODE_LEGACY,
+} jso_encoder_double_mode;
+
 /**
  * @brief Options for encoder.
  */
@@ -60,6 +77,10 @@ typedef struct _jso_encoder_options {
 	jso_int max_depth;
 	/** whether to use pretty printing */
 	jso_bool pretty;
+	/** double formatting mode */
+	jso_encoder_double_mode double_mode;
+	/** number of significant digits for @ref JSO_ENCODER_DOUBLE_MODE_PRECISION */
+	int double_precision;
 } jso_encoder_options;
 
 /**
@@ -72,6 +93,10 @@ typedef struct _jso_encoder {
 	jso_encoder_options options;
 	/* actual depth */
 	jso_int depth;
+	/* length of the buffered output */
+	size_t buffer_len;
+	/* output buffer that is written to the output IO in large chunks */
+	jso_ctype buffer[JSO_ENCODER_BUFFER_SIZE];
 } jso_encoder;
 
 /**
@@ -86,6 +111,8 @@ JSO_API void jso_encoder_init(jso_encoder *encoder, jso_io *output, jso_encoder_
 /**
  * Encode value using the encoder.
  *
+ * The output is buffered and the buffer is written to the output IO before returning.
+ *
  * @param encoder encoder instance
  * @param val value to encode
  * @return @ref JSO_SUCCESS on success, otherwise @ref JSO_FAILURE.
@@ -33,7 +33,7 @@
 /* alloc and init error from type and location struct */
 JSO_API jso_error *jso_error_new_ex(jso_error_type type, jso_error_location *loc)
 {
-	jso_error *err = jso_malloc(sizeof(jso_error));
+	jso_error *err = jso_calloc(1, sizeof(jso_error));
 	if (!err)
 		return NULL;
 
@@ -90,6 +90,10 @@ JSO_API const char *jso_error_type_description(jso_error_type type)
 			return "invalid escape";
 		case JSO_ERROR_SCHEMA:
 			return "schema";
+		case JSO_ERROR_ABORT:
+			return "aborted";
+		case JSO_ERROR_DUPLICATE_KEY:
+			return "duplicate key";
 		default:
 			return "unknown";
 	}
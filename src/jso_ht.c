@@ -28,54 +28,93 @@
 #include <string.h>
 
 /* Use FNV-1a hash function. */
-static jso_uint32 jso_ht_create_hash(const jso_ctype *val, size_t len)
+static inline jso_uint32 jso_ht_create_hash(const jso_ctype *val, size_t len)
 {
-	jso_uint32 hash = 2166136261u;
-	for (size_t i = 0; i < len; i++) {
-		hash ^= (jso_uint32) val[i];
-		hash *= 16777619;
-	}
-	return hash;
+	return jso_string_hash_update(JSO_STRING_HASH_INIT, val, len);
 }
 
-static inline jso_uint32 jso_ht_create_string_hash(jso_string *str)
+/* Use string hash that is computed only once and then cached in the string. */
+static inline jso_uint32 jso_ht_get_string_hash(jso_string *str)
 {
-	return jso_ht_create_hash(JSO_STRING_VAL(str), JSO_STRING_LEN(str));
+	return jso_string_hash(str);
 }
 
-static inline jso_uint32 jso_ht_get_string_hash(jso_string *str)
+/* Get start index - FNV-1a low bits are weak so the high bits are folded in before masking. */
+static inline size_t jso_ht_index(jso_uint32 hash, size_t mask)
 {
-	return jso_string_has_hash(str) ? jso_string_get_hash(str) : jso_ht_create_string_hash(str);
+	return (hash ^ (hash >> 15)) & mask;
 }
 
+/* Tombstone is an entry without key but with non zero hash. */
+#define JSO_HT_TOMBSTONE_HASH 1
+
+/* Find entry for C string key - returns empty entry if not found. */
 static inline jso_ht_entry *jso_ht_find_entry_by_cstr_key(
 		jso_ht_entry *entries, size_t capacity, const char *ckey, size_t key_len)
 {
-	jso_uint32 index = jso_ht_create_hash((const jso_ctype *) ckey, key_len) % capacity;
+	jso_uint32 hash = jso_ht_create_hash((const jso_ctype *) ckey, key_len);
+	size_t mask = capacity - 1;
+	size_t index = jso_ht_index(hash, mask);
 	while (1) {
 		jso_ht_entry *entry = &entries[index];
-		if (entry->key == NULL || jso_string_equals_to_cstr(entry->key, ckey)) {
+		if (entry->key == NULL) {
+			if (entry->hash == 0) {
+				return entry;
+			}
+		} else if (entry->hash == hash && JSO_STRING_LEN(entry->key) == key_len
+				&& !memcmp(JSO_STRING_VAL(entry->key), ckey, key_len)) {
 			return entry;
 		}
 
-		index = (index + 1) % capacity;
+		index = (index + 1) & mask;
 	}
 }
 
+/*
+ * Find entry for key - returns empty entry if not found. Tombstones are skipped and never reused
+ * as they are still linked in the insertion order chain.
+ */
 static inline jso_ht_entry *jso_ht_find_entry(
-		jso_ht_entry *entries, size_t capacity, jso_string *key)
+		jso_ht_entry *entries, size_t capacity, jso_string *key, jso_uint32 hash)
 {
-	jso_uint32 index = jso_ht_get_string_hash(key) % capacity;
+	size_t mask = capacity - 1;
+	size_t index = jso_ht_index(hash, mask);
 	while (1) {
 		jso_ht_entry *entry = &entries[index];
-		if (entry->key == NULL || jso_string_equals(entry->key, key)) {
+		if (entry->key == NULL) {
+			if (entry->hash == 0) {
+				return entry;
+			}
+		} else if (entry->hash == hash && jso_string_equals(entry->key, key)) {
 			return entry;
 		}
 
-		index = (index + 1) % capacity;
+		index = (index + 1) & mask;
 	}
 }
 
+/* Find empty entry in the table without tombstones (used for rehashing). */
+static inline jso_ht_entry *jso_ht_find_empty_entry(
+		jso_ht_entry *entries, size_t capacity, jso_uint32 hash)
+{
+	size_t mask = capacity - 1;
+	size_t index = jso_ht_index(hash, mask);
+	while (entries[index].key != NULL) {
+		index = (index + 1) & mask;
+	}
+	return &entries[index];
+}
+
+/* Round capacity up to the power of two. */
+static inline size_t jso_ht_round_capacity(size_t capacity)
+{
+	size_t result = 1;
+	while (result < capacity) {
+		result <<= 1;
+	}
+	return result;
+}
+
 static jso_rc jso_ht_adjust_capacity(jso_ht *ht, size_t capacity)
 {
 	jso_ht_entry *entries = jso_calloc(capacity, sizeof(jso_ht_entry));
@@ -84,12 +123,17 @@ static jso_rc jso_ht_adjust_capacity(jso_ht *ht, size_t capacity)
 	}
 
 	jso_ht_entry *first_entry = NULL, *last_entry = NULL;
-	for (jso_ht_entry *src_entry = ht->first_entry; src_entry; src_entry = src_entry->next) {
-		jso_ht_entry *dest_entry = jso_ht_find_entry(entries, capacity, src_entry->key);
+	for (jso_ht_entry *src_entry = ht->first_entry; src_entry;
+			src_entry = JSO_HT_ENTRY_NEXT(ht, src_entry)) {
+		if (src_entry->key == NULL) {
+			continue;
+		}
+		jso_ht_entry *dest_entry = jso_ht_find_empty_entry(entries, capacity, src_entry->hash);
 		dest_entry->key = src_entry->key;
 		dest_entry->value = src_entry->value;
+		dest_entry->hash = src_entry->hash;
 		if (last_entry) {
-			last_entry->next = dest_entry;
+			last_entry->next = (jso_uint32) (dest_entry - entries) + 1;
 		} else {
 			first_entry = dest_entry;
 		}
@@ -99,6 +143,7 @@ static jso_rc jso_ht_adjust_capacity(jso_ht *ht, size_t capacity)
 	jso_free(ht->entries);
 	ht->entries = entries;
 	ht->capacity = capacity;
+	ht->tombstones = 0;
 	ht->first_entry = first_entry;
 	ht->last_entry = last_entry;
 
@@ -110,7 +155,8 @@ static void jso_ht_free_entries(jso_ht *ht)
 	jso_string *key;
 	jso_value *val;
 
-	JSO_HT_FOREACH_RANDOM(ht, key, val)
+	/* the insertion order is used so only live entries are visited */
+	JSO_HT_FOREACH(ht, key, val)
 	{
 		if (JSO_STRING_VAL(key)) {
 			jso_string_free(key);
@@ -146,33 +192,59 @@ JSO_API void jso_ht_clear(jso_ht *ht)
 
 JSO_API jso_rc jso_ht_resize(jso_ht *ht, size_t size)
 {
-	size_t capacity = (size_t) (size * (1 / JSO_HT_MAX_LOAD) + 1);
+	size_t capacity = jso_ht_round_capacity((size_t) (size * (1 / JSO_HT_MAX_LOAD) + 1));
+	if (capacity > JSO_HT_MAX_CAPACITY) {
+		return JSO_FAILURE;
+	}
 	if (capacity <= ht->capacity) {
 		return capacity == ht->capacity ? JSO_SUCCESS : JSO_FAILURE;
 	}
 	return jso_ht_adjust_capacity(ht, capacity);
 }
 
-JSO_API jso_rc jso_ht_set(jso_ht *ht, jso_string *key, jso_value *value, jso_bool free_old)
+/*
+ * Find entry for key and link the empty entry to the insertion order chain if the key is not found.
+ * The table is grown before the lookup so the key is found by a single probe.
+ */
+static jso_ht_entry *jso_ht_find_or_link_entry(jso_ht *ht, jso_string *key, jso_bool *is_new_key)
 {
-	if (ht->count + 1 > ht->capacity * JSO_HT_MAX_LOAD) {
-		size_t capacity = (ht->capacity + 1) * 2;
-		if (jso_ht_adjust_capacity(ht, capacity) == JSO_FAILURE) {
-			return JSO_FAILURE;
+	if (ht->count + ht->tombstones + 1 > ht->capacity * JSO_HT_MAX_LOAD) {
+		/* grow only if removing tombstones would not release enough space */
+		size_t capacity = ht->capacity;
+		if (ht->count + 1 > capacity * JSO_HT_MAX_LOAD / 2) {
+			capacity = capacity ? capacity * 2 : JSO_HT_INITIAL_CAPACITY;
+		}
+		if (capacity > JSO_HT_MAX_CAPACITY
+				|| jso_ht_adjust_capacity(ht, capacity) == JSO_FAILURE) {
+			return NULL;
 		}
 	}
 
-	jso_ht_entry *entry = jso_ht_find_entry(ht->entries, ht->capacity, key);
-	jso_bool is_new_key = entry->key == NULL;
-	if (is_new_key) {
+	jso_uint32 hash = jso_ht_get_string_hash(key);
+	jso_ht_entry *entry = jso_ht_find_entry(ht->entries, ht->capacity, key, hash);
+	*is_new_key = entry->key == NULL;
+	if (*is_new_key) {
 		++ht->count;
+		entry->hash = hash;
 		if (ht->last_entry) {
-			ht->last_entry->next = entry;
+			ht->last_entry->next = (jso_uint32) (entry - ht->entries) + 1;
 			ht->last_entry = entry;
 		} else {
 			ht->first_entry = ht->last_entry = entry;
 		}
-	} else if (free_old) {
+	}
+
+	return entry;
+}
+
+JSO_API jso_rc jso_ht_set(jso_ht *ht, jso_string *key, jso_value *value, jso_bool free_old)
+{
+	jso_bool is_new_key;
+	jso_ht_entry *entry = jso_ht_find_or_link_entry(ht, key, &is_new_key);
+	if (entry == NULL) {
+		return JSO_FAILURE;
+	}
+	if (!is_new_key && free_old) {
 		jso_string_free(entry->key);
 	}
 
@@ -182,13 +254,57 @@ JSO_API jso_rc jso_ht_set(jso_ht *ht, jso_string *key, jso_value *value, jso_boo
 	return JSO_SUCCESS;
 }
 
+JSO_API jso_rc jso_ht_add_new(jso_ht *ht, jso_string *key, jso_value *value, jso_value **existing)
+{
+	jso_bool is_new_key;
+	jso_ht_entry *entry = jso_ht_find_or_link_entry(ht, key, &is_new_key);
+	if (entry == NULL) {
+		return JSO_FAILURE;
+	}
+	if (is_new_key) {
+		entry->key = key;
+		entry->value = *value;
+		*existing = NULL;
+	} else {
+		*existing = &entry->value;
+	}
+
+	return JSO_SUCCESS;
+}
+
+JSO_API jso_rc jso_ht_remove(jso_ht *ht, jso_string *key)
+{
+	if (ht->count == 0) {
+		return JSO_FAILURE;
+	}
+
+	jso_ht_entry *entry
+			= jso_ht_find_entry(ht->entries, ht->capacity, key, jso_ht_get_string_hash(key));
+	if (entry->key == NULL) {
+		return JSO_FAILURE;
+	}
+
+	jso_string_free(entry->key);
+	jso_value_free(&entry->value);
+
+	/* the entry stays in the insertion order chain so only key and value are cleared */
+	entry->key = NULL;
+	JSO_VALUE_SET_NULL(entry->value);
+	entry->hash = JSO_HT_TOMBSTONE_HASH;
+	--ht->count;
+	++ht->tombstones;
+
+	return JSO_SUCCESS;
+}
+
 JSO_API jso_rc jso_ht_get(jso_ht *ht, jso_string *key, jso_value **value)
 {
 	if (ht->count == 0) {
 		return JSO_FAILURE;
 	}
 
-	jso_ht_entry *entry = jso_ht_find_entry(ht->entries, ht->capacity, key);
+	jso_ht_entry *entry
+			= jso_ht_find_entry(ht->entries, ht->capacity, key, jso_ht_get_string_hash(key));
 	if (entry->key == NULL) {
 		return JSO_FAILURE;
 	}
@@ -203,7 +319,8 @@ JSO_API jso_bool jso_ht_has(jso_ht *ht, jso_string *key)
 		return false;
 	}
 
-	jso_ht_entry *entry = jso_ht_find_entry(ht->entries, ht->capacity, key);
+	jso_ht_entry *entry
+			= jso_ht_find_entry(ht->entries, ht->capacity, key, jso_ht_get_string_hash(key));
 	if (entry->key == NULL) {
 		return false;
 	}
@@ -234,11 +351,17 @@ JSO_API jso_rc jso_ht_get_by_cstr_key(jso_ht *ht, const char *key, jso_value **v
 
 JSO_API jso_rc jso_ht_clone(jso_ht *from, jso_ht *to)
 {
-	for (jso_ht_entry *entry = from->first_entry; entry; entry = entry->next) {
+	jso_string *key;
+	jso_value *val;
 
-		if (jso_ht_set(to, jso_string_copy(entry->key), &entry->value, true) == JSO_FAILURE) {
+	JSO_HT_FOREACH(from, key, val)
+	{
+		jso_string *key_copy = jso_string_copy(key);
+		if (key_copy == NULL || jso_ht_set(to, key_copy, val, true) == JSO_FAILURE) {
 			return JSO_FAILURE;
 		}
 	}
+	JSO_HT_FOREACH_END;
+
 	return JSO_SUCCESS;
 }
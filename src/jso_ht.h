@@ -33,26 +33,54 @@
 
 #define JSO_HT_MAX_LOAD 0.75
 
+/**
+ * @brief Initial hash table capacity (must be power of two).
+ */
+#define JSO_HT_INITIAL_CAPACITY 8
+
+/**
+ * @brief Maximal hash table capacity (entries are linked using 32-bit indexes).
+ */
+#define JSO_HT_MAX_CAPACITY ((size_t) 1 << 31)
+
 /**
  * @brief Hash table entry.
+ *
+ * The entry with NULL key is either empty (zero hash) or a tombstone of the removed entry
+ * (non zero hash). Tombstones stay linked in the insertion order chain until rehashing.
  */
 typedef struct _jso_ht_entry {
 	jso_string *key;
 	jso_value value;
-	struct _jso_ht_entry *next;
+	/** key hash */
+	jso_uint32 hash;
+	/** index of the next entry in the insertion order increased by one (0 for the last) */
+	jso_uint32 next;
 } jso_ht_entry;
 
 /**
  * @brief Hash table.
+ *
+ * The capacity is always zero or power of two so the index is obtained by masking the hash.
  */
 typedef struct _jso_ht {
 	size_t count;
+	size_t tombstones;
 	size_t capacity;
 	jso_ht_entry *entries;
 	jso_ht_entry *first_entry;
 	jso_ht_entry *last_entry;
 } jso_ht;
 
+/**
+ * @brief Get the next entry in the insertion order.
+ * @param _ht hash table
+ * @param _entry current entry
+ * @return The next entry or NULL if @p _entry is the last one.
+ */
+#define JSO_HT_ENTRY_NEXT(_ht, _entry) \
+	((_entry)->next ? &(_ht)->entries[(_entry)->next - 1] : NULL)
+
 /**
  * @brief Macro to start iteration of the hash table in random order (faster).
  * @param _ht hash table
@@ -80,8 +108,11 @@ typedef struct _jso_ht {
  */
 #define JSO_HT_FOREACH(_ht, _key, _val) \
 	do { \
-		for (jso_ht_entry *_entry = _ht->first_entry; _entry; _entry = _entry->next) { \
+		for (jso_ht_entry *_entry = _ht->first_entry; _entry; \
+				_entry = JSO_HT_ENTRY_NEXT(_ht, _entry)) { \
 			_key = _entry->key; \
+			if (_key == NULL) \
+				continue; \
 			_val = &_entry->value;
 
 /**
@@ -92,25 +123,6 @@ typedef struct _jso_ht {
 	} \
 	while (0)
 
-/**
- * @brief Macro to start iteration of the hash table in random order (possibly faster).
- * @param _ht hash table
- * @param _key entry key
- * @param _val entry value pointer
- */
-#define JSO_HT_FOREACH_RANDOM(_ht, _key, _val) \
-	do { \
-		jso_ht_entry *_entries = _ht->entries; \
-		jso_ht_entry *_entry; \
-		size_t _found = 0; \
-		for (size_t _i = 0; _i < _ht->capacity && _found < _ht->count; _i++) { \
-			_entry = &_entries[_i]; \
-			_key = _entry->key; \
-			if (_key == NULL) \
-				continue; \
-			++_found; \
-			_val = &_entry->value;
-
 /**
  * Allocate new hash table.
  *
@@ -145,7 +157,7 @@ JSO_API void jso_ht_clear(jso_ht *ht);
  * @param ht hash table
  * @param size new size
  * @return @ref JSO_SUCCESS on success, otherwise @ref JSO_FAILURE.
- * @note Only increasing of size is allowed.
+ * @note Only increasing of size is allowed. The capacity is rounded up to the power of two.
  */
 JSO_API jso_rc jso_ht_resize(jso_ht *ht, size_t size);
 
@@ -160,6 +172,33 @@ JSO_API jso_rc jso_ht_resize(jso_ht *ht, size_t size);
  */
 JSO_API jso_rc jso_ht_set(jso_ht *ht, jso_string *key, jso_value *value, jso_bool free_old);
 
+/**
+ * Add value to the hash table only if the key does not exist.
+ *
+ * The existing entry is found by the same probe that inserts the new one so checking for the
+ * duplicate key does not need any extra lookup.
+ *
+ * @param ht hash table
+ * @param key key of the value
+ * @param value value to add
+ * @param existing pointer that gets the value of the existing key or NULL if the value is added
+ * @return @ref JSO_SUCCESS on success, otherwise @ref JSO_FAILURE.
+ * @note The key and value are not owned by the hash table if the key exists.
+ */
+JSO_API jso_rc jso_ht_add_new(
+		jso_ht *ht, jso_string *key, jso_value *value, jso_value **existing);
+
+/**
+ * Remove value from the hash table.
+ *
+ * The removed key and value are freed. The order of the remaining entries is kept.
+ *
+ * @param ht hash table
+ * @param key key of the value to remove
+ * @return @ref JSO_SUCCESS on success, otherwise @ref JSO_FAILURE if key does not exist.
+ */
+JSO_API jso_rc jso_ht_remove(jso_ht *ht, jso_string *key);
+
 /**
  * Get value from the hash table.
  *
@@ -114,8 +114,12 @@ struct _jso_io {
 	size_t str_esc;
 	/** size of the buffer */
 	size_t size;
+	/** whether the buffer holds the whole input and it is never moved or released by reading */
+	jso_bool whole;
 	/** the last error number */
 	int error_code;
+	/** allocator of the structure and buffer - the current allocator when the IO is opened */
+	const jso_allocator *allocator;
 	/** io handle */
 	union {
 		/** pointer (e.g. FILE *) */
@@ -145,7 +149,20 @@ struct _jso_io {
  * @param io IO handle
  * @return New IO handle.
  */
-#define JSO_IO_ALLOC(io) ((jso_io *) jso_calloc(1, sizeof(jso_io)));
+#define JSO_IO_ALLOC(io) jso_io_alloc()
+
+/**
+ * Free IO structure allocated by @ref JSO_IO_ALLOC.
+ * @param io IO handle
+ */
+#define JSO_IO_DEALLOC(io) jso_allocator_free(JSO_IO_ALLOCATOR(io), io)
+
+/**
+ * Allocator accessor.
+ * @param io IO handle
+ * @return Allocator used for the IO structure and buffer.
+ */
+#define JSO_IO_ALLOCATOR(io) ((io)->allocator)
 
 /**
  * Buffer accessor.
@@ -203,6 +220,13 @@ struct _jso_io {
  */
 #define JSO_IO_SIZE(io) ((io)->size)
 
+/**
+ * Whole input accessor.
+ * @param io IO handle
+ * @return Whether the buffer holds the whole input at stable location.
+ */
+#define JSO_IO_WHOLE(io) ((io)->whole)
+
 /**
  * Last error code accessor.
  * @param io IO handle
@@ -383,6 +407,12 @@ struct _jso_io {
  */
 #define JSO_IO_BUFFER_ALLOC_STRATEGY_MASK 7
 
+/**
+ * Allocate IO structure using the current allocator.
+ * @return New zeroed IO handle or NULL on failure.
+ */
+JSO_API jso_io *jso_io_alloc(void);
+
 /**
  * Initialize IO with supplied buffer.
  * @param io IO handle
@@ -394,7 +424,7 @@ JSO_API void jso_io_buffer_init(jso_io *io, jso_ctype *buf, size_t size);
 /**
  * Alloc memory space for buffer with supplied flags.
  * @param io IO handle
- * @param size new buffer size
+ * @param size minimal number of free characters after the buffer limit
  * @param flags extra flags for selecting strategy
  * @return @ref JSO_SUCCESS on success, otherwise @ref JSO_FAILURE.
  */
@@ -403,11 +433,17 @@ JSO_API jso_rc jso_io_buffer_alloc_ex(jso_io *io, size_t size, int flags);
 /**
  * Alloc memory space for buffer.
  * @param io IO handle
- * @param size new buffer size
+ * @param size minimal number of free characters after the buffer limit
  * @return @ref JSO_SUCCESS on success, otherwise @ref JSO_FAILURE.
  */
 JSO_API jso_rc jso_io_buffer_alloc(jso_io *io, size_t size);
 
+/**
+ * Free buffer allocated by @ref jso_io_buffer_alloc.
+ * @param io IO handle
+ */
+JSO_API void jso_io_buffer_free(jso_io *io);
+
 /**
  * @brief The number of bytes read to the src buffer when piping
  */
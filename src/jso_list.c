@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2012-2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "jso.h"
+
+#include <stdlib.h>
+
+/* alloc and init new list */
+JSO_API jso_list *jso_list_alloc()
+{
+	return jso_calloc(1, sizeof(jso_list));
+}
+
+/* init list */
+JSO_API void jso_list_init(jso_list *list)
+{
+	memset(list, 0, sizeof(jso_list));
+}
+
+/* clear all list items without clearing values */
+JSO_API void jso_list_clear(jso_list *list)
+{
+	if (!list)
+		return;
+	if (JSO_LIST_REFCOUNT(list) > 0) {
+		--JSO_LIST_REFCOUNT(list);
+		return;
+	}
+	jso_list_element *tmp, *el = list->head;
+	while (el) {
+		tmp = el->next;
+		jso_free(el);
+		el = tmp;
+	}
+}
+
+/* free list and its elements */
+JSO_API void jso_list_free(jso_list *list)
+{
+	if (!list)
+		return;
+	if (JSO_LIST_REFCOUNT(list) > 0) {
+		--JSO_LIST_REFCOUNT(list);
+		return;
+	}
+	jso_list_element *tmp, *el = list->head;
+	while (el) {
+		jso_value_free(&el->val);
+		tmp = el->next;
+		jso_free(el);
+		el = tmp;
+	}
+	jso_free(list);
+}
+
+/* append element to the list */
+JSO_API jso_rc jso_list_append(jso_list *list, jso_value *val)
+{
+	jso_list_element *el = jso_malloc(sizeof(jso_list_element));
+	if (!el)
+		return JSO_FAILURE;
+	el->val = *val;
+	el->next = NULL;
+	if (!list->head) {
+		list->head = list->tail = el;
+	} else {
+		list->tail->next = el;
+		list->tail = el;
+	}
+	++list->len;
+	return JSO_SUCCESS;
+}
+
+/* push element to the list */
+JSO_API jso_rc jso_list_push(jso_list *list, jso_value *val)
+{
+	jso_list_element *el = jso_malloc(sizeof(jso_list_element));
+	if (!el)
+		return JSO_FAILURE;
+	el->val = *val;
+	el->next = list->head;
+	list->head = el;
+	if (!list->tail)
+		list->tail = el;
+	++list->len;
+	return JSO_SUCCESS;
+}
+
+/* pop the head element from the list */
+JSO_API jso_rc jso_list_pop(jso_list *list)
+{
+	jso_list_element *el = list->head;
+	if (!el)
+		return JSO_FAILURE;
+	--list->len;
+	if (el == list->tail)
+		list->head = list->tail = NULL;
+	else
+		list->head = list->head->next;
+	jso_free(el);
+	return JSO_SUCCESS;
+}
+
+/* get list element at the supplied index */
+JSO_API jso_rc jso_list_index(jso_list *list, size_t index, jso_value **value)
+{
+	if (list->len == 0 || index >= list->len) {
+		return JSO_FAILURE;
+	}
+	jso_list_element *el = list->head;
+	JSO_ASSERT_NOT_NULL(el);
+	for (size_t i = 0; i < index; i++) {
+		el = el->next;
+		JSO_ASSERT_NOT_NULL(el);
+	}
+	*value = &el->val;
+	return JSO_SUCCESS;
+}
+
+/* call cbk function for each element in list */
+JSO_API void jso_list_apply(jso_list *list, jso_list_callback cbk)
+{
+	size_t pos = 0;
+	jso_list_element *el = list->head;
+	while (el) {
+		cbk(pos++, &el->val);
+		el = el->next;
+	}
+}
+
+/* call cbk function with arg for each element in list */
+JSO_API void jso_list_apply_with_arg(jso_list *list, jso_list_with_arg_callback cbk, void *arg)
+{
+	size_t pos = 0;
+	jso_list_element *el = list->head;
+	while (el) {
+		cbk(pos++, &el->val, arg);
+		el = el->next;
+	}
+}
+
+/* compare lists */
+JSO_API jso_bool jso_list_equals(jso_list *list1, jso_list *list2)
+{
+	if (list1->len != list2->len) {
+		return JSO_FALSE;
+	}
+
+	jso_list_element *el1 = list1->head, *el2 = list2->head;
+	while (el1 && el2) {
+		if (!jso_value_equals(&el1->val, &el2->val)) {
+			return JSO_FALSE;
+		}
+		el1 = el1->next;
+		el2 = el2->next;
+	}
+
+	return el1 == el2;
+}
+
+/* check item types */
+JSO_API jso_bool jso_list_are_all_items_of_type(jso_list *list, jso_value_type type)
+{
+	jso_list_element *el = list->head;
+	while (el) {
+		if (JSO_TYPE(el->val) != type) {
+			return JSO_FALSE;
+		}
+		el = el->next;
+	}
+
+	return JSO_TRUE;
+}
+
+/* check uniqueness */
+JSO_API jso_bool jso_list_is_unique(jso_list *list)
+{
+	jso_list_element *el = list->head, *el2;
+	while (el) {
+		el2 = el->next;
+		while (el2) {
+			if (jso_value_equals(&el->val, &el2->val)) {
+				return JSO_FALSE;
+			}
+			el2 = el2->next;
+		}
+		el = el->next;
+	}
+
+	return JSO_TRUE;
+}
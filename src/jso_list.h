@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2012-2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/**
+ * @file jso_list.h
+ * @brief List header
+ */
+
+#ifndef JSO_LIST_H
+#define JSO_LIST_H
+
+#include "jso_types.h"
+
+/**
+ * @brief List element.
+ */
+typedef struct _jso_list_element {
+	jso_value val;
+	struct _jso_list_element *next;
+} jso_list_element;
+
+/**
+ * @brief List main structure.
+ *
+ * The list is implemented as a singly linked list so pushing to the head is cheap.
+ */
+struct _jso_list {
+	/* list first element */
+	jso_list_element *head;
+	/* list last element */
+	jso_list_element *tail;
+	/* list length */
+	size_t len;
+	/* list reference count */
+	jso_uint16 refcount;
+	/* list flags */
+	jso_uint16 flags;
+};
+
+/**
+ * Get length of the supplied list.
+ *
+ * @param _list pointer to @ref jso_list
+ * @return List length.
+ */
+#define JSO_LIST_LEN(_list) (_list)->len
+
+/**
+ * Get list flags of the supplied list.
+ *
+ * @param _list pointer to @ref jso_list
+ * @return String flags.
+ */
+#define JSO_LIST_FLAGS(_list) (_list)->flags
+
+/**
+ * Get reference count of the supplied list.
+ *
+ * @param _list pointer to @ref jso_list
+ * @return References count value.
+ */
+#define JSO_LIST_REFCOUNT(_list) (_list)->refcount
+
+/**
+ * @brief List iteration function callback.
+ */
+typedef void (*jso_list_callback)(size_t idx, jso_value *val);
+
+/**
+ * @brief List iteration function callback with argument.
+ */
+typedef void (*jso_list_with_arg_callback)(size_t idx, jso_value *val, void *arg);
+
+/**
+ * Allocate and initialize list.
+ *
+ * @return New initialized list.
+ */
+JSO_API jso_list *jso_list_alloc();
+
+/**
+ * Initialize list.
+ *
+ * @param list list
+ */
+JSO_API void jso_list_init(jso_list *list);
+
+/**
+ * Clear list items.
+ *
+ * @param list list
+ */
+JSO_API void jso_list_clear(jso_list *list);
+
+/**
+ * Free list.
+ *
+ * @param list list
+ */
+JSO_API void jso_list_free(jso_list *list);
+
+/**
+ * Append value to the end of the list.
+ *
+ * @param list list
+ * @param val value
+ * @return @ref JSO_SUCCESS on success, otherwise @ref JSO_FAILURE.
+ */
+JSO_API jso_rc jso_list_append(jso_list *list, jso_value *val);
+
+/**
+ * Push value to the beginning of the list.
+ *
+ * @param list list
+ * @param val value
+ * @return @ref JSO_SUCCESS on success, otherwise @ref JSO_FAILURE.
+ */
+JSO_API jso_rc jso_list_push(jso_list *list, jso_value *val);
+
+/**
+ * Remove value from the beginning of the list.
+ *
+ * @param list list
+ * @return @ref JSO_SUCCESS on success, otherwise @ref JSO_FAILURE.
+ */
+JSO_API jso_rc jso_list_pop(jso_list *list);
+
+/**
+ * Get value at the list index.
+ *
+ * @param list list
+ * @param index list index
+ * @param value returned value
+ * @return @ref JSO_SUCCESS on success, otherwise @ref JSO_FAILURE.
+ */
+JSO_API jso_rc jso_list_index(jso_list *list, size_t index, jso_value **value);
+
+/**
+ * Call callback for each value in the list.
+ *
+ * @param list list
+ * @param cbk callback function
+ */
+JSO_API void jso_list_apply(jso_list *list, jso_list_callback cbk);
+
+/**
+ * Call callback with extra argument for each value in the list.
+ *
+ * @param list list
+ * @param cbk callback function
+ * @param arg callback argument
+ */
+JSO_API void jso_list_apply_with_arg(jso_list *list, jso_list_with_arg_callback cbk, void *arg);
+
+/**
+ * Check whether two lists are equal.
+ *
+ * @param list1 first list
+ * @param list2 second list
+ * @return @ref JSO_TRUE if the lists are equal, otherwise @ref JSO_FALSE.
+ */
+JSO_API jso_bool jso_list_equals(jso_list *list1, jso_list *list2);
+
+/**
+ * Check whether all items are of the supplied type.
+ *
+ * @param list list
+ * @param type type to be check for all items
+ * @return  @ref JSO_TRUE if all items are of the supplied type, otherwise @ref JSO_FALSE.
+ */
+JSO_API jso_bool jso_list_are_all_items_of_type(jso_list *list, jso_value_type type);
+
+/**
+ * Check if list has only unieque items.
+ *
+ * @param list1 first list
+ * @return @ref JSO_TRUE if the list has unique items, otherwise @ref JSO_FALSE.
+ */
+JSO_API jso_bool jso_list_is_unique(jso_list *list);
+
+/**
+ * Copy list.
+ *
+ * @param list list to copy
+ * @return The copied list.
+ */
+static inline jso_list *jso_list_copy(jso_list *list)
+{
+	++JSO_LIST_REFCOUNT(list);
+	return list;
+}
+
+/**
+ * @brief Macro to start iteration of the list.
+ * @param _list list
+ * @param _val value pointer
+ */
+#define JSO_LIST_FOREACH(_list, _val) \
+	do { \
+		struct _jso_list_element *_list_el; \
+		for (_list_el = (_list)->head; _list_el; _list_el = _list_el->next) { \
+			_val = &_list_el->val;
+
+/**
+ * @brief Macro to end iteration of the list.
+ */
+#define JSO_LIST_FOREACH_END \
+	} \
+	} \
+	while (0)
+
+#endif /* JSO_LIST_H */
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2012-2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "jso.h"
+#include "jso_mm.h"
+
+#include <stddef.h>
+#include <stdlib.h>
+
+/* default allocation callback */
+static void *jso_mm_default_alloc(size_t size, void *ctx)
+{
+	return malloc(size);
+}
+
+/* default reallocation callback */
+static void *jso_mm_default_realloc(void *ptr, size_t size, void *ctx)
+{
+	return realloc(ptr, size);
+}
+
+/* default freeing callback */
+static void jso_mm_default_free(void *ptr, void *ctx)
+{
+	free(ptr);
+}
+
+static const jso_allocator jso_mm_default_allocator = {
+	jso_mm_default_alloc,
+	jso_mm_default_realloc,
+	jso_mm_default_free,
+	NULL,
+};
+
+const jso_allocator *jso_mm_global_allocator = &jso_mm_default_allocator;
+
+_Thread_local const jso_allocator *jso_mm_current_allocator = NULL;
+
+/* get default allocator */
+JSO_API const jso_allocator *jso_mm_get_default_allocator(void)
+{
+	return &jso_mm_default_allocator;
+}
+
+/* get process wide allocator */
+JSO_API const jso_allocator *jso_mm_get_global_allocator(void)
+{
+	return jso_mm_global_allocator;
+}
+
+/* set process wide allocator and return the previous one */
+JSO_API const jso_allocator *jso_mm_set_global_allocator(const jso_allocator *allocator)
+{
+	const jso_allocator *previous = jso_mm_global_allocator;
+	jso_mm_global_allocator = allocator != NULL ? allocator : &jso_mm_default_allocator;
+	return previous;
+}
+
+/* get allocator of the current thread */
+JSO_API const jso_allocator *jso_mm_get_allocator(void)
+{
+	return jso_mm_resolve(NULL);
+}
+
+/* set allocator of the current thread and return the previously set one */
+JSO_API const jso_allocator *jso_mm_set_allocator(const jso_allocator *allocator)
+{
+	const jso_allocator *previous = jso_mm_current_allocator;
+	jso_mm_current_allocator = allocator;
+	return previous;
+}
+
+/* header prepended to each block allocated by the counter to keep its size */
+typedef union _jso_mm_counter_header {
+	size_t size;
+	max_align_t align;
+} jso_mm_counter_header;
+
+/* account allocated bytes in the counter */
+static inline void jso_mm_counter_add(jso_mm_counter *counter, size_t size)
+{
+	counter->stats.total_bytes += size;
+	counter->stats.used_bytes += size;
+	if (counter->stats.used_bytes > counter->stats.peak_bytes) {
+		counter->stats.peak_bytes = counter->stats.used_bytes;
+	}
+}
+
+/* allocate new block from the parent allocator and account it */
+static void *jso_mm_counter_block_alloc(jso_mm_counter *counter, size_t size)
+{
+	if (size > SIZE_MAX - sizeof(jso_mm_counter_header)) {
+		return NULL;
+	}
+	jso_mm_counter_header *header
+			= jso_allocator_malloc(counter->parent, sizeof(jso_mm_counter_header) + size);
+	if (header == NULL) {
+		return NULL;
+	}
+	header->size = size;
+	jso_mm_counter_add(counter, size);
+
+	return header + 1;
+}
+
+/* counter allocation callback */
+static void *jso_mm_counter_alloc(size_t size, void *ctx)
+{
+	jso_mm_counter *counter = (jso_mm_counter *) ctx;
+
+	++counter->stats.alloc_calls;
+
+	return jso_mm_counter_block_alloc(counter, size);
+}
+
+/* counter reallocation callback */
+static void *jso_mm_counter_realloc(void *ptr, size_t size, void *ctx)
+{
+	jso_mm_counter *counter = (jso_mm_counter *) ctx;
+
+	++counter->stats.realloc_calls;
+	if (ptr == NULL) {
+		return jso_mm_counter_block_alloc(counter, size);
+	}
+	if (size > SIZE_MAX - sizeof(jso_mm_counter_header)) {
+		return NULL;
+	}
+	jso_mm_counter_header *header = ((jso_mm_counter_header *) ptr) - 1;
+	size_t old_size = header->size;
+	header = jso_allocator_realloc(
+			counter->parent, header, sizeof(jso_mm_counter_header) + size);
+	if (header == NULL) {
+		return NULL;
+	}
+	header->size = size;
+	counter->stats.used_bytes -= old_size;
+	jso_mm_counter_add(counter, size);
+
+	return header + 1;
+}
+
+/* counter freeing callback */
+static void jso_mm_counter_free(void *ptr, void *ctx)
+{
+	jso_mm_counter *counter = (jso_mm_counter *) ctx;
+
+	++counter->stats.free_calls;
+	if (ptr == NULL) {
+		return;
+	}
+	jso_mm_counter_header *header = ((jso_mm_counter_header *) ptr) - 1;
+	counter->stats.used_bytes -= header->size;
+	jso_allocator_free(counter->parent, header);
+}
+
+JSO_API const jso_allocator *jso_mm_counter_init(
+		jso_mm_counter *counter, const jso_allocator *parent)
+{
+	memset(counter, 0, sizeof(jso_mm_counter));
+	counter->parent = jso_mm_resolve(parent);
+	counter->allocator.alloc = jso_mm_counter_alloc;
+	counter->allocator.realloc = jso_mm_counter_realloc;
+	counter->allocator.free = jso_mm_counter_free;
+	counter->allocator.ctx = counter;
+
+	return &counter->allocator;
+}
+
+JSO_API void jso_mm_counter_reset(jso_mm_counter *counter)
+{
+	size_t used_bytes = counter->stats.used_bytes;
+
+	memset(&counter->stats, 0, sizeof(jso_mm_stats));
+	counter->stats.used_bytes = used_bytes;
+	counter->stats.peak_bytes = used_bytes;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012-2023 Jakub Zelenka. All rights reserved.
+ * Copyright (c) 2012-2025 Jakub Zelenka. All rights reserved.
  *
  * Permission is hereby granted, free of charge, to any person obtaining a
  * copy of this software and associated documentation files (the "Software"),
@@ -29,28 +29,326 @@
 #ifndef JSO_MM_H
 #define JSO_MM_H
 
-/* memeroy functions - just redefinitions for potential future extending */
+#include "jso_types.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 /**
- * @brief Memory allocation
+ * @brief Allocation callback.
+ * @param size number of bytes to allocate
+ * @param ctx allocator context
+ * @return Pointer to the allocated memory or NULL on failure.
  */
-#define jso_malloc malloc
+typedef void *(*jso_allocator_alloc_t)(size_t size, void *ctx);
 
 /**
- * @brief Memory reallocation
+ * @brief Reallocation callback.
+ * @param ptr previously allocated memory or NULL
+ * @param size new number of bytes
+ * @param ctx allocator context
+ * @return Pointer to the reallocated memory or NULL on failure.
  */
-#define jso_realloc realloc
+typedef void *(*jso_allocator_realloc_t)(void *ptr, size_t size, void *ctx);
 
 /**
- * @brief Memory allocation with zeroing all bytes
+ * @brief Freeing callback.
+ * @param ptr memory to free (can be NULL)
+ * @param ctx allocator context
  */
-#define jso_calloc calloc
+typedef void (*jso_allocator_free_t)(void *ptr, void *ctx);
 
 /**
- * @brief Memory freeing
+ * @brief Memory allocator.
+ *
+ * All memory in the library is allocated through the current allocator so it can be replaced
+ * by a custom implementation.
+ */
+struct _jso_allocator {
+	/** allocation callback */
+	jso_allocator_alloc_t alloc;
+	/** reallocation callback */
+	jso_allocator_realloc_t realloc;
+	/** freeing callback */
+	jso_allocator_free_t free;
+	/** user context passed to all callbacks */
+	void *ctx;
+};
+
+/**
+ * @brief Allocation statistics.
+ */
+typedef struct _jso_mm_stats {
+	/** number of allocation calls */
+	size_t alloc_calls;
+	/** number of reallocation calls */
+	size_t realloc_calls;
+	/** number of freeing calls */
+	size_t free_calls;
+	/** total number of bytes requested by allocations and reallocations */
+	size_t total_bytes;
+	/** number of currently allocated bytes */
+	size_t used_bytes;
+	/** the highest number of allocated bytes at any time */
+	size_t peak_bytes;
+} jso_mm_stats;
+
+/**
+ * @brief Counting allocator.
+ *
+ * It forwards all calls to the parent allocator and keeps statistics about them. It is not
+ * thread safe so a separate counter should be used for each thread.
+ */
+typedef struct _jso_mm_counter {
+	/** allocator vtable with the counter as a context */
+	jso_allocator allocator;
+	/** allocator that does the actual allocations */
+	const jso_allocator *parent;
+	/** collected statistics */
+	jso_mm_stats stats;
+} jso_mm_counter;
+
+/**
+ * @brief Process wide allocator used by threads that have not set their own allocator.
+ * @note Use @ref jso_mm_set_global_allocator to change it.
+ */
+extern const jso_allocator *jso_mm_global_allocator;
+
+/**
+ * @brief Allocator used by the current thread or NULL to use the global allocator.
+ * @note Use @ref jso_mm_set_allocator to change it.
+ */
+extern _Thread_local const jso_allocator *jso_mm_current_allocator;
+
+/**
+ * Get the default allocator using the C library functions.
+ *
+ * @return Default allocator.
+ */
+JSO_API const jso_allocator *jso_mm_get_default_allocator(void);
+
+/**
+ * Get the process wide allocator.
+ *
+ * @return Global allocator.
+ */
+JSO_API const jso_allocator *jso_mm_get_global_allocator(void);
+
+/**
+ * Set the process wide allocator.
+ *
+ * It is used by all threads that have not set their own allocator. It should be set before any
+ * memory is allocated and not changed when other threads use the library.
+ *
+ * @param allocator new allocator or NULL to use the default allocator
+ * @return The previous allocator.
+ */
+JSO_API const jso_allocator *jso_mm_set_global_allocator(const jso_allocator *allocator);
+
+/**
+ * Get the allocator used by the current thread.
+ *
+ * @return Current allocator.
+ */
+JSO_API const jso_allocator *jso_mm_get_allocator(void);
+
+/**
+ * Set the allocator used by the current thread.
+ *
+ * The memory must be always freed by the same allocator that allocated it so the allocator
+ * should be usually switched just for a limited scope and the previous one restored.
+ *
+ * @param allocator new allocator or NULL to use the global allocator
+ * @return The previously set allocator (NULL if the thread used the global allocator) that can be
+ * passed back to restore it.
+ */
+JSO_API const jso_allocator *jso_mm_set_allocator(const jso_allocator *allocator);
+
+/**
+ * Start using the allocator in the current thread.
+ *
+ * @param allocator allocator to use or NULL to keep the current one
+ * @return The previous allocator that has to be passed to @ref jso_mm_leave.
+ */
+static inline const jso_allocator *jso_mm_enter(const jso_allocator *allocator)
+{
+	const jso_allocator *previous = jso_mm_current_allocator;
+	if (allocator != NULL) {
+		jso_mm_current_allocator = allocator;
+	}
+	return previous;
+}
+
+/**
+ * Restore the allocator that was used before @ref jso_mm_enter.
+ *
+ * @param previous allocator returned by @ref jso_mm_enter
+ */
+static inline void jso_mm_leave(const jso_allocator *previous)
+{
+	jso_mm_current_allocator = previous;
+}
+
+/**
+ * Get the allocator that is used when NULL allocator is passed.
+ *
+ * @param allocator allocator or NULL for the current thread allocator
+ * @return The allocator if not NULL, otherwise the current thread allocator.
+ */
+static inline const jso_allocator *jso_mm_resolve(const jso_allocator *allocator)
+{
+	if (allocator == NULL) {
+		allocator = jso_mm_current_allocator;
+		if (allocator == NULL) {
+			allocator = jso_mm_global_allocator;
+		}
+	}
+	return allocator;
+}
+
+/**
+ * Memory allocation using the supplied allocator.
+ *
+ * @param allocator allocator or NULL for the current thread allocator
+ * @param size number of bytes to allocate
+ * @return Pointer to the allocated memory or NULL on failure.
+ */
+static inline void *jso_allocator_malloc(const jso_allocator *allocator, size_t size)
+{
+	allocator = jso_mm_resolve(allocator);
+	return allocator->alloc(size, allocator->ctx);
+}
+
+/**
+ * Memory reallocation using the supplied allocator.
+ *
+ * @param allocator allocator or NULL for the current thread allocator
+ * @param ptr previously allocated memory or NULL
+ * @param size new number of bytes
+ * @return Pointer to the reallocated memory or NULL on failure.
+ */
+static inline void *jso_allocator_realloc(const jso_allocator *allocator, void *ptr, size_t size)
+{
+	allocator = jso_mm_resolve(allocator);
+	return allocator->realloc(ptr, size, allocator->ctx);
+}
+
+/**
+ * Memory allocation with zeroing all bytes using the supplied allocator.
+ *
+ * @param allocator allocator or NULL for the current thread allocator
+ * @param nmemb number of members
+ * @param size size of each member
+ * @return Pointer to the allocated memory or NULL on failure.
+ */
+static inline void *jso_allocator_calloc(const jso_allocator *allocator, size_t nmemb, size_t size)
+{
+	if (size != 0 && nmemb > SIZE_MAX / size) {
+		return NULL;
+	}
+	void *ptr = jso_allocator_malloc(allocator, nmemb * size);
+	if (ptr != NULL) {
+		memset(ptr, 0, nmemb * size);
+	}
+	return ptr;
+}
+
+/**
+ * Memory freeing using the supplied allocator.
+ *
+ * @param allocator allocator or NULL for the current thread allocator
+ * @param ptr memory to free (can be NULL)
+ */
+static inline void jso_allocator_free(const jso_allocator *allocator, void *ptr)
+{
+	allocator = jso_mm_resolve(allocator);
+	allocator->free(ptr, allocator->ctx);
+}
+
+/**
+ * Memory allocation.
+ *
+ * @param size number of bytes to allocate
+ * @return Pointer to the allocated memory or NULL on failure.
+ */
+static inline void *jso_malloc(size_t size)
+{
+	return jso_allocator_malloc(NULL, size);
+}
+
+/**
+ * Memory reallocation.
+ *
+ * @param ptr previously allocated memory or NULL
+ * @param size new number of bytes
+ * @return Pointer to the reallocated memory or NULL on failure.
+ */
+static inline void *jso_realloc(void *ptr, size_t size)
+{
+	return jso_allocator_realloc(NULL, ptr, size);
+}
+
+/**
+ * Memory allocation with zeroing all bytes.
+ *
+ * @param nmemb number of members
+ * @param size size of each member
+ * @return Pointer to the allocated memory or NULL on failure.
+ */
+static inline void *jso_calloc(size_t nmemb, size_t size)
+{
+	return jso_allocator_calloc(NULL, nmemb, size);
+}
+
+/**
+ * Memory freeing.
+ *
+ * @param ptr memory to free (can be NULL)
+ */
+static inline void jso_free(void *ptr)
+{
+	jso_allocator_free(NULL, ptr);
+}
+
+/**
+ * Initialize counting allocator.
+ *
+ * @param counter counter to initialize
+ * @param parent allocator doing the actual allocations or NULL for the current thread allocator
+ * @return Allocator vtable of the counter.
+ */
+JSO_API const jso_allocator *jso_mm_counter_init(
+		jso_mm_counter *counter, const jso_allocator *parent);
+
+/**
+ * Reset statistics of the counting allocator.
+ *
+ * The number of currently used bytes is preserved as the memory is still allocated.
+ *
+ * @param counter counting allocator
+ */
+JSO_API void jso_mm_counter_reset(jso_mm_counter *counter);
+
+/**
+ * Get the allocator vtable of the counter.
+ *
+ * @param counter counting allocator
+ * @return Allocator that can be passed to @ref jso_mm_set_allocator or options.
+ */
+static inline const jso_allocator *jso_mm_counter_get_allocator(jso_mm_counter *counter)
+{
+	return &counter->allocator;
+}
+
+/**
+ * Get statistics of the counting allocator.
+ *
+ * @param counter counting allocator
+ * @return Collected statistics.
  */
-#define jso_free free
+static inline const jso_mm_stats *jso_mm_counter_get_stats(jso_mm_counter *counter)
+{
+	return &counter->stats;
+}
 
 #endif /* JSO_MM_H */
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/**
+ * @file jso_ndjson.h
+ * @brief Newline delimited JSON (JSON Lines) parser
+ */
+
+#ifndef JSO_NDJSON_H
+#define JSO_NDJSON_H
+
+#include "jso_types.h"
+#include "jso_parser.h"
+
+/**
+ * @brief Default maximal number of the record bytes that are parsed or waiting for delivery.
+ */
+#define JSO_NDJSON_MAX_PENDING_BYTES (4 * 1024 * 1024)
+
+/**
+ * @brief NDJSON record.
+ */
+typedef struct _jso_ndjson_record {
+	/** zero based index of the record (empty lines are not counted) */
+	size_t index;
+	/** line of the record start in the input */
+	size_t line;
+	/** parsed value or error value with location in the whole input if parsing failed */
+	jso_value value;
+} jso_ndjson_record;
+
+/**
+ * Callback receiving the records in the input order.
+ *
+ * The record value is valid only until the callback returns.
+ *
+ * @param ctx context passed to the parse function
+ * @param record parsed record
+ * @return @ref JSO_SUCCESS to continue, otherwise @ref JSO_FAILURE to stop parsing.
+ */
+typedef jso_rc (*jso_ndjson_callback_t)(void *ctx, jso_ndjson_record *record);
+
+/**
+ * @brief NDJSON parser options.
+ */
+typedef struct _jso_ndjson_options {
+	/**
+	 * Parser options used for all records. The arena is replaced by the arena of the parsed
+	 * batch of records.
+	 */
+	jso_parser_options parser;
+	/** number of threads parsing the records or 0 to parse them in the calling thread */
+	jso_uint threads;
+	/**
+	 * Whether the allocator can be called from more threads at once. If it is not set, the
+	 * allocator calls are serialized when more threads are used. The default allocator using
+	 * the C library functions is always considered thread safe.
+	 */
+	jso_bool thread_safe_allocator;
+	/** maximal number of the record bytes that are parsed or waiting for delivery */
+	size_t max_pending_bytes;
+} jso_ndjson_options;
+
+/**
+ * Initialize NDJSON parser options.
+ *
+ * @param options options to initialize
+ */
+JSO_API void jso_ndjson_options_init(jso_ndjson_options *options);
+
+/**
+ * Parse newline delimited records from IO and deliver them to callback.
+ *
+ * The input is split at the newlines that are not inside strings and the empty lines are
+ * skipped. The records are parsed in batches by the thread pool and delivered in the input
+ * order from the calling thread. The IO is read in parts and the batches are copied from it so
+ * only the pending records are kept in memory.
+ *
+ * @param io IO to parse data from
+ * @param options NDJSON parser options
+ * @param callback callback receiving the records
+ * @param ctx context passed to callback
+ * @return @ref JSO_SUCCESS if all records were parsed and delivered, otherwise
+ * @ref JSO_FAILURE.
+ */
+JSO_API jso_rc jso_ndjson_parse_io(jso_io *io, const jso_ndjson_options *options,
+		jso_ndjson_callback_t callback, void *ctx);
+
+/**
+ * Parse newline delimited records from C string and deliver them to callback.
+ *
+ * @param cstr C string holding the data to parse
+ * @param len C string length
+ * @param options NDJSON parser options
+ * @param callback callback receiving the records
+ * @param ctx context passed to callback
+ * @return @ref JSO_SUCCESS if all records were parsed and delivered, otherwise
+ * @ref JSO_FAILURE.
+ */
+JSO_API jso_rc jso_ndjson_parse_cstr(const char *cstr, size_t len,
+		const jso_ndjson_options *options, jso_ndjson_callback_t callback, void *ctx);
+
+#endif /* JSO_NDJSON_H */
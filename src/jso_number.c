@@ -25,74 +25,139 @@
 #include "jso_types.h"
 
 #include "jso_dg_dtoa.h"
+#include "jso_el_strtod.h"
+#include "jso_ryu_dtoa.h"
 
 #include "jso.h"
 
+#include <limits.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <math.h>
 
-JSO_API jso_number_string *jso_number_string_from_double(jso_number_string *nstr, double val)
+/* check whether the character is decimal digit */
+static inline jso_bool jso_number_is_digit(char c)
 {
-	char *digits, *dst, *src;
-	int i, decpt;
-	int sign;
+	return (unsigned char) (c - '0') < 10;
+}
 
-	memset(nstr, 0, sizeof(jso_number_string));
+/* write the digits in decimal notation or in exponent notation if the exponent is out of range */
+static size_t jso_number_format_digits(char *buf, const char *digits, int ndigits, int decpt,
+		jso_bool negative, int exp_min, int exp_max, jso_bool *exp_notation)
+{
+	char *p = buf;
+	int exp = decpt - 1;
+	jso_bool use_exp = exp < exp_min || exp >= exp_max;
 
-	digits = jso_dg_dtoa(val, 0, 17, &decpt, &sign, NULL);
-	nstr->negative = (bool) sign;
-	if (decpt == 9999) {
-		if (*digits == 'I') {
-			nstr->infinity = true;
+	if (negative) {
+		*p++ = '-';
+	}
+	if (use_exp) {
+		*p++ = digits[0];
+		if (ndigits > 1) {
+			*p++ = '.';
+			memcpy(p, digits + 1, (size_t) ndigits - 1);
+			p += ndigits - 1;
+		}
+		*p++ = 'e';
+		if (exp < 0) {
+			*p++ = '-';
+			exp = -exp;
 		} else {
-			nstr->nan = true;
+			*p++ = '+';
+		}
+		if (exp >= 100) {
+			*p++ = (char) ('0' + exp / 100);
+		}
+		if (exp >= 10) {
+			*p++ = (char) ('0' + exp / 10 % 10);
 		}
+		*p++ = (char) ('0' + exp % 10);
+	} else if (decpt <= 0) {
+		*p++ = '0';
+		*p++ = '.';
+		memset(p, '0', (size_t) -decpt);
+		p += -decpt;
+		memcpy(p, digits, (size_t) ndigits);
+		p += ndigits;
+	} else if (decpt >= ndigits) {
+		memcpy(p, digits, (size_t) ndigits);
+		p += ndigits;
+		memset(p, '0', (size_t) (decpt - ndigits));
+		p += decpt - ndigits;
+	} else {
+		memcpy(p, digits, (size_t) decpt);
+		p += decpt;
+		*p++ = '.';
+		memcpy(p, digits + decpt, (size_t) (ndigits - decpt));
+		p += ndigits - decpt;
+	}
+	*p = '\0';
 
-		nstr->len = snprintf(&nstr->result[0], sizeof(nstr->result), "%s%s",
-				(sign && *digits == 'I') ? "-" : "", *digits == 'I' ? "INF" : "NaN");
+	if (exp_notation) {
+		*exp_notation = use_exp;
+	}
 
-		jso_dg_freedtoa(digits);
-		return nstr;
+	return (size_t) (p - buf);
+}
+
+JSO_API size_t jso_number_format_double(char *buf, double val)
+{
+	char digits[JSO_RYU_DTOA_MAX_DIGITS];
+	int decpt, ndigits = jso_ryu_dtoa(val, digits, &decpt);
+
+	return jso_number_format_digits(
+			buf, digits, ndigits, decpt, signbit(val) != 0, -4, JSO_RYU_DTOA_MAX_DIGITS, NULL);
+}
+
+JSO_API size_t jso_number_format_double_precision(char *buf, double val, int precision)
+{
+	char tmp[JSO_NUMBER_DOUBLE_BUFFER_SIZE], digits[JSO_RYU_DTOA_MAX_DIGITS], *p;
+	int ndigits = 0;
+
+	if (precision < 1) {
+		precision = 1;
+	} else if (precision > JSO_RYU_DTOA_MAX_DIGITS) {
+		precision = JSO_RYU_DTOA_MAX_DIGITS;
 	}
 
-	dst = &nstr->result[0];
-	if (sign) {
-		*dst++ = '-';
-	}
-	if (decpt < 0) {
-		/* standard format 0. */
-		*dst++ = '0'; /* zero before decimal point */
-		*dst++ = '.';
-		do {
-			*dst++ = '0';
-		} while (++decpt < 0);
-		src = digits;
-		while (*src != '\0') {
-			*dst++ = *src++;
-		}
-		*dst = '\0';
-	} else {
-		/* standard format */
-		for (i = 0, src = digits; i < decpt; i++) {
-			if (*src != '\0') {
-				*dst++ = *src++;
-			} else {
-				*dst++ = '0';
-			}
+	/* the decimal point is skipped as it depends on locale */
+	snprintf(tmp, sizeof(tmp), "%.*e", precision - 1, fabs(val));
+	for (p = tmp; *p != 'e'; p++) {
+		if (jso_number_is_digit(*p)) {
+			digits[ndigits++] = *p;
 		}
-		if (*src != '\0') {
-			if (src == digits) {
-				*dst++ = '0'; /* zero before decimal point */
-			}
-			*dst++ = '.';
-			for (i = decpt; digits[i] != '\0'; i++) {
-				*dst++ = digits[i];
-			}
-		}
-		*dst = '\0';
 	}
-	nstr->len = strlen(dst);
-	jso_dg_freedtoa(digits);
+	while (ndigits > 1 && digits[ndigits - 1] == '0') {
+		--ndigits;
+	}
+
+	return jso_number_format_digits(
+			buf, digits, ndigits, atoi(p + 1) + 1, signbit(val) != 0, -4, precision, NULL);
+}
+
+JSO_API jso_number_string *jso_number_string_from_double(jso_number_string *nstr, double val)
+{
+	char digits[JSO_RYU_DTOA_MAX_DIGITS];
+	int decpt, ndigits;
+
+	memset(nstr, 0, sizeof(jso_number_string));
+
+	nstr->negative = signbit(val) != 0;
+	if (isinf(val) || isnan(val)) {
+		nstr->infinity = isinf(val) != 0;
+		nstr->nan = !nstr->infinity;
+		nstr->len = (size_t) snprintf(&nstr->result[0], sizeof(nstr->result), "%s%s",
+				(nstr->negative && nstr->infinity) ? "-" : "", nstr->infinity ? "INF" : "NaN");
+		return nstr;
+	}
+
+	/* the exponent range is limited so the result always fits to the buffer */
+	ndigits = jso_ryu_dtoa(val, digits, &decpt);
+	nstr->len = jso_number_format_digits(&nstr->result[0], digits, ndigits, decpt,
+			nstr->negative, -100, 100, &nstr->exp_notation);
+
 	return nstr;
 }
 
@@ -108,6 +173,72 @@ JSO_API jso_number_string *jso_number_string_from_number(jso_number_string *nstr
 	return jso_number_string_from_double(nstr, num->dval);
 }
 
+JSO_API jso_number *jso_number_parse(jso_number *num, const char *str, size_t len)
+{
+	const char *p = str, *end = str + len;
+	jso_uint64 mantissa = 0;
+	int digits = 0, exp10 = 0;
+	jso_bool negative = false, truncated = false;
+
+	if (p < end && *p == '-') {
+		negative = true;
+		++p;
+	}
+	/* only significant digits are counted so the mantissa cannot overflow */
+	for (; p < end && jso_number_is_digit(*p); ++p) {
+		if (digits < JSO_EL_STRTOD_MAX_DIGITS) {
+			mantissa = mantissa * 10 + (jso_uint64) (*p - '0');
+			digits += mantissa != 0;
+		} else {
+			truncated = truncated || *p != '0';
+			++exp10;
+		}
+	}
+
+	if (p == end && exp10 == 0
+			&& mantissa <= (jso_uint64) LONG_MAX + (jso_uint64) negative) {
+		num->is_int = true;
+		/* the subtraction prevents overflow for the minimal value */
+		num->ival = negative && mantissa ? -(jso_int) (mantissa - 1) - 1 : (jso_int) mantissa;
+		return num;
+	}
+
+	if (p < end && *p == '.') {
+		for (++p; p < end && jso_number_is_digit(*p); ++p) {
+			if (digits < JSO_EL_STRTOD_MAX_DIGITS) {
+				mantissa = mantissa * 10 + (jso_uint64) (*p - '0');
+				digits += mantissa != 0;
+				--exp10;
+			} else {
+				truncated = truncated || *p != '0';
+			}
+		}
+	}
+	if (p < end && (*p == 'e' || *p == 'E')) {
+		jso_bool exp_negative = false;
+		int exp = 0;
+		++p;
+		if (p < end && (*p == '-' || *p == '+')) {
+			exp_negative = *p == '-';
+			++p;
+		}
+		for (; p < end && jso_number_is_digit(*p); ++p) {
+			/* anything bigger overflows or underflows for any mantissa */
+			if (exp < 100000) {
+				exp = exp * 10 + (*p - '0');
+			}
+		}
+		exp10 += exp_negative ? -exp : exp;
+	}
+
+	num->is_int = false;
+	if (truncated || !jso_el_strtod(mantissa, exp10, negative, &num->dval)) {
+		num->dval = jso_dg_strtod(str, NULL);
+	}
+
+	return num;
+}
+
 JSO_API bool jso_number_eq(jso_number *num1, jso_number *num2)
 {
 	if (num1->is_int && num2->is_int) {
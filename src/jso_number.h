@@ -163,8 +163,43 @@ typedef struct _jso_number_string {
 	!(JSO_NUMBER_STRING_IS_OVERFLOW(nstr) && JSO_NUMBER_STRING_IS_UNDERFLOW(nstr) \
 			&& JSO_NUMBER_STRING_IS_OVERFLOW(nstr))
 
+/**
+ * Size of the buffer that is needed for formatting double.
+ */
+#define JSO_NUMBER_DOUBLE_BUFFER_SIZE 32
+
+/**
+ * Format double to the shortest representation that converts back to the same value.
+ *
+ * The value is formatted in the same notation as the `%.17g` format but only the shortest digits
+ * are used and the exponent is not padded with zeros. The result does not depend on locale and
+ * the conversion does not allocate.
+ *
+ * @param buf buffer of at least @ref JSO_NUMBER_DOUBLE_BUFFER_SIZE size
+ * @param val finite value to format
+ * @return The length of the formatted string (the buffer is also null terminated).
+ */
+JSO_API size_t jso_number_format_double(char *buf, double val);
+
+/**
+ * Format double with the supplied number of significant digits.
+ *
+ * The value is formatted in the same notation as the `%.*g` format but the exponent is not
+ * padded with zeros and the result does not depend on locale.
+ *
+ * @param buf buffer of at least @ref JSO_NUMBER_DOUBLE_BUFFER_SIZE size
+ * @param val finite value to format
+ * @param precision number of significant digits (limited to the range from 1 to 17)
+ * @return The length of the formatted string (the buffer is also null terminated).
+ */
+JSO_API size_t jso_number_format_double_precision(char *buf, double val, int precision);
+
 /**
  * Create a number string from double.
+ *
+ * The shortest representation is used and it is written without exponent unless the value is
+ * too big or too small to fit to the buffer.
+ *
  * @param nstr number string
  * @param val value which is the string converted from
  * @return The supplied number string.
@@ -201,6 +236,22 @@ static inline char *jso_number_cstr_from_number(jso_number_string *nstr, jso_num
 	return JSO_NUMBER_STRING_VAL_P(jso_number_string_from_number(nstr, num));
 }
 
+/**
+ * Parse the JSON number.
+ *
+ * The integers are parsed in a single pass and the doubles use the Eisel-Lemire algorithm with
+ * fallback to the slow correctly rounded conversion for the hard cases. The integers that do not
+ * fit to @ref jso_int are converted to double.
+ *
+ * @param num number where the result is saved
+ * @param str number string that must be a valid JSON number
+ * @param len number string length
+ * @return The supplied number.
+ * @note The slow conversion does not use the length so the number string must be followed by
+ * a character that cannot be part of the number (e.g. the terminating null character).
+ */
+JSO_API jso_number *jso_number_parse(jso_number *num, const char *str, size_t len);
+
 /**
  * Compare two numbers if the first one is equal to the second one.
  *
@@ -40,7 +40,7 @@ JSO_API void jso_object_init(jso_object *obj)
 /* free object and its elements */
 JSO_API void jso_object_free(jso_object *obj)
 {
-	if (!obj)
+	if (!obj || (JSO_OBJECT_FLAGS(obj) & JSO_OBJECT_FLAG_ARENA))
 		return;
 	if (JSO_OBJECT_REFCOUNT(obj) > 0) {
 		--JSO_OBJECT_REFCOUNT(obj);
@@ -62,6 +62,19 @@ JSO_API jso_rc jso_object_add(jso_object *obj, jso_string *key, jso_value *val)
 	return jso_ht_set(&obj->ht, key, val, true);
 }
 
+/* add new element to the object obj if its key does not exist */
+JSO_API jso_rc jso_object_add_new(
+		jso_object *obj, jso_string *key, jso_value *val, jso_value **existing)
+{
+	return jso_ht_add_new(&obj->ht, key, val, existing);
+}
+
+/* remove element from the object obj */
+JSO_API jso_rc jso_object_remove(jso_object *obj, jso_string *key)
+{
+	return jso_ht_remove(&obj->ht, key);
+}
+
 /* get element of the object obj */
 JSO_API jso_rc jso_object_get(jso_object *obj, jso_string *key, jso_value **val)
 {
@@ -32,6 +32,11 @@
 #include "jso_types.h"
 #include "jso_ht.h"
 
+/**
+ * @brief Object flag defining whether the object is owned by an arena.
+ */
+#define JSO_OBJECT_FLAG_ARENA 1
+
 /**
  * @brief Object structure.
  */
@@ -134,6 +139,29 @@ JSO_API jso_rc jso_object_resize(jso_object *obj, size_t size);
  */
 JSO_API jso_rc jso_object_add(jso_object *obj, jso_string *key, jso_value *val);
 
+/**
+ * Add value with a key to the object only if the key does not exist.
+ *
+ * @param obj object
+ * @param key key of the value
+ * @param val value to add
+ * @param existing pointer to set with the value of the existing key or NULL if the value is added
+ * @return @ref JSO_SUCCESS on success, otherwise @ref JSO_FAILURE.
+ * @note The key and value are not owned by the object if the key exists.
+ */
+JSO_API jso_rc jso_object_add_new(
+		jso_object *obj, jso_string *key, jso_value *val, jso_value **existing);
+
+/**
+ * Remove value with the supplied key from the object.
+ *
+ * @param obj object
+ * @param key key of the value
+ * @return @ref JSO_SUCCESS on success, otherwise @ref JSO_FAILURE if the key does not exist.
+ * @note The removed key and value are freed.
+ */
+JSO_API jso_rc jso_object_remove(jso_object *obj, jso_string *key);
+
 /**
  * Get value with the supplied key in the object.
  *
@@ -197,10 +225,13 @@ JSO_API jso_bool jso_object_equals(jso_object *obj1, jso_object *obj2);
  *
  * @param obj object to copy
  * @return The copied object.
+ * @note Arena owned objects are not reference counted.
  */
 static inline jso_object *jso_object_copy(jso_object *obj)
 {
-	++JSO_OBJECT_REFCOUNT(obj);
+	if (!(JSO_OBJECT_FLAGS(obj) & JSO_OBJECT_FLAG_ARENA)) {
+		++JSO_OBJECT_REFCOUNT(obj);
+	}
 	return obj;
 }
 
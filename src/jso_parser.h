@@ -25,6 +25,7 @@
 #define JSO_PARSER_H
 
 #include "jso_types.h"
+#include "jso_arena.h"
 #include "jso_scanner.h"
 #include "jso_schema.h"
 
@@ -60,13 +61,76 @@ typedef struct _jso_parser_hooks {
 	jso_parser_hook_value_t value;
 } jso_parser_hooks;
 
+/**
+ * @brief Parser engine.
+ */
+typedef enum {
+	/** the scanned tokens are parsed by the LALR parser */
+	JSO_PARSER_ENGINE_DEFAULT = 0,
+	/**
+	 * The structural characters of the whole input are indexed in blocks first and then the
+	 * index is walked to build the values. The input that is not valid is parsed again by the
+	 * default engine to get the exact error and its location.
+	 */
+	JSO_PARSER_ENGINE_STRUCTURAL,
+} jso_parser_engine;
+
+/**
+ * @brief Policy for the duplicate keys in the parsed object.
+ */
+typedef enum {
+	/** the value of the last duplicate key is used in place of the first key */
+	JSO_PARSER_DUPLICATE_KEYS_LAST_WINS = 0,
+	/** the value of the first key is kept and the values of the duplicate keys are dropped */
+	JSO_PARSER_DUPLICATE_KEYS_FIRST_WINS,
+	/** the duplicate key is an error of type @ref JSO_ERROR_DUPLICATE_KEY */
+	JSO_PARSER_DUPLICATE_KEYS_ERROR,
+	/**
+	 * The values of all duplicate keys are collected in the order of the input to an array that
+	 * is flagged by @ref JSO_ARRAY_FLAG_DUPLICATES so it can be distinguished from an array value.
+	 */
+	JSO_PARSER_DUPLICATE_KEYS_COLLECT,
+} jso_parser_duplicate_keys;
+
 /**
  * @brief Parser options.
  */
 typedef struct _jso_parser_options {
 	jso_uint max_depth;
+	/**
+	 * Whether the input is only checked to be well-formed. The strings and numbers are not
+	 * created and the nesting is only counted so the valid input is checked without allocating.
+	 * The result has the type of the root value but its containers are NULL. It is ignored if
+	 * the schema is set.
+	 */
 	jso_bool validate;
 	jso_schema *schema;
+	/**
+	 * Arena for all memory of the parsed document. The document values are not reference
+	 * counted and freeing them is a no-op. They must not be modified and they are all released
+	 * by clearing or freeing the arena.
+	 */
+	jso_arena *arena;
+	/**
+	 * Allocator used for all memory allocated during parsing or NULL to use the current thread
+	 * allocator. The result must be freed by the same allocator.
+	 */
+	const jso_allocator *allocator;
+	/**
+	 * Whether the escape free strings reference the input instead of copying it. The input
+	 * must not be modified or released before the document. The borrowed strings are not NUL
+	 * terminated and @ref jso_string_copy creates their owned copy. It is used only for the IO
+	 * holding the whole input (string and memory mapped IO) so it is ignored by the push parser.
+	 */
+	jso_bool borrow_strings;
+	/** Engine used for parsing. It is ignored by the push parser. */
+	jso_parser_engine engine;
+	/**
+	 * Policy for the duplicate object keys. The duplicate key is found by the same hash table
+	 * probe that adds the key so it does not cost any extra lookup. The validation only parsing
+	 * does not create objects so the duplicate keys are not detected by it.
+	 */
+	jso_parser_duplicate_keys duplicate_keys;
 } jso_parser_options;
 
 /**
@@ -91,8 +155,66 @@ struct _jso_parser {
 	jso_value result;
 	jso_uint depth;
 	jso_uint max_depth;
+	jso_arena *arena;
+	jso_parser_duplicate_keys duplicate_keys;
 };
 
+/**
+ * @brief Minimal number of characters copied to the push parser buffer when the pending token
+ * continues in the next chunk.
+ */
+#define JSO_PUSH_PARSER_FILL_SIZE 64
+
+/**
+ * @brief Push parser state.
+ *
+ * The chunks are scanned directly from the caller memory. Only the token that is interrupted
+ * by the end of the chunk is copied to the buffer and it is completed from the following chunks.
+ */
+typedef struct _jso_push_parser {
+	/** parser state */
+	jso_parser parser;
+	/** bison push parser state */
+	struct jso_push_yypstate *pstate;
+	/** IO holding the currently scanned input */
+	jso_io io;
+	/** schema validation stream */
+	jso_schema_validation_stream schema_stream;
+	/** allocator used for all memory allocated during parsing */
+	const jso_allocator *allocator;
+	/** buffer holding the pending input */
+	jso_ctype *buffer;
+	/** length of the pending input in the buffer */
+	size_t buffer_len;
+	/** size of the buffer */
+	size_t buffer_size;
+	/** bison push parser status */
+	int status;
+} jso_push_parser;
+
+/**
+ * @brief Reusable parser context.
+ *
+ * The context owns the parser and scanner state, the IO, the schema validation stack and
+ * optionally an arena. They are only reset between the documents so parsing of many small
+ * documents does not pay for their setup. The context must not be used by more threads at
+ * the same time but it is cheap to create so each worker thread can have its own context.
+ */
+typedef struct _jso_parser_ctx {
+	/** parser state */
+	jso_parser parser;
+	/** IO holding the currently parsed document */
+	jso_io io;
+	/** schema validation stream */
+	jso_schema_validation_stream schema_stream;
+	/** options with the owned arena */
+	jso_parser_options options;
+	/** allocator used for all memory allocated during parsing */
+	const jso_allocator *allocator;
+	/** arena owned by the context or NULL */
+	jso_arena *arena;
+} jso_parser_ctx;
+
 /**
  * Increase parsing depth.
  *
@@ -142,6 +264,24 @@ JSO_API void jso_parser_init(jso_parser *parser);
  */
 JSO_API int jso_yyparse(jso_parser *parser);
 
+/**
+ * Parse the scanner input using the structural index.
+ *
+ * @param parser parser instance
+ * @return @ref JSO_SUCCESS on success, otherwise @ref JSO_FAILURE if the input is not valid and
+ * it needs to be parsed by the default engine to get the error.
+ */
+JSO_API jso_rc jso_structural_parse(jso_parser *parser);
+
+/**
+ * Check the scanner input without creating the values.
+ *
+ * @param parser parser instance
+ * @return @ref JSO_SUCCESS on success, otherwise @ref JSO_FAILURE if the input is not valid and
+ * it needs to be parsed by the default engine to get the error.
+ */
+JSO_API jso_rc jso_validator_parse(jso_parser *parser);
+
 /**
  * Initialize parser options
  *
@@ -171,4 +311,105 @@ JSO_API jso_rc jso_parse_io(jso_io *io, const jso_parser_options *options, jso_v
 JSO_API jso_rc jso_parse_cstr(
 		const char *cstr, size_t len, const jso_parser_options *options, jso_value *result);
 
+/**
+ * Parse data from IO to a sparse tree containing only the values referenced by pointers.
+ *
+ * The containers on the pointer paths are created with only the members that lead to
+ * the referenced values and the skipped array elements before them are replaced with null so
+ * the result can be searched by @ref jso_pointer_resolve. The subtrees that are not on any path
+ * are skipped without tokenizing them and they are checked only for the nesting of brackets and
+ * the string boundaries.
+ *
+ * @param io IO to parse data from
+ * @param pointers compiled pointers
+ * @param pointers_count number of pointers
+ * @param options parser options (only max depth and allocator are used)
+ * @param result value holding the result
+ * @return @ref JSO_SUCCESS on success, otherwise @ref JSO_FAILURE.
+ */
+JSO_API jso_rc jso_parse_projection_io(jso_io *io, jso_pointer **pointers, size_t pointers_count,
+		const jso_parser_options *options, jso_value *result);
+
+/**
+ * Parse C string to a sparse tree containing only the values referenced by pointers.
+ *
+ * @param cstr C string holding the data to parse
+ * @param len C string length
+ * @param pointers compiled pointers
+ * @param pointers_count number of pointers
+ * @param options parser options (only max depth and allocator are used)
+ * @param result value holding the result
+ * @return @ref JSO_SUCCESS on success, otherwise @ref JSO_FAILURE.
+ */
+JSO_API jso_rc jso_parse_projection_cstr(const char *cstr, size_t len, jso_pointer **pointers,
+		size_t pointers_count, const jso_parser_options *options, jso_value *result);
+
+/**
+ * Create a new reusable parser context.
+ *
+ * @param options parser options that are used for all documents
+ * @param arena whether the context owns an arena for the memory of the parsed documents
+ * (it overrides the arena in options) - the document is then valid only until the next parse
+ * or the context is freed and it does not need to be freed
+ * @return New parser context or NULL if the allocation failed.
+ */
+JSO_API jso_parser_ctx *jso_parser_ctx_create(const jso_parser_options *options, jso_bool arena);
+
+/**
+ * Parse a document using the context.
+ *
+ * @param ctx parser context
+ * @param buf buffer holding the document terminated by NUL character at its length
+ * @param len document length
+ * @param result value holding the result
+ * @return @ref JSO_SUCCESS on success, otherwise @ref JSO_FAILURE.
+ */
+JSO_API jso_rc jso_parser_ctx_parse(
+		jso_parser_ctx *ctx, const char *buf, size_t len, jso_value *result);
+
+/**
+ * Free the parser context.
+ *
+ * @param ctx parser context
+ */
+JSO_API void jso_parser_ctx_free(jso_parser_ctx *ctx);
+
+/**
+ * Create a new push parser for the input received in chunks.
+ *
+ * @param options parser options
+ * @return New push parser or NULL if the allocation failed.
+ */
+JSO_API jso_push_parser *jso_push_parser_create(const jso_parser_options *options);
+
+/**
+ * Parse the next chunk of the input.
+ *
+ * The chunk does not need to be kept after the call. It can end anywhere including the middle
+ * of a string, number or literal.
+ *
+ * @param pp push parser
+ * @param buf chunk data
+ * @param len chunk length
+ * @return @ref JSO_SUCCESS if the input is valid so far, otherwise @ref JSO_FAILURE and the error
+ * is returned by @ref jso_push_parser_finish.
+ */
+JSO_API jso_rc jso_push_parser_feed(jso_push_parser *pp, const char *buf, size_t len);
+
+/**
+ * Finish parsing when there is no more input.
+ *
+ * @param pp push parser
+ * @param result value holding the result
+ * @return @ref JSO_SUCCESS on success, otherwise @ref JSO_FAILURE.
+ */
+JSO_API jso_rc jso_push_parser_finish(jso_push_parser *pp, jso_value *result);
+
+/**
+ * Free the push parser.
+ *
+ * @param pp push parser
+ */
+JSO_API void jso_push_parser_free(jso_push_parser *pp);
+
 #endif /* JSO_PARSER_H */
@@ -31,6 +31,10 @@
 
 #define YYDEBUG 0
 
+/* parser state and stack are allocated by the current allocator */
+#define YYMALLOC jso_malloc
+#define YYFREE jso_free
+
 #if YYDEBUG
 int jso_yydebug = 1;
 #endif
@@ -63,6 +67,7 @@ int jso_yydebug = 1;
 %token <value> JSO_T_ENOMEM
 %token <value> JSO_T_EOI
 %token <value> JSO_T_ERROR
+%token JSO_T_NEED_MORE
 
 %type <value> start object key value values array errlex
 %type <object> members member
@@ -76,7 +81,7 @@ int jso_yydebug = 1;
 
 %code {
 int jso_yylex(union YYSTYPE *value, YYLTYPE *location, jso_parser *parser);
-void jso_yyerror(YYLTYPE *location, jso_parser *parser, char const *msg);
+void yyerror(YYLTYPE *location, jso_parser *parser, char const *msg);
 
 #define JSO_PARSER_SET_LOC(_loc) \
 	JSO_ASSERT_EQ(sizeof(YYLTYPE), sizeof(jso_parser_location)); \
@@ -91,17 +96,21 @@ void jso_yyerror(YYLTYPE *location, jso_parser *parser, char const *msg);
 	JSO_PARSER_SET_ERROR(_etype, _loc); \
 	YYERROR
 
-#define JSO_PARSER_HOOK_CHECK(_name, _loc, _etype_exp) \
+#define JSO_PARSER_HOOK_CHECK_EX(_name, _loc, _etype_exp, _free) \
 	do { \
 		if (parser->hooks._name != NULL) { \
 			jso_error_type _etype = _etype_exp; \
 			if (_etype != JSO_ERROR_NONE) { \
+				_free; \
 				JSO_PARSER_SET_LOC(_loc); \
 				JSO_PARSER_ERROR(_etype); \
 			} \
 		} \
 	} while(0)
 
+#define JSO_PARSER_HOOK_CHECK(_name, _loc, _etype_exp) \
+	JSO_PARSER_HOOK_CHECK_EX(_name, _loc, _etype_exp, (void) 0)
+
 #define JSO_PARSER_DEPTH_DEC() jso_parser_depth_decrease(parser)
 #define JSO_PARSER_DEPTH_INC(_loc) \
 	jso_error_type _etype = jso_parser_depth_increase(parser); \
@@ -118,6 +127,18 @@ void jso_yyerror(YYLTYPE *location, jso_parser *parser, char const *msg);
 #define JSO_PARSER_HOOK_0(_name, _loc) \
 	JSO_PARSER_HOOK_CHECK(_name, _loc, parser->hooks._name(parser))
 
+/* the symbols of the rule are not destructed by YYERROR so they are freed by the hook error */
+#define JSO_PARSER_HOOK_FREE(_name, _loc, _free, ...) \
+	JSO_PARSER_HOOK_CHECK_EX(_name, _loc, parser->hooks._name(parser, __VA_ARGS__), _free)
+
+/* free the object and the pair that was not added to it */
+static void jso_parser_member_free(jso_object *object, jso_value *key, jso_value *val)
+{
+	jso_object_free(object);
+	jso_value_free(key);
+	jso_value_free(val);
+}
+
 }
 
 %% /* Rules */
@@ -162,11 +183,15 @@ member:
 		pair
 			{
 				JSO_PARSER_HOOK(object_create, @1, &$$);
-				JSO_PARSER_HOOK(object_update, @1, $$, JSO_STR($1.key), &$1.val);
+				JSO_PARSER_HOOK_FREE(object_update, @1,
+						jso_parser_member_free($$, &$1.key, &$1.val),
+						$$, JSO_STR($1.key), &$1.val);
 			}
 	|	member ',' pair
 			{
-				JSO_PARSER_HOOK(object_update, @3, $1, JSO_STR($3.key), &$3.val);
+				JSO_PARSER_HOOK_FREE(object_update, @3,
+						jso_parser_member_free($1, &$3.key, &$3.val),
+						$1, JSO_STR($3.key), &$3.val);
 				$$ = $1;
 			}
 	|	member errlex
@@ -271,6 +296,8 @@ errlex:
 
 %%
 
+/* the push parser is generated from the same grammar and its tokens are pushed by the caller */
+#if YYPULL
 JSO_API int jso_yylex(union YYSTYPE *value, YYLTYPE *location, jso_parser *parser)
 {
 	int token = jso_scan(&parser->scanner);
@@ -282,7 +309,9 @@ JSO_API int jso_yylex(union YYSTYPE *value, YYLTYPE *location, jso_parser *parse
 	return token;
 }
 
-void jso_yyerror(YYLTYPE *location, jso_parser *parser, char const *msg)
+#endif
+
+void yyerror(YYLTYPE *location, jso_parser *parser, char const *msg)
 {
 	JSO_PARSER_SET_ERROR(JSO_ERROR_SYNTAX, location);
 }
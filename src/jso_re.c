@@ -41,15 +41,48 @@ JSO_API void jso_re_code_free(jso_re_code *code)
 	}
 }
 
+/* pcre2 allocation callback using the allocator passed as memory data */
+static void *jso_re_malloc(PCRE2_SIZE size, void *data)
+{
+	return jso_allocator_malloc((const jso_allocator *) data, size);
+}
+
+/* pcre2 freeing callback using the allocator passed as memory data */
+static void jso_re_free(void *ptr, void *data)
+{
+	jso_allocator_free((const jso_allocator *) data, ptr);
+}
+
 JSO_API jso_rc jso_re_compile(jso_string *pattern, jso_re_code *code)
 {
-	pcre2_code *re = pcre2_compile((PCRE2_SPTR) JSO_STRING_VAL(pattern), PCRE2_ZERO_TERMINATED, 0,
-			&code->error_code, &code->error_offset, NULL);
+	/* compiled code keeps the memory functions so match data and freeing use them as well */
+	pcre2_general_context *gcontext = pcre2_general_context_create(
+			jso_re_malloc, jso_re_free, (void *) jso_mm_get_allocator());
+	if (gcontext == NULL) {
+		code->error_code = PCRE2_ERROR_NOMEMORY;
+		return JSO_FAILURE;
+	}
+	pcre2_compile_context *ccontext = pcre2_compile_context_create(gcontext);
+	if (ccontext == NULL) {
+		pcre2_general_context_free(gcontext);
+		code->error_code = PCRE2_ERROR_NOMEMORY;
+		return JSO_FAILURE;
+	}
+	pcre2_code *re = pcre2_compile((PCRE2_SPTR) JSO_STRING_VAL(pattern), JSO_STRING_LEN(pattern), 0,
+			&code->error_code, &code->error_offset, ccontext);
+	pcre2_compile_context_free(ccontext);
+	pcre2_general_context_free(gcontext);
 	if (re == NULL) {
 		return JSO_FAILURE;
 	}
+	/* JIT is optional and the interpreter is used if it is not available */
+	code->jit = pcre2_jit_compile(re, PCRE2_JIT_COMPLETE) == 0;
 	code->re = re;
 	code->pattern = jso_string_copy(pattern);
+	if (code->pattern == NULL) {
+		code->error_code = PCRE2_ERROR_NOMEMORY;
+		return JSO_FAILURE;
+	}
 	return JSO_SUCCESS;
 }
 
@@ -59,11 +92,31 @@ JSO_API char *jso_re_get_error_message(jso_re_code *code, jso_ctype *buf, size_t
 	return (char *) buf;
 }
 
+JSO_API char *jso_re_get_match_error_message(int match_result, jso_ctype *buf, size_t buf_size)
+{
+	pcre2_get_error_message(match_result, buf, buf_size);
+	return (char *) buf;
+}
+
 JSO_API jso_re_match_data *jso_re_match_data_create(jso_re_code *code)
 {
 	return pcre2_match_data_create_from_pattern(code->re, NULL);
 }
 
+JSO_API jso_re_match_data *jso_re_match_data_create_any(const jso_allocator *allocator)
+{
+	pcre2_general_context *gcontext
+			= pcre2_general_context_create(jso_re_malloc, jso_re_free, (void *) allocator);
+	if (gcontext == NULL) {
+		return NULL;
+	}
+	/* a single pair is enough for the whole match and pcre2 returns 0 for the captured groups */
+	jso_re_match_data *match_data = pcre2_match_data_create(1, gcontext);
+	pcre2_general_context_free(gcontext);
+
+	return match_data;
+}
+
 JSO_API void jso_re_match_data_free(jso_re_match_data *match_data)
 {
 	pcre2_match_data_free(match_data);
@@ -72,5 +125,15 @@ JSO_API void jso_re_match_data_free(jso_re_match_data *match_data)
 JSO_API int jso_re_match(
 		const char *subject, size_t subject_len, jso_re_code *code, jso_re_match_data *match_data)
 {
+	if (code->jit) {
+		int rc = pcre2_jit_match(
+				code->re, (PCRE2_SPTR) subject, subject_len, 0, 0, match_data, NULL);
+		if (rc != PCRE2_ERROR_JIT_STACKLIMIT) {
+			return rc;
+		}
+		/* the interpreter keeps its backtracking frames on the heap so it has a higher limit */
+		return pcre2_match(code->re, (PCRE2_SPTR) subject, subject_len, 0, PCRE2_NO_JIT,
+				match_data, NULL);
+	}
 	return pcre2_match(code->re, (PCRE2_SPTR) subject, subject_len, 0, 0, match_data, NULL);
 }
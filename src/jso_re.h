@@ -48,6 +48,8 @@ struct _jso_re_code {
 	int error_code;
 	/** error code offset */
 	PCRE2_SIZE error_offset;
+	/** whether the code is JIT compiled */
+	jso_bool jit;
 };
 
 /**
@@ -57,6 +59,11 @@ struct _jso_re_code {
  */
 #define JSO_RE_CODE_PATTERN(_code) _code->pattern
 
+/**
+ * Match result returned when the subject does not match.
+ */
+#define JSO_RE_ERROR_NOMATCH PCRE2_ERROR_NOMATCH
+
 /**
  * @brief Regular expression match data type.
  */
@@ -79,6 +86,9 @@ JSO_API void jso_re_code_free(jso_re_code *code);
 /**
  * Compile regular expression.
  *
+ * The code is also JIT compiled if JIT is supported. Otherwise the interpreter is used for
+ * matching.
+ *
  * @param pattern regular expression pattern
  * @param code result code
  * @return JSO_SUCCESS on success, otherwise @ref JSO_FAILURE.
@@ -116,6 +126,16 @@ static inline size_t jso_re_get_error_offset(jso_re_code *code)
  */
 JSO_API jso_re_match_data *jso_re_match_data_create(jso_re_code *code);
 
+/**
+ * Create match data that can be used with any code for checking whether the subject matches.
+ *
+ * The match data holds only the whole match so it is not usable for getting the captured groups.
+ *
+ * @param allocator allocator of the match data
+ * @return Created match data or NULL if error.
+ */
+JSO_API jso_re_match_data *jso_re_match_data_create_any(const jso_allocator *allocator);
+
 /**
  * Free match data.
  *
@@ -123,14 +143,28 @@ JSO_API jso_re_match_data *jso_re_match_data_create(jso_re_code *code);
  */
 JSO_API void jso_re_match_data_free(jso_re_match_data *match_data);
 
+/**
+ * @brief Get match error message
+ *
+ * @param match_result negative result of @ref jso_re_match
+ * @param buf buffer
+ * @param buf_size buffer size
+ * @return The buffer casted to char.
+ */
+JSO_API char *jso_re_get_match_error_message(int match_result, jso_ctype *buf, size_t buf_size);
+
 /**
  * Match regular expression.
  *
+ * The JIT matching is retried by the interpreter if the subject exceeds the JIT stack limit.
+ *
  * @param subject subject to match
  * @param subject_len subject to match length
  * @param code regular expression code
  * @param match_data match data
- * @return Result of type @ref jso_re_match_result.
+ * @return Number of the set match data pairs (0 if the match data is too small for the captured
+ * groups) on success, otherwise a negative error code (@ref JSO_RE_ERROR_NOMATCH if the subject
+ * does not match).
  */
 JSO_API int jso_re_match(
 		const char *subject, size_t subject_len, jso_re_code *code, jso_re_match_data *match_data);
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/**
+ * @file jso_ryu_dtoa.h
+ * @brief Header for Ryu shortest double to decimal conversion
+ */
+
+#ifndef JSO_RYU_DTOA_H
+#define JSO_RYU_DTOA_H
+
+#include "jso_types.h"
+
+/**
+ * Maximal number of digits of the shortest representation.
+ */
+#define JSO_RYU_DTOA_MAX_DIGITS 17
+
+/**
+ * Convert double to the shortest decimal digits that round trip.
+ *
+ * If there are more shortest representations, the closest one to the exact value is used which
+ * gives the same digits as @ref jso_dg_dtoa in mode 0. The digits are not terminated.
+ *
+ * @param val finite value to convert (the sign is ignored)
+ * @param digits buffer for at least @ref JSO_RYU_DTOA_MAX_DIGITS digits
+ * @param decpt pointer where the decimal point position relative to the first digit is saved
+ * @return Number of the saved digits.
+ * @note This is an internal function that is not exported.
+ */
+int jso_ryu_dtoa(double val, char *digits, int *decpt);
+
+#endif /* JSO_RYU_DTOA_H */
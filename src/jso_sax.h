@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/**
+ * @file jso_sax.h
+ * @brief SAX style parser
+ */
+
+#ifndef JSO_SAX_H
+#define JSO_SAX_H
+
+#include "jso_types.h"
+#include "jso_parser.h"
+
+/**
+ * @brief Action returned from the SAX callbacks.
+ */
+typedef enum {
+	/** continue parsing */
+	JSO_SAX_CONTINUE,
+	/**
+	 * Skip the subtree. The container is skipped without any further callbacks if it is
+	 * returned from the container start callback. The following value is skipped if it is
+	 * returned from the object key callback. It is the same as continue for other callbacks.
+	 */
+	JSO_SAX_SKIP,
+	/** stop parsing and return the abort error */
+	JSO_SAX_ABORT
+} jso_sax_action;
+
+typedef jso_sax_action (*jso_sax_callback_t)(void *ctx);
+typedef jso_sax_action (*jso_sax_callback_bool_t)(void *ctx, jso_bool bval);
+typedef jso_sax_action (*jso_sax_callback_int_t)(void *ctx, jso_int ival);
+typedef jso_sax_action (*jso_sax_callback_double_t)(void *ctx, jso_double dval);
+typedef jso_sax_action (*jso_sax_callback_string_t)(void *ctx, const jso_ctype *str, size_t len);
+
+/**
+ * @brief SAX callbacks.
+ *
+ * All callbacks are optional and the missing ones are the same as returning
+ * @ref JSO_SAX_CONTINUE. The string and key callbacks receive a borrowed view that is
+ * not NUL terminated and that is valid only until the callback returns.
+ */
+typedef struct _jso_sax_callbacks {
+	jso_sax_callback_t object_start;
+	jso_sax_callback_string_t object_key;
+	jso_sax_callback_t object_end;
+	jso_sax_callback_t array_start;
+	jso_sax_callback_t array_end;
+	jso_sax_callback_t null_value;
+	jso_sax_callback_bool_t bool_value;
+	jso_sax_callback_int_t int_value;
+	jso_sax_callback_double_t double_value;
+	jso_sax_callback_string_t string_value;
+} jso_sax_callbacks;
+
+/**
+ * Parse data from IO and deliver the events to callbacks.
+ *
+ * No value is allocated during parsing. The skipped subtrees are checked only for the nesting
+ * of brackets and the string boundaries.
+ *
+ * @param io IO to parse data from
+ * @param callbacks callbacks receiving the events
+ * @param ctx context passed to callbacks
+ * @param options parser options (only max depth and allocator are used)
+ * @param error value set to error on failure
+ * @return @ref JSO_SUCCESS on success, otherwise @ref JSO_FAILURE.
+ */
+JSO_API jso_rc jso_sax_parse_io(jso_io *io, const jso_sax_callbacks *callbacks, void *ctx,
+		const jso_parser_options *options, jso_value *error);
+
+/**
+ * Parse C string and deliver the events to callbacks.
+ *
+ * @param cstr C string holding the data to parse
+ * @param len C string length
+ * @param callbacks callbacks receiving the events
+ * @param ctx context passed to callbacks
+ * @param options parser options (only max depth and allocator are used)
+ * @param error value set to error on failure
+ * @return @ref JSO_SUCCESS on success, otherwise @ref JSO_FAILURE.
+ */
+JSO_API jso_rc jso_sax_parse_cstr(const char *cstr, size_t len,
+		const jso_sax_callbacks *callbacks, void *ctx, const jso_parser_options *options,
+		jso_value *error);
+
+#endif /* JSO_SAX_H */
@@ -32,6 +32,11 @@
 #include "jso.h"
 #include "jso_io.h"
 
+/**
+ * @brief Number of 64-bit words of the containers stack stored directly in the scanner.
+ */
+#define JSO_SCANNER_CONTAINERS_BUF_SIZE 4
+
 /**
  * @brief Scanner data and state.
  *
@@ -43,6 +48,35 @@ typedef struct _jso_scanner {
 	jso_ctype *pstr;
 	int state;
 	jso_error_location loc;
+	jso_arena *arena;
+	/** whether more input can follow the end of the buffer */
+	jso_bool partial;
+	/** whether escape free string values reference the input instead of copying it */
+	jso_bool borrow_strings;
+	/** whether strings are borrowed from the input or the view buffer instead of allocated */
+	jso_bool borrow;
+	/** last borrowed string */
+	const jso_ctype *view;
+	/** length of the last borrowed string */
+	size_t view_len;
+	/** buffer for the borrowed strings with escapes */
+	jso_ctype *view_buf;
+	/** size of the view buffer */
+	size_t view_buf_size;
+	/** whether the tokens are only checked and the string and number values are not created */
+	jso_bool validate;
+	/** whether the currently scanned string is an object key */
+	jso_bool key;
+	/** hash of the currently scanned key */
+	jso_uint32 hash;
+	/** number of open containers */
+	size_t depth;
+	/** capacity of the containers stack in bits */
+	size_t containers_capacity;
+	/** bit stack of open containers where set bit means object */
+	jso_uint64 *containers;
+	/** initial containers stack storage */
+	jso_uint64 containers_buf[JSO_SCANNER_CONTAINERS_BUF_SIZE];
 } jso_scanner;
 
 /**
@@ -50,6 +84,21 @@ typedef struct _jso_scanner {
  */
 #define JSO_SCANNER_LOCATION(scanner, slocation) (scanner).loc.slocation
 
+/**
+ * @brief Check whether the innermost open container is an object.
+ *
+ * @param s Scanner instance.
+ * @return @ref JSO_TRUE if the container is an object, otherwise @ref JSO_FALSE.
+ */
+static inline jso_bool jso_scanner_in_object(jso_scanner *s)
+{
+	if (s->depth == 0) {
+		return JSO_FALSE;
+	}
+	size_t pos = s->depth - 1;
+	return (s->containers[pos / 64] >> (pos % 64)) & 1;
+}
+
 /**
  * @brief Initialize scanner.
  *
@@ -58,9 +107,64 @@ typedef struct _jso_scanner {
  */
 void jso_scanner_init(jso_scanner *scanner, jso_io *io);
 
+/**
+ * @brief Free scanner resources.
+ *
+ * @param scanner Scanner instance.
+ */
+void jso_scanner_clear(jso_scanner *scanner);
+
+/**
+ * @brief Reset scanner for the next input from the IO cursor.
+ *
+ * The options and the allocated buffers are kept so the scanner can be reused without
+ * allocating them again.
+ *
+ * @param scanner Scanner instance.
+ */
+void jso_scanner_reset(jso_scanner *scanner);
+
+/**
+ * @brief Get start of the input that is still needed by the scanner.
+ *
+ * This is the start of the token that was interrupted by the end of the partial input. It can
+ * be also start of the unfinished string as the string is copied when its end is found.
+ *
+ * @param scanner Scanner instance.
+ * @return Pointer to the first pending character.
+ */
+jso_ctype *jso_scanner_get_pending(jso_scanner *scanner);
+
+/**
+ * @brief Move the pending input to a new location.
+ *
+ * The caller must copy the pending input (from the start returned by
+ * @ref jso_scanner_get_pending to the limit) to the new location and set the new limit.
+ *
+ * @param scanner Scanner instance.
+ * @param start New start of the pending input.
+ */
+void jso_scanner_move_pending(jso_scanner *scanner, jso_ctype *start);
+
+/**
+ * @brief Skip the rest of the open container.
+ *
+ * This is called after the container start token and it moves the cursor after the matching
+ * container end without creating any token. The skipped content is checked only for the nesting
+ * of brackets and the string boundaries.
+ *
+ * @param s Scanner instance.
+ * @return The container end token or @ref JSO_T_EOI if the input ended.
+ */
+int jso_scanner_skip(jso_scanner *s);
+
 /**
  * @brief Run scanner.
  *
+ * If the scanner input is partial, the @ref JSO_T_NEED_MORE token is returned when the input end
+ * is reached in the middle of a token. The scanning then continues from the token start on the
+ * next call.
+ *
  * @param s Scanner instance.
  * @return int Token ID.
  */
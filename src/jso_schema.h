@@ -31,6 +31,7 @@
 
 #include "jso_types.h"
 #include "jso_ht.h"
+#include "jso_re.h"
 #include "jso_virt.h"
 
 /**
@@ -573,6 +574,11 @@ typedef struct _jso_schema_value_array {
 	jso_schema_keyword contains;
 } jso_schema_value_array;
 
+/**
+ * @brief JsonSchema combined matcher of the pattern properties.
+ */
+typedef struct _jso_schema_pattern_set jso_schema_pattern_set;
+
 /**
  * @brief JsonSchema array validation keywords.
  * @todo support pattern_properties and dependencies
@@ -595,6 +601,8 @@ typedef struct _jso_schema_value_object {
 	jso_schema_keyword dependencies;
 	/** propertyNames keyword */
 	jso_schema_keyword property_names;
+	/** pattern properties compiled to a single matcher */
+	jso_schema_pattern_set *pattern_set;
 } jso_schema_value_object;
 
 /**
@@ -665,6 +673,11 @@ typedef union _jso_schema_value_data {
  */
 #define JSO_SCHEMA_VALUE_FLAG_OBJECT_TRUE 0x04
 
+/**
+ * @brief JsonSchema validation program of a value.
+ */
+typedef struct _jso_schema_program jso_schema_program;
+
 /**
  * @brief JsonSchema value data and type.
  */
@@ -679,6 +692,8 @@ struct _jso_schema_value {
 	jso_schema_uri base_uri;
 	/* reference */
 	jso_schema_reference *ref;
+	/** compiled validation program or NULL if the value keywords are interpreted */
+	jso_schema_program *program;
 };
 
 /**
@@ -933,6 +948,18 @@ typedef enum _jso_schema_version {
 typedef struct _jso_schema_options {
 	/** version to use if $schema is not present */
 	jso_schema_version default_version;
+	/** allocator for the schema values and validation or NULL to use the current allocator */
+	const jso_allocator *allocator;
+	/**
+	 * Whether the validation errors record only their code without the operands and the instance
+	 * path. It is meant for checks that need just the validation result.
+	 */
+	jso_bool skip_error_detail;
+	/**
+	 * Whether the schema values are not compiled to the validation programs so the validation
+	 * interprets the keywords directly.
+	 */
+	jso_bool skip_compile;
 } jso_schema_options;
 
 /**
@@ -960,6 +987,7 @@ typedef enum _jso_schema_error_type {
 	JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
 	JSO_SCHEMA_ERROR_VALIDATION_TYPE,
 	JSO_SCHEMA_ERROR_VALIDATION_FALSE,
+	JSO_SCHEMA_ERROR_VALIDATION_PATTERN,
 	JSO_SCHEMA_ERROR_VALUE_ALLOC,
 	JSO_SCHEMA_ERROR_VALUE_DATA_ALLOC,
 	JSO_SCHEMA_ERROR_VALUE_DATA_DEPS,
@@ -967,14 +995,129 @@ typedef enum _jso_schema_error_type {
 	JSO_SCHEMA_ERROR_VERSION,
 } jso_schema_error_type;
 
+/**
+ * @brief Code of the failed validation check.
+ */
+typedef enum _jso_schema_error_code {
+	/** the error is not a validation check error and its message is set directly */
+	JSO_SCHEMA_ERROR_CODE_NONE = 0,
+	JSO_SCHEMA_ERROR_CODE_TYPE,
+	JSO_SCHEMA_ERROR_CODE_TYPE_ALTERNATIVE,
+	JSO_SCHEMA_ERROR_CODE_TYPE_LIST,
+	JSO_SCHEMA_ERROR_CODE_TYPE_SCHEMA,
+	JSO_SCHEMA_ERROR_CODE_TYPE_INTEGER_FRACTION,
+	JSO_SCHEMA_ERROR_CODE_FALSE,
+	JSO_SCHEMA_ERROR_CODE_ENUM,
+	JSO_SCHEMA_ERROR_CODE_CONST,
+	JSO_SCHEMA_ERROR_CODE_ANY_OF,
+	JSO_SCHEMA_ERROR_CODE_ONE_OF,
+	JSO_SCHEMA_ERROR_CODE_ONE_OF_MORE,
+	JSO_SCHEMA_ERROR_CODE_NOT,
+	JSO_SCHEMA_ERROR_CODE_MINIMUM,
+	JSO_SCHEMA_ERROR_CODE_MAXIMUM,
+	JSO_SCHEMA_ERROR_CODE_EXCLUSIVE_MINIMUM,
+	JSO_SCHEMA_ERROR_CODE_EXCLUSIVE_MAXIMUM,
+	JSO_SCHEMA_ERROR_CODE_EXCLUSIVE_MINIMUM_EQUAL,
+	JSO_SCHEMA_ERROR_CODE_EXCLUSIVE_MAXIMUM_EQUAL,
+	JSO_SCHEMA_ERROR_CODE_MULTIPLE_OF,
+	JSO_SCHEMA_ERROR_CODE_MIN_LENGTH,
+	JSO_SCHEMA_ERROR_CODE_MAX_LENGTH,
+	JSO_SCHEMA_ERROR_CODE_PATTERN,
+	JSO_SCHEMA_ERROR_CODE_MIN_ITEMS,
+	JSO_SCHEMA_ERROR_CODE_MAX_ITEMS,
+	JSO_SCHEMA_ERROR_CODE_ADDITIONAL_ITEMS,
+	JSO_SCHEMA_ERROR_CODE_UNIQUE_ITEMS,
+	JSO_SCHEMA_ERROR_CODE_CONTAINS,
+	JSO_SCHEMA_ERROR_CODE_MIN_PROPERTIES,
+	JSO_SCHEMA_ERROR_CODE_MAX_PROPERTIES,
+	JSO_SCHEMA_ERROR_CODE_REQUIRED,
+	JSO_SCHEMA_ERROR_CODE_PROPERTY_NAMES,
+	JSO_SCHEMA_ERROR_CODE_ADDITIONAL_PROPERTIES,
+	JSO_SCHEMA_ERROR_CODE_DEPENDENCIES,
+	/** number of codes */
+	JSO_SCHEMA_ERROR_CODE_COUNT,
+} jso_schema_error_code;
+
+/**
+ * @brief Type of the validation error operand.
+ */
+typedef enum _jso_schema_error_operand_type {
+	JSO_SCHEMA_ERROR_OPERAND_NONE = 0,
+	JSO_SCHEMA_ERROR_OPERAND_INT,
+	JSO_SCHEMA_ERROR_OPERAND_UINT,
+	JSO_SCHEMA_ERROR_OPERAND_NUMBER,
+	/** C string that is not freed before the error (e.g. a string literal) */
+	JSO_SCHEMA_ERROR_OPERAND_CSTR,
+	/** string that is copied to the error strings buffer */
+	JSO_SCHEMA_ERROR_OPERAND_STRING,
+} jso_schema_error_operand_type;
+
+/**
+ * @brief Raw operand of the validation error that is formatted only when the message is needed.
+ */
+typedef struct _jso_schema_error_operand {
+	/** operand type */
+	jso_schema_error_operand_type type;
+	/** operand data */
+	union {
+		jso_int ival;
+		jso_uint uval;
+		jso_number num;
+		const char *cstr;
+		struct {
+			/** string value that is set only before it is copied to the error */
+			const char *val;
+			/** offset of the copied string in the error strings buffer */
+			size_t offset;
+			/** string length */
+			size_t len;
+		} str;
+	} data;
+} jso_schema_error_operand;
+
+/** @brief Maximal number of the validation error operands. */
+#define JSO_SCHEMA_ERROR_OPERANDS_SIZE 3
+
+/** @brief Size of the buffer for the validation error string operands. */
+#define JSO_SCHEMA_ERROR_STRINGS_SIZE 256
+
+/** @brief Size of the buffer for the validation error instance path. */
+#define JSO_SCHEMA_ERROR_PATH_SIZE 256
+
 /**
  * @brief JsonSchema error.
+ *
+ * The validation errors are recorded as the code of the failed check with its raw operands and
+ * the message is rendered only when it is requested by @ref jso_schema_error_message so the
+ * errors discarded during the composition validation are never formatted.
  */
 struct _jso_schema_error {
-	/** error message */
+	/** error message or buffer of the last rendered message */
 	char *message;
 	/** error type */
 	jso_schema_error_type type;
+	/** allocator of the error message */
+	const jso_allocator *allocator;
+	/** code of the failed validation check */
+	jso_schema_error_code code;
+	/** whether the message is rendered for the current validation error */
+	jso_bool rendered;
+	/** schema value of the failed check that is valid only while the schema exists */
+	jso_schema_value *value;
+	/** depth of the validated instance */
+	jso_uint32 depth;
+	/** number of the recorded operands (0 if the detail is skipped) */
+	size_t operands_count;
+	/** raw operands of the failed check */
+	jso_schema_error_operand operands[JSO_SCHEMA_ERROR_OPERANDS_SIZE];
+	/** used size of the strings buffer */
+	size_t strings_len;
+	/** copied string operands so the message can be rendered after the instance is freed */
+	char strings[JSO_SCHEMA_ERROR_STRINGS_SIZE];
+	/** length of the instance path */
+	size_t path_len;
+	/** JSON pointer of the failed instance (truncated from the start with "..." if too long) */
+	char path[JSO_SCHEMA_ERROR_PATH_SIZE + 1];
 };
 
 /**
@@ -991,6 +1134,12 @@ struct _jso_schema {
 	jso_schema_version version;
 	/** schema error */
 	jso_schema_error error;
+	/** allocator used for schema values and validation */
+	const jso_allocator *allocator;
+	/** whether the validation errors record only their code without the operands and path */
+	jso_bool skip_error_detail;
+	/** whether the parsed values are compiled to the validation programs */
+	jso_bool compile;
 };
 
 /**
@@ -1010,9 +1159,25 @@ struct _jso_schema {
 /**
  * Get JsonSchema error message.
  *
+ * The validation error message is rendered on the first use.
+ *
+ * @param _schema shema of type @ref jso_schema
+ */
+#define JSO_SCHEMA_ERROR_MESSAGE(_schema) jso_schema_error_message(JSO_SCHEMA_ERROR(_schema))
+
+/**
+ * Get JsonSchema error instance path.
+ *
+ * @param _schema shema of type @ref jso_schema
+ */
+#define JSO_SCHEMA_ERROR_PATH(_schema) jso_schema_error_path(JSO_SCHEMA_ERROR(_schema))
+
+/**
+ * Get JsonSchema error code.
+ *
  * @param _schema shema of type @ref jso_schema
  */
-#define JSO_SCHEMA_ERROR_MESSAGE(_schema) (_schema)->error.message
+#define JSO_SCHEMA_ERROR_CODE(_schema) (_schema)->error.code
 
 /**
  * Check if schema error is set.
@@ -1076,6 +1241,34 @@ static inline void jso_schema_reset_error(jso_schema *schema)
  */
 JSO_API jso_schema_error *jso_schema_move_error(jso_schema *schema);
 
+/**
+ * Get schema error message.
+ *
+ * The message of the validation error is rendered from its code and operands when it is
+ * requested for the first time.
+ *
+ * @param error schema error
+ * @return The error message or NULL if the error is not set.
+ */
+JSO_API const char *jso_schema_error_message(jso_schema_error *error);
+
+/**
+ * Get JSON pointer of the instance location where the validation failed.
+ *
+ * @param error schema error
+ * @return The instance path that is empty for the root instance or if the error is not a validation
+ * error or its detail is skipped.
+ */
+JSO_API const char *jso_schema_error_path(jso_schema_error *error);
+
+/**
+ * Get name of the keyword that is checked by the validation error code.
+ *
+ * @param code validation error code
+ * @return The keyword name or NULL if the code does not belong to any keyword.
+ */
+JSO_API const char *jso_schema_error_code_keyword(jso_schema_error_code code);
+
 /**
  * Clear schema error.
  *
@@ -1277,6 +1470,11 @@ struct _jso_schema_validation_position {
 	jso_uint32 depth;
 };
 
+/**
+ * @brief JsonSchema memo of the pattern properties matches.
+ */
+typedef struct _jso_schema_pattern_memo jso_schema_pattern_memo;
+
 /**
  * @brief JsonSchema validation stack.
  */
@@ -1295,6 +1493,10 @@ typedef struct _jso_schema_validation_stack {
 	size_t size;
 	/** marked position in the stack - used for clearing not needed postions */
 	size_t mark;
+	/** match data reused by all regular expression matches of the stack */
+	jso_re_match_data *match_data;
+	/** memoized pattern properties matches of the keys */
+	jso_schema_pattern_memo *pattern_memo;
 } jso_schema_validation_stack;
 
 /**
@@ -1315,6 +1517,8 @@ JSO_API jso_rc jso_schema_validation_stream_init(
 
 JSO_API void jso_schema_validation_stream_clear(jso_schema_validation_stream *stream);
 
+JSO_API jso_rc jso_schema_validation_stream_reset(jso_schema_validation_stream *stream);
+
 JSO_API jso_rc jso_schema_validation_stream_object_start(jso_schema_validation_stream *stream);
 
 JSO_API jso_rc jso_schema_validation_stream_object_key(
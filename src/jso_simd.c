@@ -0,0 +1,945 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "jso.h"
+#include "jso_simd.h"
+
+#include <stdatomic.h>
+#include <string.h>
+
+#if !defined(JSO_SIMD_DISABLED) && defined(__x86_64__) && defined(__GNUC__)
+#define JSO_SIMD_X86_64 1
+#include <immintrin.h>
+#elif !defined(JSO_SIMD_DISABLED) && defined(__aarch64__) && defined(__ARM_NEON)
+#define JSO_SIMD_AARCH64 1
+#include <arm_neon.h>
+#endif
+
+typedef size_t (*jso_simd_string_span_func)(const jso_ctype *str, size_t len);
+typedef jso_uint64 (*jso_simd_structural_block_func)(
+		jso_simd_structural_state *state, const jso_ctype *block);
+
+/* implementation of all helpers for a single level */
+typedef struct _jso_simd_impl {
+	jso_simd_level level;
+	jso_simd_string_span_func string_span;
+	jso_simd_string_span_func string_span_utf8;
+	jso_simd_string_span_func escape_span;
+	jso_simd_structural_block_func structural_block;
+} jso_simd_impl;
+
+/* masks of the character classes in the block where bit n is set for character n */
+typedef struct _jso_simd_block_masks {
+	jso_uint64 quote;
+	jso_uint64 backslash;
+	jso_uint64 whitespace;
+	/** brackets, colon and comma */
+	jso_uint64 op;
+} jso_simd_block_masks;
+
+/* check whether the character is plain string character */
+static inline jso_bool jso_simd_is_plain(jso_ctype c)
+{
+	return c >= 0x20 && c < 0x80 && c != '"' && c != '\\';
+}
+
+static size_t jso_simd_string_span_scalar(const jso_ctype *str, size_t len)
+{
+	size_t pos = 0;
+	while (pos < len && jso_simd_is_plain(str[pos])) {
+		++pos;
+	}
+	return pos;
+}
+
+/* check whether the character needs to be escaped by encoder */
+static inline jso_bool jso_simd_is_escaped(jso_ctype c)
+{
+	return c < 0x20 || c == '"' || c == '\\' || c == '/';
+}
+
+static size_t jso_simd_escape_span_scalar(const jso_ctype *str, size_t len)
+{
+	size_t pos = 0;
+	while (pos < len && !jso_simd_is_escaped(str[pos])) {
+		++pos;
+	}
+	return pos;
+}
+
+/* get length of the valid UTF-8 multi-byte character or 0 if it is invalid or incomplete */
+static inline size_t jso_simd_utf8_char_length(const jso_ctype *str, size_t len)
+{
+	jso_ctype c = str[0], min = 0x80, max = 0xBF;
+	size_t clen;
+
+	if (c < 0xC2) {
+		return 0;
+	} else if (c < 0xE0) {
+		clen = 2;
+	} else if (c < 0xF0) {
+		clen = 3;
+		if (c == 0xE0) {
+			min = 0xA0; /* overlong */
+		} else if (c == 0xED) {
+			max = 0x9F; /* surrogate */
+		}
+	} else if (c < 0xF5) {
+		clen = 4;
+		if (c == 0xF0) {
+			min = 0x90; /* overlong */
+		} else if (c == 0xF4) {
+			max = 0x8F; /* above U+10FFFF */
+		}
+	} else {
+		return 0;
+	}
+	if (len < clen || str[1] < min || str[1] > max) {
+		return 0;
+	}
+	for (size_t i = 2; i < clen; i++) {
+		if ((str[i] & 0xC0) != 0x80) {
+			return 0;
+		}
+	}
+	return clen;
+}
+
+/* validate UTF-8 characters one by one and use plain span for ASCII runs */
+static inline size_t jso_simd_string_span_utf8_generic(
+		const jso_ctype *str, size_t len, jso_simd_string_span_func plain_span)
+{
+	size_t pos = 0;
+	while (pos < len) {
+		if (str[pos] < 0x80) {
+			pos += plain_span(str + pos, len - pos);
+			if (pos == len || str[pos] < 0x80) {
+				break;
+			}
+		}
+		size_t clen = jso_simd_utf8_char_length(str + pos, len - pos);
+		if (clen == 0) {
+			break;
+		}
+		pos += clen;
+	}
+	return pos;
+}
+
+/* get start of the last character before pos so its validity is left for the caller */
+static inline size_t jso_simd_utf8_char_start(const jso_ctype *str, size_t pos)
+{
+	size_t start = pos;
+	while (start > 0 && pos - start < 3 && (str[start - 1] & 0xC0) == 0x80) {
+		--start;
+	}
+	if (start > 0 && str[start - 1] >= 0xC0) {
+		--start;
+	}
+	return start;
+}
+
+static size_t jso_simd_string_span_utf8_scalar(const jso_ctype *str, size_t len)
+{
+	return jso_simd_string_span_utf8_generic(str, len, jso_simd_string_span_scalar);
+}
+
+#define JSO_SIMD_SWAR_ONES 0x0101010101010101ULL
+#define JSO_SIMD_SWAR_HIGHS 0x8080808080808080ULL
+#define JSO_SIMD_SWAR_REPEAT(c) (JSO_SIMD_SWAR_ONES * (jso_uint64) (c))
+
+/* get high bits of the bytes that are less than n (exact for the first such byte) */
+#define JSO_SIMD_SWAR_LESS(x, n) (((x) - JSO_SIMD_SWAR_REPEAT(n)) & ~(x) & JSO_SIMD_SWAR_HIGHS)
+
+static size_t jso_simd_string_span_swar(const jso_ctype *str, size_t len)
+{
+	size_t pos = 0;
+	for (; pos + sizeof(jso_uint64) <= len; pos += sizeof(jso_uint64)) {
+		jso_uint64 word;
+		memcpy(&word, str + pos, sizeof(jso_uint64));
+		jso_uint64 quote = word ^ JSO_SIMD_SWAR_REPEAT('"');
+		jso_uint64 backslash = word ^ JSO_SIMD_SWAR_REPEAT('\\');
+		jso_uint64 special = JSO_SIMD_SWAR_LESS(word, 0x20) | JSO_SIMD_SWAR_LESS(quote, 1)
+				| JSO_SIMD_SWAR_LESS(backslash, 1) | (word & JSO_SIMD_SWAR_HIGHS);
+		if (special) {
+			/* the byte position in word depends on endianness so it is found by scalar loop */
+			break;
+		}
+	}
+	return pos + jso_simd_string_span_scalar(str + pos, len - pos);
+}
+
+static size_t jso_simd_string_span_utf8_swar(const jso_ctype *str, size_t len)
+{
+	return jso_simd_string_span_utf8_generic(str, len, jso_simd_string_span_swar);
+}
+
+static size_t jso_simd_escape_span_swar(const jso_ctype *str, size_t len)
+{
+	size_t pos = 0;
+	for (; pos + sizeof(jso_uint64) <= len; pos += sizeof(jso_uint64)) {
+		jso_uint64 word;
+		memcpy(&word, str + pos, sizeof(jso_uint64));
+		jso_uint64 quote = word ^ JSO_SIMD_SWAR_REPEAT('"');
+		jso_uint64 backslash = word ^ JSO_SIMD_SWAR_REPEAT('\\');
+		jso_uint64 slash = word ^ JSO_SIMD_SWAR_REPEAT('/');
+		jso_uint64 special = JSO_SIMD_SWAR_LESS(word, 0x20) | JSO_SIMD_SWAR_LESS(quote, 1)
+				| JSO_SIMD_SWAR_LESS(backslash, 1) | JSO_SIMD_SWAR_LESS(slash, 1);
+		if (special) {
+			break;
+		}
+	}
+	return pos + jso_simd_escape_span_scalar(str + pos, len - pos);
+}
+
+#define JSO_SIMD_ODD_BITS 0xAAAAAAAAAAAAAAAAULL
+
+/*
+ * Get the characters escaped by backslash. The backslashes that can start an escape are
+ * subtracted from their shifted mask with the odd bits set so the borrow runs through the whole
+ * backslash series and it leaves the series end bit set only when the series has odd length
+ * (this is the escape scanning from simdjson).
+ */
+static inline jso_uint64 jso_simd_escaped(jso_simd_structural_state *state, jso_uint64 backslash)
+{
+	jso_uint64 escaped;
+
+	if (!backslash) {
+		escaped = state->escaped;
+		state->escaped = 0;
+		return escaped;
+	}
+
+	jso_uint64 potential = backslash & ~state->escaped;
+	jso_uint64 codes = (((potential << 1) | JSO_SIMD_ODD_BITS) - potential) ^ JSO_SIMD_ODD_BITS;
+	escaped = codes ^ (backslash | state->escaped);
+	state->escaped = (codes & backslash) >> 63;
+
+	return escaped;
+}
+
+/* get mask where bit n is xor of the bits 0 to n (it is the carry-less multiply by all ones) */
+static inline jso_uint64 jso_simd_prefix_xor(jso_uint64 mask)
+{
+	mask ^= mask << 1;
+	mask ^= mask << 2;
+	mask ^= mask << 4;
+	mask ^= mask << 8;
+	mask ^= mask << 16;
+	mask ^= mask << 32;
+	return mask;
+}
+
+/* find the structural characters from the block character classes */
+static inline jso_uint64 jso_simd_structural_generic(jso_simd_structural_state *state,
+		const jso_simd_block_masks *masks, jso_uint64 (*prefix_xor)(jso_uint64))
+{
+	jso_uint64 quote = masks->quote & ~jso_simd_escaped(state, masks->backslash);
+
+	/* the string mask contains the opening quote and the string content */
+	jso_uint64 in_string = prefix_xor(quote) ^ state->in_string;
+	state->in_string = 0 - (in_string >> 63);
+
+	/* the scalar starts after whitespace, operator or the closing quote */
+	jso_uint64 scalar = ~(masks->op | masks->whitespace);
+	jso_uint64 nonquote_scalar = scalar & ~quote;
+	jso_uint64 follows_scalar = (nonquote_scalar << 1) | state->scalar;
+	state->scalar = nonquote_scalar >> 63;
+
+	/* nothing in the string after the opening quote is structural */
+	return (masks->op | (scalar & ~follows_scalar)) & ~(in_string ^ quote);
+}
+
+/* classify the characters of the block one by one */
+static inline void jso_simd_classify_scalar(const jso_ctype *block, jso_simd_block_masks *masks)
+{
+	memset(masks, 0, sizeof(jso_simd_block_masks));
+	for (size_t i = 0; i < JSO_SIMD_BLOCK_SIZE; i++) {
+		jso_uint64 bit = (jso_uint64) 1 << i;
+		switch (block[i]) {
+			case '"':
+				masks->quote |= bit;
+				break;
+			case '\\':
+				masks->backslash |= bit;
+				break;
+			case ' ':
+			case '\t':
+			case '\n':
+			case '\r':
+				masks->whitespace |= bit;
+				break;
+			case '{':
+			case '}':
+			case '[':
+			case ']':
+			case ':':
+			case ',':
+				masks->op |= bit;
+				break;
+		}
+	}
+}
+
+/* the bit position depends on endianness for SWAR so the scalar version is used for both */
+static jso_uint64 jso_simd_structural_block_scalar(
+		jso_simd_structural_state *state, const jso_ctype *block)
+{
+	jso_simd_block_masks masks;
+	jso_simd_classify_scalar(block, &masks);
+	return jso_simd_structural_generic(state, &masks, jso_simd_prefix_xor);
+}
+
+#if defined(JSO_SIMD_X86_64) || defined(JSO_SIMD_AARCH64)
+
+/*
+ * UTF-8 validation using the lookup algorithm from Keiser and Lemire (Validating UTF-8 In Less
+ * Than One Instruction Per Byte). The error classes are found by looking up high and low nibble
+ * of the previous byte and high nibble of the current byte in 16 entries tables. The result is
+ * zero for all valid two bytes sequences except the second continuation that must be checked
+ * separately against the third and fourth byte of the previous lead bytes.
+ */
+#define JSO_SIMD_UTF8_TOO_SHORT (1 << 0)
+#define JSO_SIMD_UTF8_TOO_LONG (1 << 1)
+#define JSO_SIMD_UTF8_OVERLONG_3 (1 << 2)
+#define JSO_SIMD_UTF8_TOO_LARGE (1 << 3)
+#define JSO_SIMD_UTF8_SURROGATE (1 << 4)
+#define JSO_SIMD_UTF8_OVERLONG_2 (1 << 5)
+#define JSO_SIMD_UTF8_TOO_LARGE_1000 (1 << 6)
+#define JSO_SIMD_UTF8_OVERLONG_4 (1 << 6)
+#define JSO_SIMD_UTF8_TWO_CONTS (1 << 7)
+#define JSO_SIMD_UTF8_CARRY \
+	(JSO_SIMD_UTF8_TOO_SHORT | JSO_SIMD_UTF8_TOO_LONG | JSO_SIMD_UTF8_TWO_CONTS)
+
+/* errors by the high nibble of the first byte */
+#define JSO_SIMD_UTF8_BYTE_1_HIGH \
+	JSO_SIMD_UTF8_TOO_LONG, JSO_SIMD_UTF8_TOO_LONG, JSO_SIMD_UTF8_TOO_LONG, \
+			JSO_SIMD_UTF8_TOO_LONG, JSO_SIMD_UTF8_TOO_LONG, JSO_SIMD_UTF8_TOO_LONG, \
+			JSO_SIMD_UTF8_TOO_LONG, JSO_SIMD_UTF8_TOO_LONG, JSO_SIMD_UTF8_TWO_CONTS, \
+			JSO_SIMD_UTF8_TWO_CONTS, JSO_SIMD_UTF8_TWO_CONTS, JSO_SIMD_UTF8_TWO_CONTS, \
+			JSO_SIMD_UTF8_TOO_SHORT | JSO_SIMD_UTF8_OVERLONG_2, JSO_SIMD_UTF8_TOO_SHORT, \
+			JSO_SIMD_UTF8_TOO_SHORT | JSO_SIMD_UTF8_OVERLONG_3 | JSO_SIMD_UTF8_SURROGATE, \
+			JSO_SIMD_UTF8_TOO_SHORT | JSO_SIMD_UTF8_TOO_LARGE | JSO_SIMD_UTF8_TOO_LARGE_1000 \
+					| JSO_SIMD_UTF8_OVERLONG_4
+
+/* errors by the low nibble of the first byte */
+#define JSO_SIMD_UTF8_BYTE_1_LOW \
+	JSO_SIMD_UTF8_CARRY | JSO_SIMD_UTF8_OVERLONG_3 | JSO_SIMD_UTF8_OVERLONG_2 \
+			| JSO_SIMD_UTF8_OVERLONG_4, \
+			JSO_SIMD_UTF8_CARRY | JSO_SIMD_UTF8_OVERLONG_2, JSO_SIMD_UTF8_CARRY, \
+			JSO_SIMD_UTF8_CARRY, JSO_SIMD_UTF8_CARRY | JSO_SIMD_UTF8_TOO_LARGE, \
+			JSO_SIMD_UTF8_CARRY | JSO_SIMD_UTF8_TOO_LARGE | JSO_SIMD_UTF8_TOO_LARGE_1000, \
+			JSO_SIMD_UTF8_CARRY | JSO_SIMD_UTF8_TOO_LARGE | JSO_SIMD_UTF8_TOO_LARGE_1000, \
+			JSO_SIMD_UTF8_CARRY | JSO_SIMD_UTF8_TOO_LARGE | JSO_SIMD_UTF8_TOO_LARGE_1000, \
+			JSO_SIMD_UTF8_CARRY | JSO_SIMD_UTF8_TOO_LARGE | JSO_SIMD_UTF8_TOO_LARGE_1000, \
+			JSO_SIMD_UTF8_CARRY | JSO_SIMD_UTF8_TOO_LARGE | JSO_SIMD_UTF8_TOO_LARGE_1000, \
+			JSO_SIMD_UTF8_CARRY | JSO_SIMD_UTF8_TOO_LARGE | JSO_SIMD_UTF8_TOO_LARGE_1000, \
+			JSO_SIMD_UTF8_CARRY | JSO_SIMD_UTF8_TOO_LARGE | JSO_SIMD_UTF8_TOO_LARGE_1000, \
+			JSO_SIMD_UTF8_CARRY | JSO_SIMD_UTF8_TOO_LARGE | JSO_SIMD_UTF8_TOO_LARGE_1000, \
+			JSO_SIMD_UTF8_CARRY | JSO_SIMD_UTF8_TOO_LARGE | JSO_SIMD_UTF8_TOO_LARGE_1000 \
+					| JSO_SIMD_UTF8_SURROGATE, \
+			JSO_SIMD_UTF8_CARRY | JSO_SIMD_UTF8_TOO_LARGE | JSO_SIMD_UTF8_TOO_LARGE_1000, \
+			JSO_SIMD_UTF8_CARRY | JSO_SIMD_UTF8_TOO_LARGE | JSO_SIMD_UTF8_TOO_LARGE_1000
+
+/* errors by the high nibble of the second byte */
+#define JSO_SIMD_UTF8_BYTE_2_HIGH \
+	JSO_SIMD_UTF8_TOO_SHORT, JSO_SIMD_UTF8_TOO_SHORT, JSO_SIMD_UTF8_TOO_SHORT, \
+			JSO_SIMD_UTF8_TOO_SHORT, JSO_SIMD_UTF8_TOO_SHORT, JSO_SIMD_UTF8_TOO_SHORT, \
+			JSO_SIMD_UTF8_TOO_SHORT, JSO_SIMD_UTF8_TOO_SHORT, \
+			JSO_SIMD_UTF8_TOO_LONG | JSO_SIMD_UTF8_OVERLONG_2 | JSO_SIMD_UTF8_TWO_CONTS \
+					| JSO_SIMD_UTF8_OVERLONG_3 | JSO_SIMD_UTF8_TOO_LARGE_1000 \
+					| JSO_SIMD_UTF8_OVERLONG_4, \
+			JSO_SIMD_UTF8_TOO_LONG | JSO_SIMD_UTF8_OVERLONG_2 | JSO_SIMD_UTF8_TWO_CONTS \
+					| JSO_SIMD_UTF8_OVERLONG_3 | JSO_SIMD_UTF8_TOO_LARGE, \
+			JSO_SIMD_UTF8_TOO_LONG | JSO_SIMD_UTF8_OVERLONG_2 | JSO_SIMD_UTF8_TWO_CONTS \
+					| JSO_SIMD_UTF8_SURROGATE | JSO_SIMD_UTF8_TOO_LARGE, \
+			JSO_SIMD_UTF8_TOO_LONG | JSO_SIMD_UTF8_OVERLONG_2 | JSO_SIMD_UTF8_TWO_CONTS \
+					| JSO_SIMD_UTF8_SURROGATE | JSO_SIMD_UTF8_TOO_LARGE, \
+			JSO_SIMD_UTF8_TOO_SHORT, JSO_SIMD_UTF8_TOO_SHORT, JSO_SIMD_UTF8_TOO_SHORT, \
+			JSO_SIMD_UTF8_TOO_SHORT
+
+#endif /* JSO_SIMD_X86_64 || JSO_SIMD_AARCH64 */
+
+#ifdef JSO_SIMD_X86_64
+
+static size_t jso_simd_string_span_sse2(const jso_ctype *str, size_t len)
+{
+	const __m128i quote = _mm_set1_epi8('"');
+	const __m128i backslash = _mm_set1_epi8('\\');
+	const __m128i space = _mm_set1_epi8(0x20);
+	size_t pos = 0;
+	for (; pos + 16 <= len; pos += 16) {
+		__m128i chunk = _mm_loadu_si128((const __m128i *) (str + pos));
+		/* signed comparison catches control characters as well as all non ASCII bytes */
+		__m128i special = _mm_or_si128(
+				_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)),
+				_mm_cmplt_epi8(chunk, space));
+		int mask = _mm_movemask_epi8(special);
+		if (mask) {
+			return pos + (size_t) __builtin_ctz((unsigned int) mask);
+		}
+	}
+	return pos + jso_simd_string_span_scalar(str + pos, len - pos);
+}
+
+/* get mask of the bytes that end the plain span */
+__attribute__((target("avx2"))) static inline unsigned int jso_simd_string_mask_avx2(
+		const jso_ctype *str)
+{
+	const __m256i quote = _mm256_set1_epi8('"');
+	const __m256i backslash = _mm256_set1_epi8('\\');
+	const __m256i space = _mm256_set1_epi8(0x20);
+	__m256i chunk = _mm256_loadu_si256((const __m256i *) str);
+	__m256i special = _mm256_or_si256(
+			_mm256_or_si256(_mm256_cmpeq_epi8(chunk, quote), _mm256_cmpeq_epi8(chunk, backslash)),
+			_mm256_cmpgt_epi8(space, chunk));
+	return (unsigned int) _mm256_movemask_epi8(special);
+}
+
+/*
+ * The short strings are checked by SSE2 before any AVX2 instruction is used and the tail is
+ * checked by the last block that overlaps with the previous one because calling SSE2 code with
+ * dirty upper AVX state is very slow.
+ */
+__attribute__((target("avx2"))) static size_t jso_simd_string_span_avx2(
+		const jso_ctype *str, size_t len)
+{
+	size_t pos = 0;
+	unsigned int mask;
+
+	if (len < 32) {
+		return jso_simd_string_span_sse2(str, len);
+	}
+	for (; pos + 32 <= len; pos += 32) {
+		mask = jso_simd_string_mask_avx2(str + pos);
+		if (mask) {
+			return pos + (size_t) __builtin_ctz(mask);
+		}
+	}
+	if (pos < len) {
+		mask = jso_simd_string_mask_avx2(str + len - 32) >> (pos - (len - 32));
+		if (mask) {
+			return pos + (size_t) __builtin_ctz(mask);
+		}
+	}
+	return len;
+}
+
+static size_t jso_simd_escape_span_sse2(const jso_ctype *str, size_t len)
+{
+	const __m128i quote = _mm_set1_epi8('"');
+	const __m128i backslash = _mm_set1_epi8('\\');
+	const __m128i slash = _mm_set1_epi8('/');
+	const __m128i control = _mm_set1_epi8(0x1f);
+	size_t pos = 0;
+	for (; pos + 16 <= len; pos += 16) {
+		__m128i chunk = _mm_loadu_si128((const __m128i *) (str + pos));
+		/* unsigned comparison so the non ASCII bytes are not escaped */
+		__m128i special = _mm_or_si128(
+				_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)),
+				_mm_or_si128(_mm_cmpeq_epi8(chunk, slash),
+						_mm_cmpeq_epi8(_mm_min_epu8(chunk, control), chunk)));
+		int mask = _mm_movemask_epi8(special);
+		if (mask) {
+			return pos + (size_t) __builtin_ctz((unsigned int) mask);
+		}
+	}
+	return pos + jso_simd_escape_span_scalar(str + pos, len - pos);
+}
+
+/* get mask of the bytes that need to be escaped */
+__attribute__((target("avx2"))) static inline unsigned int jso_simd_escape_mask_avx2(
+		const jso_ctype *str)
+{
+	const __m256i quote = _mm256_set1_epi8('"');
+	const __m256i backslash = _mm256_set1_epi8('\\');
+	const __m256i slash = _mm256_set1_epi8('/');
+	const __m256i control = _mm256_set1_epi8(0x1f);
+	__m256i chunk = _mm256_loadu_si256((const __m256i *) str);
+	__m256i special = _mm256_or_si256(
+			_mm256_or_si256(_mm256_cmpeq_epi8(chunk, quote), _mm256_cmpeq_epi8(chunk, backslash)),
+			_mm256_or_si256(_mm256_cmpeq_epi8(chunk, slash),
+					_mm256_cmpeq_epi8(_mm256_min_epu8(chunk, control), chunk)));
+	return (unsigned int) _mm256_movemask_epi8(special);
+}
+
+/* the same block handling as for the plain span */
+__attribute__((target("avx2"))) static size_t jso_simd_escape_span_avx2(
+		const jso_ctype *str, size_t len)
+{
+	size_t pos = 0;
+	unsigned int mask;
+
+	if (len < 32) {
+		return jso_simd_escape_span_sse2(str, len);
+	}
+	for (; pos + 32 <= len; pos += 32) {
+		mask = jso_simd_escape_mask_avx2(str + pos);
+		if (mask) {
+			return pos + (size_t) __builtin_ctz(mask);
+		}
+	}
+	if (pos < len) {
+		mask = jso_simd_escape_mask_avx2(str + len - 32) >> (pos - (len - 32));
+		if (mask) {
+			return pos + (size_t) __builtin_ctz(mask);
+		}
+	}
+	return len;
+}
+
+/* SSE2 does not have byte shuffle so only the ASCII runs are vectorized */
+static size_t jso_simd_string_span_utf8_sse2(const jso_ctype *str, size_t len)
+{
+	return jso_simd_string_span_utf8_generic(str, len, jso_simd_string_span_sse2);
+}
+
+/* get the input shifted by n bytes with the end of the previous input shifted in */
+#define JSO_SIMD_AVX2_PREV(input, prev, n) \
+	_mm256_alignr_epi8(input, _mm256_permute2x128_si256(prev, input, 0x21), 16 - (n))
+
+/* get UTF-8 errors in the input block (zero if there is none) */
+__attribute__((target("avx2"))) static inline __m256i jso_simd_utf8_errors_avx2(
+		__m256i input, __m256i prev_input)
+{
+	const __m256i byte_1_high_table = _mm256_setr_epi8(
+			JSO_SIMD_UTF8_BYTE_1_HIGH, JSO_SIMD_UTF8_BYTE_1_HIGH);
+	const __m256i byte_1_low_table
+			= _mm256_setr_epi8(JSO_SIMD_UTF8_BYTE_1_LOW, JSO_SIMD_UTF8_BYTE_1_LOW);
+	const __m256i byte_2_high_table = _mm256_setr_epi8(
+			JSO_SIMD_UTF8_BYTE_2_HIGH, JSO_SIMD_UTF8_BYTE_2_HIGH);
+	const __m256i nibble = _mm256_set1_epi8(0x0F);
+
+	__m256i prev1 = JSO_SIMD_AVX2_PREV(input, prev_input, 1);
+	__m256i byte_1_high = _mm256_shuffle_epi8(
+			byte_1_high_table, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble));
+	__m256i byte_1_low = _mm256_shuffle_epi8(byte_1_low_table, _mm256_and_si256(prev1, nibble));
+	__m256i byte_2_high = _mm256_shuffle_epi8(
+			byte_2_high_table, _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble));
+	__m256i special = _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+
+	/* only the third and fourth bytes of the lead bytes saturate to values above 0x80 */
+	__m256i third = _mm256_subs_epu8(
+			JSO_SIMD_AVX2_PREV(input, prev_input, 2), _mm256_set1_epi8((char) (0xE0 - 0x80)));
+	__m256i fourth = _mm256_subs_epu8(
+			JSO_SIMD_AVX2_PREV(input, prev_input, 3), _mm256_set1_epi8((char) (0xF0 - 0x80)));
+	__m256i must_be_cont
+			= _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8((char) 0x80));
+
+	return _mm256_xor_si256(must_be_cont, special);
+}
+
+__attribute__((target("avx2"))) static size_t jso_simd_string_span_utf8_avx2(
+		const jso_ctype *str, size_t len)
+{
+	const __m256i quote = _mm256_set1_epi8('"');
+	const __m256i backslash = _mm256_set1_epi8('\\');
+	const __m256i ctrl = _mm256_set1_epi8((char) 0xE0);
+	const __m256i indexes = _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+			15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31);
+	/* the last bytes that are bigger than these values are incomplete characters */
+	const __m256i incomplete_max = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+			-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+			(char) (0xF0 - 1), (char) (0xE0 - 1), (char) (0xC0 - 1));
+	__m256i prev_input = _mm256_setzero_si256();
+	jso_bool prev_incomplete = false;
+	jso_ctype tail[32];
+	size_t pos = 0;
+
+	while (pos < len) {
+		__m256i input;
+		if (len - pos >= 32) {
+			input = _mm256_loadu_si256((const __m256i *) (str + pos));
+		} else {
+			/* zero padding is a control character so it stops the span */
+			memset(tail, 0, sizeof(tail));
+			memcpy(tail, str + pos, len - pos);
+			input = _mm256_loadu_si256((const __m256i *) tail);
+		}
+		__m256i special = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(input, quote),
+														  _mm256_cmpeq_epi8(input, backslash)),
+				_mm256_cmpeq_epi8(_mm256_and_si256(input, ctrl), _mm256_setzero_si256()));
+		unsigned int mask = (unsigned int) _mm256_movemask_epi8(special);
+		size_t run = mask ? (size_t) __builtin_ctz(mask) : 32;
+		if (run < 32) {
+			/* clear the bytes after the span so the incomplete character is reported as error */
+			__m256i keep = _mm256_cmpgt_epi8(_mm256_set1_epi8((char) run), indexes);
+			input = _mm256_and_si256(input, keep);
+		}
+		if (_mm256_movemask_epi8(input) || prev_incomplete) {
+			__m256i errors = jso_simd_utf8_errors_avx2(input, prev_input);
+			if (!_mm256_testz_si256(errors, errors)) {
+				return jso_simd_utf8_char_start(str, pos);
+			}
+			prev_incomplete = !_mm256_testz_si256(
+					_mm256_subs_epu8(input, incomplete_max), _mm256_set1_epi8((char) 0xFF));
+		}
+		if (run < 32) {
+			return pos + run;
+		}
+		prev_input = input;
+		pos += 32;
+	}
+
+	return prev_incomplete ? jso_simd_utf8_char_start(str, pos) : pos;
+}
+
+/* get mask of the characters equal to c in the 16 characters chunk */
+#define JSO_SIMD_SSE2_EQ(chunk, c) \
+	((jso_uint64) (unsigned int) _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(c))))
+
+static jso_uint64 jso_simd_structural_block_sse2(
+		jso_simd_structural_state *state, const jso_ctype *block)
+{
+	jso_simd_block_masks masks = { 0 };
+	for (size_t i = 0; i < JSO_SIMD_BLOCK_SIZE; i += 16) {
+		__m128i chunk = _mm_loadu_si128((const __m128i *) (block + i));
+		/* the brackets differ from the braces only by the 0x20 bit */
+		__m128i lower = _mm_or_si128(chunk, _mm_set1_epi8(0x20));
+		masks.quote |= JSO_SIMD_SSE2_EQ(chunk, '"') << i;
+		masks.backslash |= JSO_SIMD_SSE2_EQ(chunk, '\\') << i;
+		masks.whitespace |= (JSO_SIMD_SSE2_EQ(chunk, ' ') | JSO_SIMD_SSE2_EQ(chunk, '\t')
+									| JSO_SIMD_SSE2_EQ(chunk, '\n') | JSO_SIMD_SSE2_EQ(chunk, '\r'))
+				<< i;
+		masks.op |= (JSO_SIMD_SSE2_EQ(lower, '{') | JSO_SIMD_SSE2_EQ(lower, '}')
+							| JSO_SIMD_SSE2_EQ(chunk, ':') | JSO_SIMD_SSE2_EQ(chunk, ','))
+				<< i;
+	}
+	return jso_simd_structural_generic(state, &masks, jso_simd_prefix_xor);
+}
+
+/* get mask of the characters equal to c in the 32 characters chunk */
+#define JSO_SIMD_AVX2_EQ(chunk, c) \
+	((jso_uint64) (unsigned int) _mm256_movemask_epi8( \
+			_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(c))))
+
+/* compute the prefix xor by carry-less multiply by all ones */
+__attribute__((target("pclmul"))) static inline jso_uint64 jso_simd_prefix_xor_clmul(
+		jso_uint64 mask)
+{
+	__m128i product = _mm_clmulepi64_si128(
+			_mm_set_epi64x(0, (long long) mask), _mm_set1_epi8((char) 0xFF), 0);
+	return (jso_uint64) _mm_cvtsi128_si64(product);
+}
+
+__attribute__((target("avx2,pclmul"))) static jso_uint64 jso_simd_structural_block_avx2(
+		jso_simd_structural_state *state, const jso_ctype *block)
+{
+	jso_simd_block_masks masks = { 0 };
+	for (size_t i = 0; i < JSO_SIMD_BLOCK_SIZE; i += 32) {
+		__m256i chunk = _mm256_loadu_si256((const __m256i *) (block + i));
+		__m256i lower = _mm256_or_si256(chunk, _mm256_set1_epi8(0x20));
+		masks.quote |= JSO_SIMD_AVX2_EQ(chunk, '"') << i;
+		masks.backslash |= JSO_SIMD_AVX2_EQ(chunk, '\\') << i;
+		masks.whitespace |= (JSO_SIMD_AVX2_EQ(chunk, ' ') | JSO_SIMD_AVX2_EQ(chunk, '\t')
+									| JSO_SIMD_AVX2_EQ(chunk, '\n') | JSO_SIMD_AVX2_EQ(chunk, '\r'))
+				<< i;
+		masks.op |= (JSO_SIMD_AVX2_EQ(lower, '{') | JSO_SIMD_AVX2_EQ(lower, '}')
+							| JSO_SIMD_AVX2_EQ(chunk, ':') | JSO_SIMD_AVX2_EQ(chunk, ','))
+				<< i;
+	}
+	return jso_simd_structural_generic(state, &masks, jso_simd_prefix_xor_clmul);
+}
+
+#endif /* JSO_SIMD_X86_64 */
+
+#ifdef JSO_SIMD_AARCH64
+
+static size_t jso_simd_string_span_neon(const jso_ctype *str, size_t len)
+{
+	const uint8x16_t quote = vdupq_n_u8('"');
+	const uint8x16_t backslash = vdupq_n_u8('\\');
+	const uint8x16_t space = vdupq_n_u8(0x20);
+	const uint8x16_t high = vdupq_n_u8(0x80);
+	size_t pos = 0;
+	for (; pos + 16 <= len; pos += 16) {
+		uint8x16_t chunk = vld1q_u8(str + pos);
+		uint8x16_t special
+				= vorrq_u8(vorrq_u8(vceqq_u8(chunk, quote), vceqq_u8(chunk, backslash)),
+						vorrq_u8(vcltq_u8(chunk, space), vcgeq_u8(chunk, high)));
+		if (vmaxvq_u8(special)) {
+			break;
+		}
+	}
+	return pos + jso_simd_string_span_scalar(str + pos, len - pos);
+}
+
+static size_t jso_simd_escape_span_neon(const jso_ctype *str, size_t len)
+{
+	const uint8x16_t quote = vdupq_n_u8('"');
+	const uint8x16_t backslash = vdupq_n_u8('\\');
+	const uint8x16_t slash = vdupq_n_u8('/');
+	const uint8x16_t space = vdupq_n_u8(0x20);
+	size_t pos = 0;
+	for (; pos + 16 <= len; pos += 16) {
+		uint8x16_t chunk = vld1q_u8(str + pos);
+		uint8x16_t special
+				= vorrq_u8(vorrq_u8(vceqq_u8(chunk, quote), vceqq_u8(chunk, backslash)),
+						vorrq_u8(vceqq_u8(chunk, slash), vcltq_u8(chunk, space)));
+		if (vmaxvq_u8(special)) {
+			break;
+		}
+	}
+	return pos + jso_simd_escape_span_scalar(str + pos, len - pos);
+}
+
+/* get UTF-8 errors in the input block (zero if there is none) */
+static inline uint8x16_t jso_simd_utf8_errors_neon(uint8x16_t input, uint8x16_t prev_input)
+{
+	static const jso_ctype byte_1_high_table[16] = { JSO_SIMD_UTF8_BYTE_1_HIGH };
+	static const jso_ctype byte_1_low_table[16] = { JSO_SIMD_UTF8_BYTE_1_LOW };
+	static const jso_ctype byte_2_high_table[16] = { JSO_SIMD_UTF8_BYTE_2_HIGH };
+
+	uint8x16_t prev1 = vextq_u8(prev_input, input, 16 - 1);
+	uint8x16_t byte_1_high = vqtbl1q_u8(vld1q_u8(byte_1_high_table), vshrq_n_u8(prev1, 4));
+	uint8x16_t byte_1_low
+			= vqtbl1q_u8(vld1q_u8(byte_1_low_table), vandq_u8(prev1, vdupq_n_u8(0x0F)));
+	uint8x16_t byte_2_high = vqtbl1q_u8(vld1q_u8(byte_2_high_table), vshrq_n_u8(input, 4));
+	uint8x16_t special = vandq_u8(vandq_u8(byte_1_high, byte_1_low), byte_2_high);
+
+	/* only the third and fourth bytes of the lead bytes saturate to values above 0x80 */
+	uint8x16_t third = vqsubq_u8(vextq_u8(prev_input, input, 16 - 2), vdupq_n_u8(0xE0 - 0x80));
+	uint8x16_t fourth = vqsubq_u8(vextq_u8(prev_input, input, 16 - 3), vdupq_n_u8(0xF0 - 0x80));
+	uint8x16_t must_be_cont = vandq_u8(vorrq_u8(third, fourth), vdupq_n_u8(0x80));
+
+	return veorq_u8(must_be_cont, special);
+}
+
+static size_t jso_simd_string_span_utf8_neon(const jso_ctype *str, size_t len)
+{
+	static const jso_ctype indexes_array[16]
+			= { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+	/* the last bytes that are bigger than these values are incomplete characters */
+	static const jso_ctype incomplete_max_array[16] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1 };
+	const uint8x16_t quote = vdupq_n_u8('"');
+	const uint8x16_t backslash = vdupq_n_u8('\\');
+	const uint8x16_t space = vdupq_n_u8(0x20);
+	const uint8x16_t indexes = vld1q_u8(indexes_array);
+	const uint8x16_t incomplete_max = vld1q_u8(incomplete_max_array);
+	uint8x16_t prev_input = vdupq_n_u8(0);
+	jso_bool prev_incomplete = false;
+	jso_ctype tail[16];
+	size_t pos = 0;
+
+	while (pos < len) {
+		uint8x16_t input;
+		if (len - pos >= 16) {
+			input = vld1q_u8(str + pos);
+		} else {
+			/* zero padding is a control character so it stops the span */
+			memset(tail, 0, sizeof(tail));
+			memcpy(tail, str + pos, len - pos);
+			input = vld1q_u8(tail);
+		}
+		uint8x16_t special = vorrq_u8(vorrq_u8(vceqq_u8(input, quote), vceqq_u8(input, backslash)),
+				vcltq_u8(input, space));
+		size_t run = 16;
+		if (vmaxvq_u8(special)) {
+			jso_ctype special_bytes[16];
+			vst1q_u8(special_bytes, special);
+			run = 0;
+			while (!special_bytes[run]) {
+				++run;
+			}
+			/* clear the bytes after the span so the incomplete character is reported as error */
+			input = vandq_u8(input, vcltq_u8(indexes, vdupq_n_u8((jso_ctype) run)));
+		}
+		if (vmaxvq_u8(input) >= 0x80 || prev_incomplete) {
+			if (vmaxvq_u8(jso_simd_utf8_errors_neon(input, prev_input))) {
+				return jso_simd_utf8_char_start(str, pos);
+			}
+			prev_incomplete = vmaxvq_u8(vqsubq_u8(input, incomplete_max)) != 0;
+		}
+		if (run < 16) {
+			return pos + run;
+		}
+		prev_input = input;
+		pos += 16;
+	}
+
+	return prev_incomplete ? jso_simd_utf8_char_start(str, pos) : pos;
+}
+
+/* get mask of the set bytes in the four 16 bytes comparison results */
+static inline jso_uint64 jso_simd_neon_mask(
+		uint8x16_t chunk0, uint8x16_t chunk1, uint8x16_t chunk2, uint8x16_t chunk3)
+{
+	static const jso_ctype weights_array[16]
+			= { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+	const uint8x16_t weights = vld1q_u8(weights_array);
+	uint8x16_t sum0 = vpaddq_u8(vandq_u8(chunk0, weights), vandq_u8(chunk1, weights));
+	uint8x16_t sum1 = vpaddq_u8(vandq_u8(chunk2, weights), vandq_u8(chunk3, weights));
+	sum0 = vpaddq_u8(sum0, sum1);
+	sum0 = vpaddq_u8(sum0, sum0);
+	return vgetq_lane_u64(vreinterpretq_u64_u8(sum0), 0);
+}
+
+/* get mask of the characters equal to c in the block */
+#define JSO_SIMD_NEON_EQ(chunks, c) \
+	jso_simd_neon_mask(vceqq_u8(chunks.val[0], vdupq_n_u8(c)), \
+			vceqq_u8(chunks.val[1], vdupq_n_u8(c)), vceqq_u8(chunks.val[2], vdupq_n_u8(c)), \
+			vceqq_u8(chunks.val[3], vdupq_n_u8(c)))
+
+/* the polynomial multiply needs the crypto extension so the prefix xor is computed by shifts */
+static jso_uint64 jso_simd_structural_block_neon(
+		jso_simd_structural_state *state, const jso_ctype *block)
+{
+	jso_simd_block_masks masks;
+	uint8x16x4_t chunks = { { vld1q_u8(block), vld1q_u8(block + 16), vld1q_u8(block + 32),
+			vld1q_u8(block + 48) } };
+	uint8x16x4_t lower;
+	for (size_t i = 0; i < 4; i++) {
+		/* the brackets differ from the braces only by the 0x20 bit */
+		lower.val[i] = vorrq_u8(chunks.val[i], vdupq_n_u8(0x20));
+	}
+	masks.quote = JSO_SIMD_NEON_EQ(chunks, '"');
+	masks.backslash = JSO_SIMD_NEON_EQ(chunks, '\\');
+	masks.whitespace = JSO_SIMD_NEON_EQ(chunks, ' ') | JSO_SIMD_NEON_EQ(chunks, '\t')
+			| JSO_SIMD_NEON_EQ(chunks, '\n') | JSO_SIMD_NEON_EQ(chunks, '\r');
+	masks.op = JSO_SIMD_NEON_EQ(lower, '{') | JSO_SIMD_NEON_EQ(lower, '}')
+			| JSO_SIMD_NEON_EQ(chunks, ':') | JSO_SIMD_NEON_EQ(chunks, ',');
+	return jso_simd_structural_generic(state, &masks, jso_simd_prefix_xor);
+}
+
+#endif /* JSO_SIMD_AARCH64 */
+
+/* check whether the level is supported by the CPU and compiled in */
+static jso_bool jso_simd_is_supported(jso_simd_level level)
+{
+	switch (level) {
+		case JSO_SIMD_LEVEL_SCALAR:
+		case JSO_SIMD_LEVEL_SWAR:
+			return true;
+#ifdef JSO_SIMD_X86_64
+		case JSO_SIMD_LEVEL_SSE2:
+			return true;
+		case JSO_SIMD_LEVEL_AVX2:
+			/* the structural scanning also uses carry-less multiply */
+			__builtin_cpu_init();
+			return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("pclmul");
+#endif
+#ifdef JSO_SIMD_AARCH64
+		case JSO_SIMD_LEVEL_NEON:
+			return true;
+#endif
+		default:
+			return false;
+	}
+}
+
+static const jso_simd_impl jso_simd_impls[] = {
+	{ JSO_SIMD_LEVEL_SCALAR, jso_simd_string_span_scalar, jso_simd_string_span_utf8_scalar,
+			jso_simd_escape_span_scalar, jso_simd_structural_block_scalar },
+	{ JSO_SIMD_LEVEL_SWAR, jso_simd_string_span_swar, jso_simd_string_span_utf8_swar,
+			jso_simd_escape_span_swar, jso_simd_structural_block_scalar },
+#ifdef JSO_SIMD_X86_64
+	{ JSO_SIMD_LEVEL_SSE2, jso_simd_string_span_sse2, jso_simd_string_span_utf8_sse2,
+			jso_simd_escape_span_sse2, jso_simd_structural_block_sse2 },
+	{ JSO_SIMD_LEVEL_AVX2, jso_simd_string_span_avx2, jso_simd_string_span_utf8_avx2,
+			jso_simd_escape_span_avx2, jso_simd_structural_block_avx2 },
+#endif
+#ifdef JSO_SIMD_AARCH64
+	{ JSO_SIMD_LEVEL_NEON, jso_simd_string_span_neon, jso_simd_string_span_utf8_neon,
+			jso_simd_escape_span_neon, jso_simd_structural_block_neon },
+#endif
+};
+
+static const jso_simd_impl *jso_simd_get_impl(jso_simd_level level)
+{
+	for (size_t i = 0; i < sizeof(jso_simd_impls) / sizeof(jso_simd_impls[0]); i++) {
+		if (jso_simd_impls[i].level == level) {
+			return &jso_simd_impls[i];
+		}
+	}
+	return &jso_simd_impls[0];
+}
+
+/* selected implementation - NULL until it is resolved on the first use */
+static _Atomic(const jso_simd_impl *) jso_simd_current_impl = NULL;
+
+static void jso_simd_select(jso_simd_level level)
+{
+	atomic_store_explicit(&jso_simd_current_impl, jso_simd_get_impl(level), memory_order_relaxed);
+}
+
+/* select the best supported level */
+static jso_simd_level jso_simd_detect(void)
+{
+	static const jso_simd_level levels[]
+			= { JSO_SIMD_LEVEL_AVX2, JSO_SIMD_LEVEL_NEON, JSO_SIMD_LEVEL_SSE2 };
+
+	for (size_t i = 0; i < sizeof(levels) / sizeof(levels[0]); i++) {
+		if (jso_simd_is_supported(levels[i])) {
+			return levels[i];
+		}
+	}
+	return JSO_SIMD_LEVEL_SWAR;
+}
+
+/* get the selected implementation and resolve it if it is not selected yet */
+static inline const jso_simd_impl *jso_simd_impl_get(void)
+{
+	const jso_simd_impl *impl
+			= atomic_load_explicit(&jso_simd_current_impl, memory_order_relaxed);
+	if (impl == NULL) {
+		jso_simd_select(jso_simd_detect());
+		impl = atomic_load_explicit(&jso_simd_current_impl, memory_order_relaxed);
+	}
+	return impl;
+}
+
+JSO_API jso_simd_level jso_simd_get_level(void)
+{
+	return jso_simd_impl_get()->level;
+}
+
+JSO_API jso_rc jso_simd_set_level(jso_simd_level level)
+{
+	if (!jso_simd_is_supported(level)) {
+		return JSO_FAILURE;
+	}
+	jso_simd_select(level);
+	return JSO_SUCCESS;
+}
+
+JSO_API size_t jso_simd_string_span(const jso_ctype *str, size_t len)
+{
+	return jso_simd_impl_get()->string_span(str, len);
+}
+
+JSO_API size_t jso_simd_string_span_utf8(const jso_ctype *str, size_t len)
+{
+	return jso_simd_impl_get()->string_span_utf8(str, len);
+}
+
+JSO_API size_t jso_simd_escape_span(const jso_ctype *str, size_t len)
+{
+	return jso_simd_impl_get()->escape_span(str, len);
+}
+
+JSO_API jso_uint64 jso_simd_structural_block(
+		jso_simd_structural_state *state, const jso_ctype *block)
+{
+	return jso_simd_impl_get()->structural_block(state, block);
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/**
+ * @file jso_simd.h
+ * @brief Vectorized scanning helpers
+ */
+
+#ifndef JSO_SIMD_H
+#define JSO_SIMD_H
+
+#include "jso_types.h"
+
+/**
+ * @brief Implementation level of the vectorized helpers.
+ */
+typedef enum {
+	/** byte by byte implementation */
+	JSO_SIMD_LEVEL_SCALAR,
+	/** portable SIMD within a register (64-bit words) */
+	JSO_SIMD_LEVEL_SWAR,
+	/** x86-64 SSE2 */
+	JSO_SIMD_LEVEL_SSE2,
+	/** x86-64 AVX2 */
+	JSO_SIMD_LEVEL_AVX2,
+	/** AArch64 NEON */
+	JSO_SIMD_LEVEL_NEON,
+} jso_simd_level;
+
+/**
+ * Get the currently used implementation level.
+ *
+ * The level is selected on the first use as the best one supported by the CPU.
+ *
+ * @return The used level.
+ */
+JSO_API jso_simd_level jso_simd_get_level(void);
+
+/**
+ * Set the implementation level.
+ *
+ * @param level implementation level
+ * @return @ref JSO_SUCCESS on success, otherwise @ref JSO_FAILURE if the level is not supported
+ * by the CPU or not compiled in.
+ */
+JSO_API jso_rc jso_simd_set_level(jso_simd_level level);
+
+/**
+ * Get the length of the plain string span.
+ *
+ * The plain span contains only printable ASCII characters that are not quote or backslash so
+ * each byte is a single column character that does not need any special handling.
+ *
+ * @param str string start
+ * @param len maximal length to check
+ * @return Number of the leading plain characters.
+ */
+JSO_API size_t jso_simd_string_span(const jso_ctype *str, size_t len);
+
+/**
+ * Get the length of the valid UTF-8 string span.
+ *
+ * The span is the same as the plain span but it can also contain multi-byte UTF-8 characters
+ * which are validated in bulk. The span never ends in the middle of the character and it ends
+ * before the invalid characters. However it can also end a few characters before the invalid
+ * one so the caller needs to find the exact position of the error.
+ *
+ * @param str string start
+ * @param len maximal length to check
+ * @return Number of the leading bytes that form the valid span.
+ */
+JSO_API size_t jso_simd_string_span_utf8(const jso_ctype *str, size_t len);
+
+/**
+ * Get the length of the string span that does not need to be escaped by encoder.
+ *
+ * The span ends before the first quote, backslash, slash or control character. All other bytes
+ * including the non ASCII ones are copied to the output without any change.
+ *
+ * @param str string start
+ * @param len maximal length to check
+ * @return Number of the leading bytes that do not need to be escaped.
+ */
+JSO_API size_t jso_simd_escape_span(const jso_ctype *str, size_t len);
+
+/**
+ * @brief Number of characters in the block classified by @ref jso_simd_structural_block.
+ */
+#define JSO_SIMD_BLOCK_SIZE 64
+
+/**
+ * @brief State of the structural scanning carried from the previous block.
+ *
+ * The state must be zero initialized before the first block of the input.
+ */
+typedef struct _jso_simd_structural_state {
+	/** all bits set if the previous block ended inside string, otherwise zero */
+	jso_uint64 in_string;
+	/** 1 if the first character of the block is escaped by the previous block */
+	jso_uint64 escaped;
+	/** 1 if the previous block ended with a scalar character other than quote */
+	jso_uint64 scalar;
+} jso_simd_structural_state;
+
+/**
+ * Get the structural characters of the input block.
+ *
+ * The structural characters are the brackets, colons and commas outside strings, the opening
+ * quotes and the first characters of other scalars (numbers and literals) that follow whitespace
+ * or other structural character. The escapes and string boundaries are found for the whole block
+ * at once using the bit masks so the strings are never scanned character by character.
+ *
+ * @param state state carried between the blocks
+ * @param block block of @ref JSO_SIMD_BLOCK_SIZE characters
+ * @return Mask where set bit n means that the block character n is structural.
+ */
+JSO_API jso_uint64 jso_simd_structural_block(
+		jso_simd_structural_state *state, const jso_ctype *block);
+
+#endif /* JSO_SIMD_H */
@@ -39,6 +39,18 @@
  */
 #define JSO_STRING_FLAG_HASH_SET 1
 
+/**
+ * @brief String flag defining whether the string is owned by an arena.
+ */
+#define JSO_STRING_FLAG_ARENA 2
+
+/**
+ * @brief String flag defining whether the characters are borrowed from the parser input.
+ *
+ * The borrowed characters are not NUL terminated.
+ */
+#define JSO_STRING_FLAG_BORROWED 4
+
 /**
  * @brief Character type for scanner.
  */
@@ -56,10 +68,26 @@ struct _jso_string {
 	jso_uint32 hash;
 	/** string length */
 	size_t len;
-	/** string characters */
+	/** string characters or the pointer to them if @ref JSO_STRING_FLAG_BORROWED is set */
 	jso_ctype val[1];
 };
 
+/**
+ * Get string characters for the supplied string pointer.
+ *
+ * @param str string
+ * @return The owned or borrowed characters.
+ */
+static inline jso_ctype *jso_string_val(jso_string *str)
+{
+	if (str->flags & JSO_STRING_FLAG_BORROWED) {
+		jso_ctype *borrowed;
+		memcpy(&borrowed, str->val, sizeof(borrowed));
+		return borrowed;
+	}
+	return str->val;
+}
+
 /**
  * Get string length for the supplied string pointer.
  *
@@ -74,7 +102,7 @@ struct _jso_string {
  * @param _str pointer to @ref jso_string
  * @return The string value (jso_ctype array)
  */
-#define JSO_STRING_VAL(_str) ((jso_ctype *) &(_str)->val)
+#define JSO_STRING_VAL(_str) jso_string_val(_str)
 
 /**
  * Get a C string value for the supplied string pointer.
@@ -82,7 +110,7 @@ struct _jso_string {
  * @param _str pointer to @ref jso_string
  * @return The string value (const char array)
  */
-#define JSO_STRING_CSTR_VAL(_str) ((const char *) &(_str)->val)
+#define JSO_STRING_CSTR_VAL(_str) ((const char *) jso_string_val(_str))
 
 /**
  * Get string flags of the supplied string pointer.
@@ -157,7 +185,7 @@ static inline jso_string *jso_string_create_from_cstr(const char *cstr)
  */
 static inline void jso_string_free(jso_string *str)
 {
-	if (str == NULL) {
+	if (str == NULL || (JSO_STRING_FLAGS(str) & JSO_STRING_FLAG_ARENA)) {
 		return;
 	}
 	if (JSO_STRING_REFCOUNT(str) > 0) {
@@ -171,11 +199,28 @@ static inline void jso_string_free(jso_string *str)
  * Copy string.
  *
  * @param str string to copy
- * @return The copied string.
+ * @return The copied string or NULL if the borrowed string allocation failed.
+ * @note Arena owned strings are not reference counted.
+ * @note Borrowed strings are materialized to a newly allocated owned string so the copy can
+ * outlive the parser input.
  */
 static inline jso_string *jso_string_copy(jso_string *str)
 {
-	++JSO_STRING_REFCOUNT(str);
+	if (JSO_STRING_FLAGS(str) & JSO_STRING_FLAG_BORROWED) {
+		jso_string *copy = jso_string_alloc(JSO_STRING_LEN(str));
+		if (copy != NULL) {
+			JSO_STRING_LEN(copy) = JSO_STRING_LEN(str);
+			memcpy(copy->val, jso_string_val(str), JSO_STRING_LEN(str));
+			if (JSO_STRING_FLAGS(str) & JSO_STRING_FLAG_HASH_SET) {
+				JSO_STRING_HASH(copy) = JSO_STRING_HASH(str);
+				JSO_STRING_FLAGS(copy) = JSO_STRING_FLAG_HASH_SET;
+			}
+		}
+		return copy;
+	}
+	if (!(JSO_STRING_FLAGS(str) & JSO_STRING_FLAG_ARENA)) {
+		++JSO_STRING_REFCOUNT(str);
+	}
 	return str;
 }
 
@@ -271,6 +316,46 @@ static inline jso_uint32 jso_string_get_hash(jso_string *str)
 	return JSO_STRING_HASH(str);
 }
 
+/**
+ * @brief Initial value of the string hash (FNV-1a offset basis).
+ */
+#define JSO_STRING_HASH_INIT 2166136261u
+
+/**
+ * Update string hash with the supplied characters using FNV-1a.
+ *
+ * It allows computing the hash incrementally, for example while the string is scanned.
+ *
+ * @param hash current hash starting with @ref JSO_STRING_HASH_INIT
+ * @param val characters to add
+ * @param len number of characters
+ * @return Updated hash.
+ */
+static inline jso_uint32 jso_string_hash_update(jso_uint32 hash, const jso_ctype *val, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		hash ^= (jso_uint32) val[i];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+/**
+ * Return string hash and cache it in the string if it has not been set yet.
+ *
+ * @param str string
+ * @return String hash.
+ */
+static inline jso_uint32 jso_string_hash(jso_string *str)
+{
+	if (!jso_string_has_hash(str)) {
+		jso_uint32 hash = jso_string_hash_update(
+				JSO_STRING_HASH_INIT, JSO_STRING_VAL(str), JSO_STRING_LEN(str));
+		jso_string_set_hash(str, hash);
+	}
+	return jso_string_get_hash(str);
+}
+
 /**
  * @brief Value representing not found string position
  */
@@ -307,8 +392,13 @@ static inline jso_string *jso_string_concat_prefixes(
 	if (str == NULL) {
 		return str;
 	}
-	memcpy(JSO_STRING_VAL(str), JSO_STRING_VAL(s1), s1_len);
-	memcpy(&JSO_STRING_VAL(str)[s1_len], JSO_STRING_VAL(s2), s2_len);
+	/* the empty prefix string can be NULL */
+	if (s1_len > 0) {
+		memcpy(JSO_STRING_VAL(str), JSO_STRING_VAL(s1), s1_len);
+	}
+	if (s2_len > 0) {
+		memcpy(&JSO_STRING_VAL(str)[s1_len], JSO_STRING_VAL(s2), s2_len);
+	}
 	JSO_STRING_VAL(str)[len] = '\0';
 	JSO_STRING_LEN(str) = len;
 	return str;
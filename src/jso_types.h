@@ -99,11 +99,26 @@ typedef struct _jso_string jso_string;
  */
 typedef struct _jso_array jso_array;
 
+/**
+ * @brief List type.
+ */
+typedef struct _jso_list jso_list;
+
 /**
  * @brief Object type.
  */
 typedef struct _jso_object jso_object;
 
+/**
+ * @brief Memory allocator.
+ */
+typedef struct _jso_allocator jso_allocator;
+
+/**
+ * @brief Arena allocator.
+ */
+typedef struct _jso_arena jso_arena;
+
 /**
  * @brief Regular expression code.
  */
@@ -178,7 +193,11 @@ typedef enum {
 	/** invalid escape error */
 	JSO_ERROR_ESCAPE,
 	/** schema validation error */
-	JSO_ERROR_SCHEMA
+	JSO_ERROR_SCHEMA,
+	/** parsing aborted by callback */
+	JSO_ERROR_ABORT,
+	/** duplicate object key */
+	JSO_ERROR_DUPLICATE_KEY
 } jso_error_type;
 
 /**
@@ -69,9 +69,15 @@ JSO_API void jso_value_free(jso_value *val)
 JSO_API jso_value *jso_value_copy(jso_value *val)
 {
 	switch (JSO_TYPE_P(val)) {
-		case JSO_TYPE_STRING:
-			JSO_STR_P(val) = jso_string_copy(JSO_STR_P(val));
+		case JSO_TYPE_STRING: {
+			/* borrowed string is materialized so the copy can fail */
+			jso_string *str = jso_string_copy(JSO_STR_P(val));
+			if (str == NULL) {
+				return NULL;
+			}
+			JSO_STR_P(val) = str;
 			break;
+		}
 		case JSO_TYPE_ARRAY:
 			JSO_ARRVAL_P(val) = jso_array_copy(JSO_ARRVAL_P(val));
 			break;
@@ -142,6 +148,91 @@ JSO_API jso_bool jso_value_equals(jso_value *val1, jso_value *val2)
 	}
 }
 
+/* HASHING */
+
+#define JSO_VALUE_HASH_OFFSET 2166136261u
+#define JSO_VALUE_HASH_PRIME 16777619u
+
+/* add bytes to FNV-1a hash */
+static inline jso_uint32 jso_value_hash_bytes(jso_uint32 hash, const void *data, size_t len)
+{
+	const unsigned char *bytes = (const unsigned char *) data;
+	for (size_t i = 0; i < len; i++) {
+		hash ^= (jso_uint32) bytes[i];
+		hash *= JSO_VALUE_HASH_PRIME;
+	}
+	return hash;
+}
+
+/* avalanche hash bits (murmur3 finalizer) so hashes can be combined by addition */
+static inline jso_uint32 jso_value_hash_mix(jso_uint32 hash)
+{
+	hash ^= hash >> 16;
+	hash *= 0x85ebca6bu;
+	hash ^= hash >> 13;
+	hash *= 0xc2b2ae35u;
+	hash ^= hash >> 16;
+	return hash;
+}
+
+/* hash string the same way as the hash table does so the cached hash can be reused */
+static inline jso_uint32 jso_value_hash_string(jso_string *str)
+{
+	return jso_string_hash(str);
+}
+
+/* compute structural hash of the value */
+JSO_API jso_uint32 jso_value_hash(jso_value *val)
+{
+	jso_uint32 type = (jso_uint32) JSO_TYPE_P(val);
+	jso_uint32 hash = jso_value_hash_bytes(JSO_VALUE_HASH_OFFSET, &type, sizeof(type));
+	jso_uint32 item_hash;
+
+	switch (JSO_TYPE_P(val)) {
+		case JSO_TYPE_BOOL:
+		case JSO_TYPE_INT: {
+			jso_int ival = JSO_IVAL_P(val);
+			return jso_value_hash_bytes(hash, &ival, sizeof(ival));
+		}
+		case JSO_TYPE_DOUBLE: {
+			jso_double dval = JSO_DVAL_P(val);
+			/* -0.0 == 0.0 so both must produce the same hash */
+			if (dval == 0.0) {
+				dval = 0.0;
+			}
+			return jso_value_hash_bytes(hash, &dval, sizeof(dval));
+		}
+		case JSO_TYPE_STRING:
+			item_hash = jso_value_hash_string(JSO_STR_P(val));
+			return jso_value_hash_bytes(hash, &item_hash, sizeof(item_hash));
+		case JSO_TYPE_ARRAY: {
+			jso_value *item;
+			JSO_ARRAY_FOREACH(JSO_ARRVAL_P(val), item)
+			{
+				item_hash = jso_value_hash(item);
+				hash = jso_value_hash_bytes(hash, &item_hash, sizeof(item_hash));
+			}
+			JSO_ARRAY_FOREACH_END;
+			return hash;
+		}
+		case JSO_TYPE_OBJECT: {
+			/* members are summed so the result does not depend on the key order */
+			jso_uint32 members_hash = 0;
+			jso_string *key;
+			jso_value *item;
+			JSO_OBJECT_FOREACH(JSO_OBJVAL_P(val), key, item)
+			{
+				item_hash = jso_value_hash_mix(jso_value_hash(item));
+				members_hash += jso_value_hash_mix(jso_value_hash_string(key) ^ item_hash);
+			}
+			JSO_OBJECT_FOREACH_END;
+			return jso_value_hash_bytes(hash, &members_hash, sizeof(members_hash));
+		}
+		default:
+			return hash;
+	}
+}
+
 /* PRINTING */
 
 /* print indentation */
@@ -214,8 +305,8 @@ JSO_API void jso_value_dump_ex(jso_value *val, jso_io *io, jso_uint indent)
 			break;
 		case JSO_TYPE_STRING:
 			if (JSO_SVAL_P(val))
-				JSO_IO_PRINTF(
-						io, "STRING: \"%s\" ; LENGTH: %zu\n", JSO_SVAL_P(val), JSO_SLEN_P(val));
+				JSO_IO_PRINTF(io, "STRING: \"%.*s\" ; LENGTH: %zu\n", (int) JSO_SLEN_P(val),
+						JSO_SVAL_P(val), JSO_SLEN_P(val));
 			else
 				JSO_IO_PRINTF(io, "EMPTY STRING\n");
 			break;
@@ -244,7 +335,8 @@ JSO_API void jso_value_dump_ex(jso_value *val, jso_io *io, jso_uint indent)
 				JSO_IO_PRINTF(io, "ERROR: Pointer allocation failed\n");
 			} else {
 				jso_pointer *ptr = JSO_PTRVAL_P(val);
-				JSO_IO_PRINTF(io, "POINTER: %s\n", JSO_STRING_VAL(ptr->pointer_value));
+				JSO_IO_PRINTF(io, "POINTER: %.*s\n", (int) JSO_STRING_LEN(ptr->pointer_value),
+						(const char *) JSO_STRING_VAL(ptr->pointer_value));
 			}
 			break;
 		case JSO_TYPE_ERROR:
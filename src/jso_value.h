@@ -552,7 +552,7 @@ JSO_API void jso_value_free(jso_value *val);
  * Copy @ref jso_value instance.
  *
  * @param val instance of @ref jso_value
- * @return Copied @ref jso_value instance
+ * @return Copied @ref jso_value instance or NULL if the string allocation failed
  */
 JSO_API jso_value *jso_value_copy(jso_value *val);
 
@@ -581,6 +581,18 @@ JSO_API const char *jso_value_get_error_description(jso_value *val);
  */
 JSO_API jso_bool jso_value_equals(jso_value *val1, jso_value *val2);
 
+/**
+ * Compute structural hash of the value.
+ *
+ * The hash is consistent with @ref jso_value_equals so equal values always have
+ * the same hash. It means that the type is part of the hash (integer 1 and double 1.0
+ * differ), -0.0 and 0.0 hash the same and object hash does not depend on the key order.
+ *
+ * @param val value
+ * @return Value hash.
+ */
+JSO_API jso_uint32 jso_value_hash(jso_value *val);
+
 /**
  * Print indented debug output of the supplied value.
  *
@@ -150,7 +150,7 @@ static inline bool jso_virt_value_equals(jso_virt_value *vval, jso_value *val)
  * Get C string value of the string.
  *
  * @param str virtual string
- * @return C string value of the string
+ * @return C string value of the string (not NUL terminated if it is borrowed from the input)
  */
 static inline const char *jso_virt_string_val(jso_virt_string *str)
 {
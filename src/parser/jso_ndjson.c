@@ -0,0 +1,656 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "../jso_ndjson.h"
+#include "../jso.h"
+#include "../jso_simd.h"
+#include "../io/jso_io_string.h"
+
+#include <string.h>
+
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
+
+/* number of bytes requested from the IO when the record is not complete */
+#define JSO_NDJSON_READ_SIZE (64 * 1024)
+
+/* minimal arena block size of the batch */
+#define JSO_NDJSON_MIN_BLOCK_SIZE (16 * 1024)
+
+/**
+ * @brief Record with its position in the batch data.
+ */
+typedef struct _jso_ndjson_entry {
+	/** delivered record */
+	jso_ndjson_record record;
+	/** record offset in the batch data */
+	size_t offset;
+	/** record length */
+	size_t len;
+} jso_ndjson_entry;
+
+/**
+ * @brief Batch of records that is parsed by a single thread.
+ */
+typedef struct _jso_ndjson_batch {
+	/** copy of the records data with each record terminated by NUL character */
+	jso_ctype *buffer;
+	/** buffer size */
+	size_t buffer_size;
+	/** records */
+	jso_ndjson_entry *entries;
+	/** number of records */
+	size_t entries_count;
+	/** number of allocated records */
+	size_t entries_size;
+	/** arena holding the parsed records */
+	jso_arena *arena;
+	/** whether all records have been parsed */
+	jso_bool parsed;
+	/** failure if any record could not be parsed to value or error */
+	jso_rc rc;
+} jso_ndjson_batch;
+
+/**
+ * @brief Splitting state of the record that can be continued when more input is read.
+ */
+typedef struct _jso_ndjson_split {
+	/** scanned length of the record */
+	size_t pos;
+	/** number of newlines inside the record strings */
+	size_t lines;
+	/** whether the scanned part ends inside string */
+	jso_bool in_string;
+} jso_ndjson_split;
+
+/**
+ * @brief NDJSON reader state.
+ */
+typedef struct _jso_ndjson_reader {
+	/** input IO */
+	jso_io *io;
+	/** NDJSON options */
+	const jso_ndjson_options *options;
+	/** allocator used by all threads */
+	const jso_allocator *allocator;
+	/** allocator whose calls are serialized if it is not thread safe */
+	const jso_allocator *shared_allocator;
+	/** ring of batches */
+	jso_ndjson_batch *batches;
+	/** number of batches in the ring */
+	size_t batches_count;
+	/** number of input bytes after which the batch is finished */
+	size_t batch_size;
+	/** index of the next record */
+	size_t index;
+	/** line of the next record */
+	size_t line;
+	/** whether the whole input has been split */
+	jso_bool eof;
+	/** number of filled batches */
+	size_t filled;
+	/** number of delivered batches */
+	size_t delivered;
+	/** number of started threads */
+	size_t threads_count;
+#ifdef HAVE_PTHREAD_H
+	/** worker threads */
+	pthread_t *threads;
+	/** mutex guarding the batches state */
+	pthread_mutex_t mutex;
+	/** condition signaled when a batch is filled or the workers should finish */
+	pthread_cond_t work_cond;
+	/** condition signaled when a batch is parsed */
+	pthread_cond_t done_cond;
+	/** number of batches taken by the workers */
+	size_t taken;
+	/** whether the workers should finish */
+	jso_bool finished;
+	/** allocator serializing the shared allocator calls */
+	jso_allocator locked_allocator;
+	/** mutex guarding the shared allocator calls */
+	pthread_mutex_t allocator_mutex;
+	/** whether the locked allocator is used */
+	jso_bool allocator_locked;
+#endif
+} jso_ndjson_reader;
+
+JSO_API void jso_ndjson_options_init(jso_ndjson_options *options)
+{
+	jso_parser_options_init(&options->parser);
+	options->threads = 0;
+	options->thread_safe_allocator = JSO_FALSE;
+	options->max_pending_bytes = JSO_NDJSON_MAX_PENDING_BYTES;
+}
+
+/* scan the record until the newline that is not in string and return whether it was found */
+static jso_bool jso_ndjson_split_record(jso_ndjson_split *sp, const jso_ctype *str, size_t len)
+{
+	size_t pos = sp->pos;
+	const jso_ctype *nl = NULL;
+
+	while (pos < len) {
+		if (sp->in_string) {
+			pos += jso_simd_string_span(str + pos, len - pos);
+			if (pos == len) {
+				break;
+			}
+			if (str[pos] == '"') {
+				sp->in_string = JSO_FALSE;
+			} else if (str[pos] == '\\') {
+				/* the escaped character is not available yet */
+				if (pos + 1 == len) {
+					break;
+				}
+				++pos;
+			} else if (str[pos] == '\n') {
+				++sp->lines;
+			}
+			++pos;
+		} else {
+			/* the newline is looked up again only if it was inside the last string */
+			if (nl == NULL || nl < str + pos) {
+				nl = memchr(str + pos, '\n', len - pos);
+				if (nl == NULL) {
+					nl = str + len;
+				}
+			}
+			const jso_ctype *quote = memchr(str + pos, '"', (size_t) (nl - (str + pos)));
+			if (quote == NULL) {
+				pos = (size_t) (nl - str);
+				if (pos < len) {
+					sp->pos = pos;
+					return JSO_TRUE;
+				}
+				break;
+			}
+			sp->in_string = JSO_TRUE;
+			pos = (size_t) (quote - str) + 1;
+		}
+	}
+	sp->pos = pos;
+
+	return JSO_FALSE;
+}
+
+/* check whether the record contains only whitespaces */
+static jso_bool jso_ndjson_is_blank(const jso_ctype *str, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		if (str[i] != ' ' && str[i] != '\t' && str[i] != '\r') {
+			return JSO_FALSE;
+		}
+	}
+	return JSO_TRUE;
+}
+
+/* add record to the batch unless it is blank */
+static jso_rc jso_ndjson_batch_add(jso_ndjson_reader *reader, jso_ndjson_batch *batch,
+		const jso_ctype *data, size_t offset, size_t len)
+{
+	if (jso_ndjson_is_blank(data + offset, len)) {
+		return JSO_SUCCESS;
+	}
+	if (batch->entries_count == batch->entries_size) {
+		size_t size = batch->entries_size ? batch->entries_size * 2 : 64;
+		jso_ndjson_entry *entries = jso_realloc(batch->entries, size * sizeof(jso_ndjson_entry));
+		if (entries == NULL) {
+			return JSO_FAILURE;
+		}
+		batch->entries = entries;
+		batch->entries_size = size;
+	}
+	jso_ndjson_entry *entry = &batch->entries[batch->entries_count++];
+	entry->record.index = reader->index++;
+	entry->record.line = reader->line;
+	JSO_VALUE_SET_NULL(entry->record.value);
+	entry->offset = offset;
+	entry->len = len;
+
+	return JSO_SUCCESS;
+}
+
+/* split the input into the batch records until the batch size is reached */
+static jso_rc jso_ndjson_batch_fill(jso_ndjson_reader *reader, jso_ndjson_batch *batch)
+{
+	jso_io *io = reader->io;
+	jso_ndjson_split sp = { 0 };
+	size_t pos = 0;
+
+	while (pos < reader->batch_size) {
+		const jso_ctype *data = JSO_IO_CURSOR(io);
+		size_t avail = (size_t) (JSO_IO_LIMIT(io) - data);
+		if (jso_ndjson_split_record(&sp, data + pos, avail - pos)) {
+			if (jso_ndjson_batch_add(reader, batch, data, pos, sp.pos) == JSO_FAILURE) {
+				return JSO_FAILURE;
+			}
+			pos += sp.pos + 1;
+			reader->line += sp.lines + 1;
+			memset(&sp, 0, sizeof(sp));
+			continue;
+		}
+		/* the record is not complete so read more data (the buffer can be moved) */
+		if (JSO_IO_READ(io, avail + JSO_NDJSON_READ_SIZE) > avail) {
+			continue;
+		}
+		if (JSO_IO_BAD(io)) {
+			return JSO_FAILURE;
+		}
+		/* the last record does not have to end with newline */
+		reader->eof = JSO_TRUE;
+		data = JSO_IO_CURSOR(io);
+		avail = (size_t) (JSO_IO_LIMIT(io) - data);
+		if (pos < avail) {
+			if (jso_ndjson_batch_add(reader, batch, data, pos, avail - pos) == JSO_FAILURE) {
+				return JSO_FAILURE;
+			}
+			pos = avail;
+		}
+		break;
+	}
+
+	/* the records are copied so they can be terminated as the scanner expects */
+	if (pos + 1 > batch->buffer_size) {
+		jso_ctype *buffer = jso_realloc(batch->buffer, pos + 1);
+		if (buffer == NULL) {
+			return JSO_FAILURE;
+		}
+		batch->buffer = buffer;
+		batch->buffer_size = pos + 1;
+	}
+	memcpy(batch->buffer, JSO_IO_CURSOR(io), pos);
+	JSO_IO_CURSOR(io) += pos;
+	for (size_t i = 0; i < batch->entries_count; i++) {
+		jso_ndjson_entry *entry = &batch->entries[i];
+		batch->buffer[entry->offset + entry->len] = '\0';
+	}
+
+	return JSO_SUCCESS;
+}
+
+/* parse all batch records */
+static void jso_ndjson_batch_parse(
+		jso_ndjson_reader *reader, jso_ndjson_batch *batch, jso_schema *schema)
+{
+	jso_parser_options options = reader->options->parser;
+	options.allocator = reader->allocator;
+	options.arena = batch->arena;
+	options.schema = schema;
+
+	batch->rc = JSO_SUCCESS;
+	for (size_t i = 0; i < batch->entries_count; i++) {
+		jso_ndjson_entry *entry = &batch->entries[i];
+		jso_value *value = &entry->record.value;
+		if (jso_parse_cstr((const char *) batch->buffer + entry->offset, entry->len, &options,
+					value)
+				== JSO_SUCCESS) {
+			continue;
+		}
+		if (JSO_TYPE_P(value) != JSO_TYPE_ERROR || JSO_EVAL_P(value) == NULL) {
+			batch->rc = JSO_FAILURE;
+		} else if (JSO_ELOC_P(value).first_line > 0) {
+			/* the error location is in the whole input */
+			JSO_ELOC_P(value).first_line += entry->record.line - 1;
+			JSO_ELOC_P(value).last_line += entry->record.line - 1;
+		}
+	}
+}
+
+/* deliver the batch records in order and release their memory */
+static jso_rc jso_ndjson_batch_deliver(jso_ndjson_batch *batch, jso_ndjson_callback_t callback,
+		void *ctx, jso_bool *stopped)
+{
+	jso_rc rc = batch->rc;
+	if (rc == JSO_FAILURE) {
+		*stopped = JSO_TRUE;
+	}
+	for (size_t i = 0; i < batch->entries_count; i++) {
+		jso_ndjson_record *record = &batch->entries[i].record;
+		if (JSO_TYPE(record->value) == JSO_TYPE_ERROR) {
+			rc = JSO_FAILURE;
+		}
+		if (!*stopped && callback(ctx, record) == JSO_FAILURE) {
+			*stopped = JSO_TRUE;
+		}
+		jso_value_free(&record->value);
+	}
+	batch->entries_count = 0;
+	batch->parsed = JSO_FALSE;
+	jso_arena_clear(batch->arena);
+
+	return rc;
+}
+
+/* get the schema copy that holds the validation errors of a single thread */
+static jso_schema *jso_ndjson_schema_copy(jso_ndjson_reader *reader, jso_schema *copy)
+{
+	jso_schema *schema = reader->options->parser.schema;
+	if (schema == NULL) {
+		return NULL;
+	}
+	/*
+	 * the validation does not modify the schema values as the references are resolved and the
+	 * hashes of the looked up strings are computed when the schema is parsed, but the validation
+	 * error is set in the schema so each thread needs its own copy
+	 */
+	*copy = *schema;
+	copy->error.message = NULL;
+	copy->error.type = JSO_SCHEMA_ERROR_NONE;
+	copy->error.code = JSO_SCHEMA_ERROR_CODE_NONE;
+	copy->error.allocator = NULL;
+
+	return copy;
+}
+
+#ifdef HAVE_PTHREAD_H
+
+/* parse the filled batches until the reader is finished */
+static void *jso_ndjson_worker(void *arg)
+{
+	jso_ndjson_reader *reader = arg;
+	jso_schema schema_copy;
+	jso_schema *schema = jso_ndjson_schema_copy(reader, &schema_copy);
+	const jso_allocator *previous = jso_mm_enter(reader->allocator);
+
+	pthread_mutex_lock(&reader->mutex);
+	while (JSO_TRUE) {
+		while (!reader->finished && reader->taken == reader->filled) {
+			pthread_cond_wait(&reader->work_cond, &reader->mutex);
+		}
+		if (reader->finished) {
+			break;
+		}
+		jso_ndjson_batch *batch = &reader->batches[reader->taken++ % reader->batches_count];
+		pthread_mutex_unlock(&reader->mutex);
+		jso_ndjson_batch_parse(reader, batch, schema);
+		pthread_mutex_lock(&reader->mutex);
+		batch->parsed = JSO_TRUE;
+		pthread_cond_signal(&reader->done_cond);
+	}
+	pthread_mutex_unlock(&reader->mutex);
+
+	if (schema != NULL) {
+		jso_schema_error_clear(&schema->error);
+	}
+	jso_mm_leave(previous);
+
+	return NULL;
+}
+
+/* locked allocation callback */
+static void *jso_ndjson_locked_alloc(size_t size, void *ctx)
+{
+	jso_ndjson_reader *reader = ctx;
+	pthread_mutex_lock(&reader->allocator_mutex);
+	void *ptr = jso_allocator_malloc(reader->shared_allocator, size);
+	pthread_mutex_unlock(&reader->allocator_mutex);
+	return ptr;
+}
+
+/* locked reallocation callback */
+static void *jso_ndjson_locked_realloc(void *ptr, size_t size, void *ctx)
+{
+	jso_ndjson_reader *reader = ctx;
+	pthread_mutex_lock(&reader->allocator_mutex);
+	void *new_ptr = jso_allocator_realloc(reader->shared_allocator, ptr, size);
+	pthread_mutex_unlock(&reader->allocator_mutex);
+	return new_ptr;
+}
+
+/* locked freeing callback */
+static void jso_ndjson_locked_free(void *ptr, void *ctx)
+{
+	jso_ndjson_reader *reader = ctx;
+	pthread_mutex_lock(&reader->allocator_mutex);
+	jso_allocator_free(reader->shared_allocator, ptr);
+	pthread_mutex_unlock(&reader->allocator_mutex);
+}
+
+/* serialize the shared allocator calls of all threads if the allocator is not thread safe */
+static void jso_ndjson_allocator_lock(jso_ndjson_reader *reader)
+{
+	if (reader->options->thread_safe_allocator
+			|| reader->shared_allocator == jso_mm_get_default_allocator()) {
+		return;
+	}
+	pthread_mutex_init(&reader->allocator_mutex, NULL);
+	reader->locked_allocator.alloc = jso_ndjson_locked_alloc;
+	reader->locked_allocator.realloc = jso_ndjson_locked_realloc;
+	reader->locked_allocator.free = jso_ndjson_locked_free;
+	reader->locked_allocator.ctx = reader;
+	reader->allocator = &reader->locked_allocator;
+	reader->allocator_locked = JSO_TRUE;
+}
+
+/* start worker threads - the batches are parsed in the calling thread if none is started */
+static void jso_ndjson_threads_start(jso_ndjson_reader *reader, jso_uint threads)
+{
+	reader->threads = jso_malloc(threads * sizeof(pthread_t));
+	if (reader->threads == NULL) {
+		return;
+	}
+	pthread_mutex_init(&reader->mutex, NULL);
+	pthread_cond_init(&reader->work_cond, NULL);
+	pthread_cond_init(&reader->done_cond, NULL);
+	for (jso_uint i = 0; i < threads; i++) {
+		if (pthread_create(&reader->threads[i], NULL, jso_ndjson_worker, reader) != 0) {
+			break;
+		}
+		++reader->threads_count;
+	}
+}
+
+/* finish and join worker threads */
+static void jso_ndjson_threads_stop(jso_ndjson_reader *reader)
+{
+	if (reader->threads == NULL) {
+		return;
+	}
+	pthread_mutex_lock(&reader->mutex);
+	reader->finished = JSO_TRUE;
+	pthread_cond_broadcast(&reader->work_cond);
+	pthread_mutex_unlock(&reader->mutex);
+	for (size_t i = 0; i < reader->threads_count; i++) {
+		pthread_join(reader->threads[i], NULL);
+	}
+	pthread_cond_destroy(&reader->done_cond);
+	pthread_cond_destroy(&reader->work_cond);
+	pthread_mutex_destroy(&reader->mutex);
+	jso_free(reader->threads);
+}
+
+#endif /* HAVE_PTHREAD_H */
+
+/* pass the filled batch to the workers or parse it if there are no workers */
+static void jso_ndjson_batch_queue(
+		jso_ndjson_reader *reader, jso_ndjson_batch *batch, jso_schema *schema)
+{
+#ifdef HAVE_PTHREAD_H
+	if (reader->threads_count > 0) {
+		pthread_mutex_lock(&reader->mutex);
+		++reader->filled;
+		pthread_cond_signal(&reader->work_cond);
+		pthread_mutex_unlock(&reader->mutex);
+		return;
+	}
+#endif
+	jso_ndjson_batch_parse(reader, batch, schema);
+	batch->parsed = JSO_TRUE;
+	++reader->filled;
+}
+
+/* wait until the batch is parsed */
+static void jso_ndjson_batch_wait(jso_ndjson_reader *reader, jso_ndjson_batch *batch)
+{
+#ifdef HAVE_PTHREAD_H
+	if (reader->threads_count > 0) {
+		pthread_mutex_lock(&reader->mutex);
+		while (!batch->parsed) {
+			pthread_cond_wait(&reader->done_cond, &reader->mutex);
+		}
+		pthread_mutex_unlock(&reader->mutex);
+	}
+#endif
+}
+
+/* free the reader batches after stopping the workers */
+static void jso_ndjson_reader_clear(jso_ndjson_reader *reader)
+{
+#ifdef HAVE_PTHREAD_H
+	jso_ndjson_threads_stop(reader);
+#endif
+	for (size_t i = 0; i < reader->batches_count; i++) {
+		jso_ndjson_batch *batch = &reader->batches[i];
+		for (size_t j = 0; j < batch->entries_count; j++) {
+			jso_value_free(&batch->entries[j].record.value);
+		}
+		jso_free(batch->entries);
+		jso_free(batch->buffer);
+		if (batch->arena != NULL) {
+			jso_arena_free(batch->arena);
+		}
+	}
+	jso_free(reader->batches);
+#ifdef HAVE_PTHREAD_H
+	if (reader->allocator_locked) {
+		pthread_mutex_destroy(&reader->allocator_mutex);
+	}
+#endif
+}
+
+/* init reader with the batches ring that is large enough to keep all threads busy */
+static jso_rc jso_ndjson_reader_init(
+		jso_ndjson_reader *reader, jso_io *io, const jso_ndjson_options *options)
+{
+	size_t max_pending_bytes = options->max_pending_bytes > 0 ? options->max_pending_bytes
+															  : JSO_NDJSON_MAX_PENDING_BYTES;
+
+	memset(reader, 0, sizeof(jso_ndjson_reader));
+	reader->io = io;
+	reader->options = options;
+	reader->allocator = reader->shared_allocator = jso_mm_get_allocator();
+	reader->line = 1;
+#ifdef HAVE_PTHREAD_H
+	if (options->threads > 0) {
+		jso_ndjson_allocator_lock(reader);
+	}
+#endif
+	/* the batch arenas allocate their blocks from the reader allocator */
+	const jso_allocator *allocator = jso_mm_enter(reader->allocator);
+	reader->batches_count = options->threads > 0 ? (size_t) options->threads * 2 : 1;
+	reader->batch_size = JSO_MAX(max_pending_bytes / reader->batches_count, 1);
+	reader->batches = jso_calloc(reader->batches_count, sizeof(jso_ndjson_batch));
+	if (reader->batches == NULL) {
+		reader->batches_count = 0;
+		jso_ndjson_reader_clear(reader);
+		jso_mm_leave(allocator);
+		return JSO_FAILURE;
+	}
+	for (size_t i = 0; i < reader->batches_count; i++) {
+		reader->batches[i].arena
+				= jso_arena_alloc(JSO_MAX(reader->batch_size, JSO_NDJSON_MIN_BLOCK_SIZE));
+		if (reader->batches[i].arena == NULL) {
+			jso_ndjson_reader_clear(reader);
+			jso_mm_leave(allocator);
+			return JSO_FAILURE;
+		}
+	}
+#ifdef HAVE_PTHREAD_H
+	if (options->threads > 0) {
+		jso_ndjson_threads_start(reader, options->threads);
+	}
+#endif
+	jso_mm_leave(allocator);
+
+	return JSO_SUCCESS;
+}
+
+JSO_API jso_rc jso_ndjson_parse_io(jso_io *io, const jso_ndjson_options *options,
+		jso_ndjson_callback_t callback, void *ctx)
+{
+	jso_rc rc = JSO_SUCCESS;
+	jso_bool stopped = JSO_FALSE;
+	jso_ndjson_reader reader;
+	jso_schema schema_copy;
+	const jso_allocator *allocator = jso_mm_enter(options->parser.allocator);
+
+	if (jso_ndjson_reader_init(&reader, io, options) == JSO_FAILURE) {
+		jso_mm_leave(allocator);
+		return JSO_FAILURE;
+	}
+	/* the records are allocated and freed by the reader allocator */
+	const jso_allocator *reader_allocator = jso_mm_enter(reader.allocator);
+	/* the schema copy is used only if the batches are parsed in this thread */
+	jso_schema *schema = jso_ndjson_schema_copy(&reader, &schema_copy);
+
+	while (!stopped && (!reader.eof || reader.delivered < reader.filled)) {
+		jso_ndjson_batch *batch;
+		/* fill all free batches first so the workers do not wait for the delivery */
+		if (!reader.eof && reader.filled - reader.delivered < reader.batches_count) {
+			batch = &reader.batches[reader.filled % reader.batches_count];
+			if (jso_ndjson_batch_fill(&reader, batch) == JSO_FAILURE) {
+				rc = JSO_FAILURE;
+				break;
+			}
+			if (batch->entries_count > 0) {
+				jso_ndjson_batch_queue(&reader, batch, schema);
+			}
+			continue;
+		}
+		batch = &reader.batches[reader.delivered % reader.batches_count];
+		jso_ndjson_batch_wait(&reader, batch);
+		if (jso_ndjson_batch_deliver(batch, callback, ctx, &stopped) == JSO_FAILURE) {
+			rc = JSO_FAILURE;
+		}
+		++reader.delivered;
+	}
+	if (stopped) {
+		rc = JSO_FAILURE;
+	}
+
+	if (schema != NULL) {
+		jso_schema_error_clear(&schema->error);
+	}
+	jso_ndjson_reader_clear(&reader);
+	jso_mm_leave(reader_allocator);
+	jso_mm_leave(allocator);
+
+	return rc;
+}
+
+JSO_API jso_rc jso_ndjson_parse_cstr(const char *cstr, size_t len,
+		const jso_ndjson_options *options, jso_ndjson_callback_t callback, void *ctx)
+{
+	const jso_allocator *allocator = jso_mm_enter(options->parser.allocator);
+	jso_io *io = jso_io_string_open_from_cstr(cstr, len);
+	if (io == NULL) {
+		jso_mm_leave(allocator);
+		return JSO_FAILURE;
+	}
+	jso_rc rc = jso_ndjson_parse_io(io, options, callback, ctx);
+	JSO_IO_FREE(io);
+	jso_mm_leave(allocator);
+
+	return rc;
+}
@@ -22,6 +22,7 @@
  */
 
 #include "../jso_parser.h"
+#include "../jso_push_parser.tab.h"
 #include "../jso_parser_hooks.h"
 #include "../io/jso_io_string.h"
 
@@ -54,55 +55,400 @@ static const jso_parser_hooks *jso_parser_get_hooks(const jso_parser_options *op
 	return jso_parser_hooks_decode();
 }
 
-JSO_API jso_rc jso_parse_io(jso_io *io, const jso_parser_options *options, jso_value *result)
+/* init parser and its scanner from the options */
+static jso_rc jso_parser_init_from_options(jso_parser *parser, jso_io *io,
+		const jso_parser_options *options, jso_schema_validation_stream *schema_stream)
 {
-	jso_rc rc;
-	jso_parser parser;
-	jso_schema_validation_stream schema_stream;
-
 	/* init scanner */
-	jso_parser_init_ex(&parser, jso_parser_get_hooks(options));
-	jso_scanner_init(&parser.scanner, io);
+	jso_parser_init_ex(parser, jso_parser_get_hooks(options));
+	jso_scanner_init(&parser->scanner, io);
 
 	if (options->schema != NULL) {
-		parser.schema = options->schema;
-		parser.schema_stream = &schema_stream;
-		if (jso_schema_validation_stream_init(parser.schema, parser.schema_stream, 32)
+		parser->schema = options->schema;
+		parser->schema_stream = schema_stream;
+		if (jso_schema_validation_stream_init(parser->schema, parser->schema_stream, 32)
 				== JSO_FAILURE) {
+			jso_scanner_clear(&parser->scanner);
 			return JSO_FAILURE;
 		}
 	}
 
 	/* set max depth (0 = unlimited) */
-	parser.max_depth = options->max_depth;
+	parser->max_depth = options->max_depth;
+	parser->duplicate_keys = options->duplicate_keys;
 
-	/* parse */
-	if (jso_yyparse(&parser) == 0) {
-		rc = JSO_SUCCESS;
-	} else {
+	/* document memory is allocated from arena if set */
+	parser->arena = options->arena;
+	parser->scanner.arena = options->arena;
+	/* strings can be borrowed only if the buffer is not moved by reading */
+	parser->scanner.borrow_strings = options->borrow_strings && JSO_IO_WHOLE(io);
+
+	return JSO_SUCCESS;
+}
+
+/* move parser result or schema error to the result */
+static jso_rc jso_parser_result(jso_parser *parser, jso_rc rc, jso_value *result)
+{
+	if (parser->schema != NULL && jso_schema_error_is_set(parser->schema)) {
+		jso_value_clear(&parser->result);
+		JSO_VALUE_SET_ERROR_P(result, jso_error_new_from_schema(parser->schema));
 		rc = JSO_FAILURE;
+	} else {
+		*result = parser->result;
 	}
+	JSO_VALUE_SET_NULL(parser->result);
 
-	if (parser.schema != NULL && jso_schema_error_is_set(parser.schema)) {
-		jso_value_clear(&parser.result);
-		JSO_VALUE_SET_ERROR_P(result, jso_error_new_from_schema(parser.schema));
-		rc = JSO_FAILURE;
+	return rc;
+}
+
+/* reset parser for parsing the input again from the IO cursor */
+static jso_rc jso_parser_reset(jso_parser *parser)
+{
+	jso_scanner_reset(&parser->scanner);
+	parser->depth = 0;
+
+	if (parser->schema_stream != NULL) {
+		jso_schema_error_clear(JSO_SCHEMA_ERROR(parser->schema));
+		return jso_schema_validation_stream_reset(parser->schema_stream);
+	}
+
+	return JSO_SUCCESS;
+}
+
+/* parse the input by the engine from options and move the result */
+static jso_rc jso_parser_run(
+		jso_parser *parser, const jso_parser_options *options, jso_value *result)
+{
+	jso_rc rc = JSO_FAILURE;
+	jso_io *io = parser->scanner.io;
+	jso_ctype *start = JSO_IO_CURSOR(io);
+	jso_bool reparse = JSO_TRUE;
+
+	if (options->validate && parser->schema == NULL) {
+		rc = jso_validator_parse(parser);
+	} else if (options->engine == JSO_PARSER_ENGINE_STRUCTURAL) {
+		rc = jso_structural_parse(parser);
 	} else {
-		*result = parser.result;
+		reparse = JSO_FALSE;
+	}
+
+	if (rc == JSO_FAILURE && reparse) {
+		/* parse the input again from the start to find the error location */
+		JSO_IO_CURSOR(io) = start;
+		if (jso_parser_reset(parser) == JSO_FAILURE) {
+			return JSO_FAILURE;
+		}
+	}
+
+	if (rc == JSO_FAILURE) {
+		rc = jso_yyparse(parser) == 0 ? JSO_SUCCESS : JSO_FAILURE;
+	}
+
+	return jso_parser_result(parser, rc, result);
+}
+
+JSO_API jso_rc jso_parse_io(jso_io *io, const jso_parser_options *options, jso_value *result)
+{
+	jso_rc rc;
+	jso_parser parser;
+	jso_schema_validation_stream schema_stream;
+	const jso_allocator *allocator = jso_mm_enter(options->allocator);
+
+	if (jso_parser_init_from_options(&parser, io, options, &schema_stream) == JSO_FAILURE) {
+		jso_mm_leave(allocator);
+		return JSO_FAILURE;
 	}
 
+	rc = jso_parser_run(&parser, options, result);
+
 	if (parser.schema_stream != NULL) {
 		jso_schema_validation_stream_clear(parser.schema_stream);
 	}
 
+	jso_scanner_clear(&parser.scanner);
+	jso_mm_leave(allocator);
+
 	return rc;
 }
 
 JSO_API jso_rc jso_parse_cstr(
 		const char *cstr, size_t len, const jso_parser_options *options, jso_value *result)
 {
+	const jso_allocator *allocator = jso_mm_enter(options->allocator);
 	jso_io *io = jso_io_string_open_from_cstr(cstr, len);
 	jso_rc rc = jso_parse_io(io, options, result);
 	JSO_IO_FREE(io);
+	jso_mm_leave(allocator);
+	return rc;
+}
+
+JSO_API jso_parser_ctx *jso_parser_ctx_create(const jso_parser_options *options, jso_bool arena)
+{
+	const jso_allocator *allocator = jso_mm_enter(options->allocator);
+	jso_parser_ctx *ctx = jso_calloc(1, sizeof(jso_parser_ctx));
+	if (ctx == NULL) {
+		jso_mm_leave(allocator);
+		return NULL;
+	}
+
+	ctx->options = *options;
+	if (arena) {
+		ctx->arena = jso_arena_alloc(0);
+		if (ctx->arena == NULL) {
+			jso_free(ctx);
+			jso_mm_leave(allocator);
+			return NULL;
+		}
+		ctx->options.arena = ctx->arena;
+	}
+	/* the buffer always holds the whole document */
+	JSO_IO_WHOLE(&ctx->io) = JSO_TRUE;
+	if (jso_parser_init_from_options(&ctx->parser, &ctx->io, &ctx->options, &ctx->schema_stream)
+			== JSO_FAILURE) {
+		if (ctx->arena != NULL) {
+			jso_arena_free(ctx->arena);
+		}
+		jso_free(ctx);
+		jso_mm_leave(allocator);
+		return NULL;
+	}
+	ctx->allocator = jso_mm_get_allocator();
+
+	jso_mm_leave(allocator);
+
+	return ctx;
+}
+
+JSO_API jso_rc jso_parser_ctx_parse(
+		jso_parser_ctx *ctx, const char *buf, size_t len, jso_value *result)
+{
+	jso_rc rc;
+	const jso_allocator *allocator = jso_mm_enter(ctx->allocator);
+
+	/* the previous document is released with the arena */
+	if (ctx->arena != NULL) {
+		jso_arena_clear(ctx->arena);
+	}
+	jso_io_buffer_init(&ctx->io, (jso_ctype *) buf, len);
+	JSO_IO_LIMIT(&ctx->io) = (jso_ctype *) buf + len;
+
+	rc = jso_parser_reset(&ctx->parser);
+	if (rc == JSO_SUCCESS) {
+		rc = jso_parser_run(&ctx->parser, &ctx->options, result);
+	}
+
+	jso_mm_leave(allocator);
+
 	return rc;
 }
+
+JSO_API void jso_parser_ctx_free(jso_parser_ctx *ctx)
+{
+	const jso_allocator *allocator = jso_mm_enter(ctx->allocator);
+
+	if (ctx->parser.schema_stream != NULL) {
+		jso_schema_validation_stream_clear(ctx->parser.schema_stream);
+	}
+	jso_scanner_clear(&ctx->parser.scanner);
+	if (ctx->arena != NULL) {
+		jso_arena_free(ctx->arena);
+	}
+	jso_free(ctx);
+
+	jso_mm_leave(allocator);
+}
+
+JSO_API jso_push_parser *jso_push_parser_create(const jso_parser_options *options)
+{
+	const jso_allocator *allocator = jso_mm_enter(options->allocator);
+	jso_push_parser *pp = jso_calloc(1, sizeof(jso_push_parser));
+	if (pp == NULL) {
+		jso_mm_leave(allocator);
+		return NULL;
+	}
+
+	pp->pstate = jso_push_yypstate_new();
+	if (pp->pstate == NULL || jso_parser_init_from_options(
+			&pp->parser, &pp->io, options, &pp->schema_stream) == JSO_FAILURE) {
+		if (pp->pstate != NULL) {
+			jso_push_yypstate_delete(pp->pstate);
+		}
+		jso_free(pp);
+		jso_mm_leave(allocator);
+		return NULL;
+	}
+	pp->parser.scanner.partial = JSO_TRUE;
+	/* the chunks are not kept so the strings cannot be borrowed from them */
+	pp->parser.scanner.borrow_strings = JSO_FALSE;
+	pp->allocator = jso_mm_get_allocator();
+	pp->status = YYPUSH_MORE;
+
+	jso_mm_leave(allocator);
+
+	return pp;
+}
+
+/* make sure that the buffer can hold the pending input, size characters and the sentinel */
+static jso_rc jso_push_parser_buffer_reserve(jso_push_parser *pp, size_t size)
+{
+	size_t needed = pp->buffer_len + size + 1;
+	if (needed <= pp->buffer_size) {
+		return JSO_SUCCESS;
+	}
+
+	size_t buffer_size = pp->buffer_size ? pp->buffer_size : JSO_PUSH_PARSER_FILL_SIZE * 4;
+	while (buffer_size < needed) {
+		buffer_size *= 2;
+	}
+	jso_ctype *buffer = jso_realloc(pp->buffer, buffer_size);
+	if (buffer == NULL) {
+		JSO_VALUE_SET_ERROR(pp->parser.result,
+				jso_error_new_ex(JSO_ERROR_ALLOC, &pp->parser.scanner.loc));
+		/* bison status of the memory exhaustion */
+		pp->status = 2;
+		return JSO_FAILURE;
+	}
+	if (pp->buffer_len > 0) {
+		jso_scanner_move_pending(&pp->parser.scanner, buffer);
+	}
+	pp->buffer = buffer;
+	pp->buffer_size = buffer_size;
+
+	return JSO_SUCCESS;
+}
+
+/* push the scanned tokens to the parser until the input is exhausted or the parsing ends */
+static jso_rc jso_push_parser_run(jso_push_parser *pp)
+{
+	jso_scanner *s = &pp->parser.scanner;
+	JSO_PUSH_YYSTYPE value;
+	JSO_PUSH_YYLTYPE location;
+
+	do {
+		int token = jso_scan(s);
+		if (token == JSO_T_NEED_MORE) {
+			return JSO_SUCCESS;
+		}
+		value.value = s->value;
+		location.first_column = JSO_SCANNER_LOCATION(*s, first_column);
+		location.first_line = JSO_SCANNER_LOCATION(*s, first_line);
+		location.last_column = JSO_SCANNER_LOCATION(*s, last_column);
+		location.last_line = JSO_SCANNER_LOCATION(*s, last_line);
+		pp->status = jso_push_yypush_parse(pp->pstate, token, &value, &location, &pp->parser);
+	} while (pp->status == YYPUSH_MORE);
+
+	return pp->status == 0 ? JSO_SUCCESS : JSO_FAILURE;
+}
+
+JSO_API jso_rc jso_push_parser_feed(jso_push_parser *pp, const char *buf, size_t len)
+{
+	jso_scanner *s = &pp->parser.scanner;
+	jso_ctype *pos = (jso_ctype *) buf, *end = pos + len;
+
+	if (pp->status != YYPUSH_MORE) {
+		return JSO_FAILURE;
+	}
+
+	const jso_allocator *allocator = jso_mm_enter(pp->allocator);
+
+	while (pos < end) {
+		/* start of the chunk part that is copied to the buffer */
+		jso_ctype *copied = NULL;
+
+		if (pp->buffer_len == 0) {
+			/* there is no pending input so the chunk is scanned in place */
+			jso_scanner_move_pending(s, pos);
+			pos = end;
+		} else {
+			/* copy just enough of the chunk to complete the pending token */
+			size_t size = pp->buffer_len > JSO_PUSH_PARSER_FILL_SIZE ? pp->buffer_len
+																	 : JSO_PUSH_PARSER_FILL_SIZE;
+			if (size > (size_t) (end - pos)) {
+				size = (size_t) (end - pos);
+			}
+			if (jso_push_parser_buffer_reserve(pp, size) == JSO_FAILURE) {
+				break;
+			}
+			copied = pp->buffer + pp->buffer_len;
+			memcpy(copied, pos, size);
+			pp->buffer_len += size;
+			pos += size;
+		}
+		JSO_IO_LIMIT(&pp->io) = copied == NULL ? end : pp->buffer + pp->buffer_len;
+
+		if (jso_push_parser_run(pp) == JSO_FAILURE || pp->status != YYPUSH_MORE) {
+			break;
+		}
+
+		jso_ctype *pending = jso_scanner_get_pending(s);
+		size_t pending_len = (size_t) (JSO_IO_LIMIT(&pp->io) - pending);
+		if (copied != NULL && pending >= copied && pos < end) {
+			/* the pending token starts in the copied part so the rest is scanned in place */
+			pos -= pending_len;
+			pp->buffer_len = 0;
+			jso_scanner_move_pending(s, pos);
+		} else if (copied == NULL) {
+			/* keep the pending token that is completed by the next chunk */
+			pp->buffer_len = 0;
+			if (jso_push_parser_buffer_reserve(pp, pending_len) == JSO_FAILURE) {
+				break;
+			}
+			memcpy(pp->buffer, pending, pending_len);
+			pp->buffer_len = pending_len;
+			jso_scanner_move_pending(s, pp->buffer);
+		} else {
+			/* drop the consumed part of the buffer */
+			memmove(pp->buffer, pending, pending_len);
+			pp->buffer_len = pending_len;
+			jso_scanner_move_pending(s, pp->buffer);
+		}
+	}
+
+	jso_mm_leave(allocator);
+
+	return pp->status == YYPUSH_MORE ? JSO_SUCCESS : JSO_FAILURE;
+}
+
+JSO_API jso_rc jso_push_parser_finish(jso_push_parser *pp, jso_value *result)
+{
+	const jso_allocator *allocator = jso_mm_enter(pp->allocator);
+
+	/* the rest of the input is terminated by the sentinel and scanned as the final part */
+	if (pp->status == YYPUSH_MORE && jso_push_parser_buffer_reserve(pp, 0) == JSO_SUCCESS) {
+		jso_scanner_move_pending(&pp->parser.scanner, pp->buffer);
+		pp->buffer[pp->buffer_len] = 0;
+		JSO_IO_LIMIT(&pp->io) = pp->buffer + pp->buffer_len;
+		pp->parser.scanner.partial = JSO_FALSE;
+		jso_push_parser_run(pp);
+	}
+
+	jso_rc rc = jso_parser_result(&pp->parser, pp->status == 0 ? JSO_SUCCESS : JSO_FAILURE, result);
+
+	jso_mm_leave(allocator);
+
+	return rc;
+}
+
+JSO_API void jso_push_parser_free(jso_push_parser *pp)
+{
+	const jso_allocator *allocator = jso_mm_enter(pp->allocator);
+
+	if (pp->status == YYPUSH_MORE) {
+		/* the unexpected end releases values on the parser stack */
+		JSO_PUSH_YYSTYPE value;
+		JSO_PUSH_YYLTYPE location = { 0 };
+		JSO_VALUE_SET_NULL(value.value);
+		jso_push_yypush_parse(pp->pstate, JSO_PUSH_YYEOF, &value, &location, &pp->parser);
+	}
+	jso_value_clear(&pp->parser.result);
+	jso_push_yypstate_delete(pp->pstate);
+
+	if (pp->parser.schema_stream != NULL) {
+		jso_schema_validation_stream_clear(pp->parser.schema_stream);
+	}
+	jso_scanner_clear(&pp->parser.scanner);
+	jso_free(pp->buffer);
+	jso_free(pp);
+
+	jso_mm_leave(allocator);
+}
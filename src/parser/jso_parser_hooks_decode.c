@@ -28,10 +28,15 @@
 
 jso_error_type jso_parser_decode_array_create(jso_parser *parser, jso_array **array)
 {
+	const jso_allocator *allocator = jso_arena_enter(parser->arena);
 	jso_array *arr = jso_array_alloc();
+	jso_arena_leave(allocator);
 	if (arr == NULL) {
 		return JSO_ERROR_ALLOC;
 	}
+	if (parser->arena != NULL) {
+		JSO_ARRAY_FLAGS(arr) |= JSO_ARRAY_FLAG_ARENA;
+	}
 	*array = arr;
 	return JSO_ERROR_NONE;
 }
@@ -39,23 +44,92 @@ jso_error_type jso_parser_decode_array_create(jso_parser *parser, jso_array **ar
 jso_error_type jso_parser_decode_array_append(
 		jso_parser *parser, jso_array *array, jso_value *value)
 {
-	return jso_array_append(array, value) == JSO_FAILURE ? JSO_ERROR_ALLOC : JSO_ERROR_NONE;
+	const jso_allocator *allocator = jso_arena_enter(parser->arena);
+	jso_rc rc = jso_array_append(array, value);
+	jso_arena_leave(allocator);
+
+	return rc == JSO_FAILURE ? JSO_ERROR_ALLOC : JSO_ERROR_NONE;
 }
 
 jso_error_type jso_parser_decode_object_create(jso_parser *parser, jso_object **object)
 {
+	const jso_allocator *allocator = jso_arena_enter(parser->arena);
 	jso_object *obj = jso_object_alloc();
+	jso_arena_leave(allocator);
 	if (obj == NULL) {
 		return JSO_ERROR_ALLOC;
 	}
+	if (parser->arena != NULL) {
+		JSO_OBJECT_FLAGS(obj) |= JSO_OBJECT_FLAG_ARENA;
+	}
 	*object = obj;
 	return JSO_ERROR_NONE;
 }
 
+/* collect value of the duplicate key to the array replacing the existing value */
+static jso_rc jso_parser_decode_collect_duplicate(
+		jso_parser *parser, jso_value *existing, jso_value *value)
+{
+	if (JSO_TYPE_P(existing) != JSO_TYPE_ARRAY
+			|| !(JSO_ARRAY_FLAGS(JSO_ARRVAL_P(existing)) & JSO_ARRAY_FLAG_DUPLICATES)) {
+		jso_array *arr = jso_array_alloc();
+		if (arr == NULL || jso_array_append(arr, existing) == JSO_FAILURE) {
+			jso_array_free(arr);
+			return JSO_FAILURE;
+		}
+		JSO_ARRAY_FLAGS(arr) |= JSO_ARRAY_FLAG_DUPLICATES;
+		if (parser->arena != NULL) {
+			JSO_ARRAY_FLAGS(arr) |= JSO_ARRAY_FLAG_ARENA;
+		}
+		JSO_VALUE_SET_ARRAY(*existing, arr);
+	}
+	return jso_array_append(JSO_ARRVAL_P(existing), value);
+}
+
+jso_error_type jso_parser_decode_object_add(
+		jso_parser *parser, jso_object *object, jso_string *key, jso_value *value)
+{
+	jso_value *existing;
+	const jso_allocator *allocator = jso_arena_enter(parser->arena);
+	jso_rc rc = jso_object_add_new(object, key, value, &existing);
+	if (rc == JSO_FAILURE || existing == NULL) {
+		jso_arena_leave(allocator);
+		return rc == JSO_FAILURE ? JSO_ERROR_ALLOC : JSO_ERROR_NONE;
+	}
+
+	jso_error_type error_type = JSO_ERROR_NONE;
+	switch (parser->duplicate_keys) {
+		case JSO_PARSER_DUPLICATE_KEYS_LAST_WINS:
+			/* the key keeps its original position in the object */
+			jso_value_clear(existing);
+			*existing = *value;
+			jso_string_free(key);
+			break;
+		case JSO_PARSER_DUPLICATE_KEYS_FIRST_WINS:
+			jso_value_clear(value);
+			jso_string_free(key);
+			break;
+		case JSO_PARSER_DUPLICATE_KEYS_ERROR:
+			/* the key and value are freed by the parser */
+			error_type = JSO_ERROR_DUPLICATE_KEY;
+			break;
+		case JSO_PARSER_DUPLICATE_KEYS_COLLECT:
+			if (jso_parser_decode_collect_duplicate(parser, existing, value) == JSO_FAILURE) {
+				error_type = JSO_ERROR_ALLOC;
+			} else {
+				jso_string_free(key);
+			}
+			break;
+	}
+	jso_arena_leave(allocator);
+
+	return error_type;
+}
+
 jso_error_type jso_parser_decode_object_update(
 		jso_parser *parser, jso_object *object, jso_string *key, jso_value *value)
 {
-	return jso_object_add(object, key, value) == JSO_FAILURE ? JSO_ERROR_ALLOC : JSO_ERROR_NONE;
+	return jso_parser_decode_object_add(parser, object, key, value);
 }
 
 static const jso_parser_hooks parser_hooks = {
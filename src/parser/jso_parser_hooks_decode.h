@@ -35,6 +35,18 @@ jso_error_type jso_parser_decode_array_create(jso_parser *parser, jso_array **ar
 jso_error_type jso_parser_decode_array_append(
 		jso_parser *parser, jso_array *array, jso_value *value);
 jso_error_type jso_parser_decode_object_create(jso_parser *parser, jso_object **object);
+/**
+ * Add the key and value to the object applying the parser policy for the duplicate keys.
+ *
+ * @param parser parser
+ * @param object object to update
+ * @param key key of the value
+ * @param value value to add
+ * @return @ref JSO_ERROR_NONE on success, otherwise the error type. The key and value are not
+ * owned by the object on error.
+ */
+jso_error_type jso_parser_decode_object_add(
+		jso_parser *parser, jso_object *object, jso_string *key, jso_value *value);
 jso_error_type jso_parser_decode_object_update(
 		jso_parser *parser, jso_object *object, jso_string *key, jso_value *value);
 
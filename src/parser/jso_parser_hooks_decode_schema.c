@@ -28,10 +28,15 @@
 
 jso_error_type jso_parser_decode_schema_array_create(jso_parser *parser, jso_array **array)
 {
+	const jso_allocator *allocator = jso_arena_enter(parser->arena);
 	jso_array *arr = jso_array_alloc();
+	jso_arena_leave(allocator);
 	if (arr == NULL) {
 		return JSO_ERROR_ALLOC;
 	}
+	if (parser->arena != NULL) {
+		JSO_ARRAY_FLAGS(arr) |= JSO_ARRAY_FLAG_ARENA;
+	}
 	*array = arr;
 	return JSO_ERROR_NONE;
 }
@@ -45,7 +50,11 @@ jso_error_type jso_parser_decode_schema_array_append(
 		return JSO_ERROR_SCHEMA;
 	}
 
-	return jso_array_append(array, value) == JSO_FAILURE ? JSO_ERROR_ALLOC : JSO_ERROR_NONE;
+	const jso_allocator *allocator = jso_arena_enter(parser->arena);
+	jso_rc rc = jso_array_append(array, value);
+	jso_arena_leave(allocator);
+
+	return rc == JSO_FAILURE ? JSO_ERROR_ALLOC : JSO_ERROR_NONE;
 }
 
 jso_error_type jso_parser_decode_schema_array_start(jso_parser *parser)
@@ -65,10 +74,15 @@ jso_error_type jso_parser_decode_schema_array_end(jso_parser *parser)
 
 jso_error_type jso_parser_decode_schema_object_create(jso_parser *parser, jso_object **object)
 {
+	const jso_allocator *allocator = jso_arena_enter(parser->arena);
 	jso_object *obj = jso_object_alloc();
+	jso_arena_leave(allocator);
 	if (obj == NULL) {
 		return JSO_ERROR_ALLOC;
 	}
+	if (parser->arena != NULL) {
+		JSO_OBJECT_FLAGS(obj) |= JSO_OBJECT_FLAG_ARENA;
+	}
 	*object = obj;
 	return JSO_ERROR_NONE;
 }
@@ -83,7 +97,7 @@ jso_error_type jso_parser_decode_schema_object_update(
 		return JSO_ERROR_SCHEMA;
 	}
 
-	return jso_object_add(object, key, value) == JSO_FAILURE ? JSO_ERROR_ALLOC : JSO_ERROR_NONE;
+	return jso_parser_decode_object_add(parser, object, key, value);
 }
 
 jso_error_type jso_parser_decode_schema_object_start(jso_parser *parser)
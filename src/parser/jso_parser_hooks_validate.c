@@ -35,6 +35,8 @@ jso_error_type jso_parser_validate_array_create(jso_parser *parser, jso_array **
 jso_error_type jso_parser_validate_array_append(
 		jso_parser *parser, jso_array *array, jso_value *value)
 {
+	/* the value is owned by the hook */
+	jso_value_clear(value);
 	return JSO_ERROR_NONE;
 }
 
@@ -47,6 +49,9 @@ jso_error_type jso_parser_validate_object_create(jso_parser *parser, jso_object
 jso_error_type jso_parser_validate_object_update(
 		jso_parser *parser, jso_object *object, jso_string *key, jso_value *value)
 {
+	/* the key and value are owned by the hook */
+	jso_string_free(key);
+	jso_value_clear(value);
 	return JSO_ERROR_NONE;
 }
 
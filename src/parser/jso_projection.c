@@ -0,0 +1,387 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "../jso_parser.h"
+#include "../jso_pointer.h"
+#include "../jso_sax.h"
+#include "../io/jso_io_string.h"
+
+#include <string.h>
+
+/**
+ * @brief Action for the value found on the current path.
+ */
+typedef enum {
+	/** no pointer goes through the value */
+	JSO_PROJECTION_SKIP,
+	/** some pointers continue in the value */
+	JSO_PROJECTION_DESCEND,
+	/** some pointer ends in the value so it is fully decoded */
+	JSO_PROJECTION_DECODE
+} jso_projection_action;
+
+/**
+ * @brief Open container of the sparse tree.
+ */
+typedef struct _jso_projection_level {
+	/** container value */
+	jso_value value;
+	/** key of the current member */
+	jso_string *key;
+	/** index of the next element */
+	size_t index;
+} jso_projection_level;
+
+/**
+ * @brief Projection state.
+ */
+typedef struct _jso_projection {
+	/** requested pointers */
+	jso_pointer **pointers;
+	/** number of requested pointers */
+	size_t pointers_count;
+	/** number of tokens of each pointer that match the current path */
+	size_t *matched;
+	/** stack of the open containers */
+	jso_projection_level *levels;
+	/** number of the open containers */
+	size_t levels_count;
+	/** capacity of the containers stack */
+	size_t levels_size;
+	/** number of open containers when the full decoding started or 0 */
+	size_t decode_depth;
+	/** action for the next value */
+	jso_projection_action action;
+	/** whether an allocation failed */
+	jso_bool alloc_failed;
+	/** result value */
+	jso_value result;
+} jso_projection;
+
+/* check whether the key matches the pointer token */
+static inline jso_bool jso_projection_key_matches(
+		jso_string *token, const jso_ctype *key, size_t len)
+{
+	return JSO_STRING_LEN(token) == len && !memcmp(JSO_STRING_VAL(token), key, len);
+}
+
+/* check whether the array index matches the pointer token */
+static inline jso_bool jso_projection_index_matches(jso_string *token, size_t index)
+{
+	jso_int token_index;
+	return jso_string_to_int(token, &token_index) == JSO_SUCCESS && token_index >= 0
+			&& (size_t) token_index == index;
+}
+
+/* match the member key or the element index of the current container with the pointers */
+static jso_projection_action jso_projection_match(
+		jso_projection *proj, const jso_ctype *key, size_t len, size_t index)
+{
+	size_t depth = proj->levels_count - 1;
+	jso_projection_action action = JSO_PROJECTION_SKIP;
+
+	if (proj->decode_depth) {
+		return JSO_PROJECTION_DECODE;
+	}
+
+	for (size_t i = 0; i < proj->pointers_count; i++) {
+		jso_pointer *jp = proj->pointers[i];
+		/* the pointers that matched the previous sibling are matched again */
+		if (proj->matched[i] > depth) {
+			proj->matched[i] = depth;
+		}
+		if (proj->matched[i] < depth || jp->tokens_count <= depth) {
+			continue;
+		}
+		jso_string *token = jp->tokens[depth];
+		if (key != NULL ? jso_projection_key_matches(token, key, len)
+						: jso_projection_index_matches(token, index)) {
+			proj->matched[i] = depth + 1;
+			if (jp->tokens_count == depth + 1) {
+				action = JSO_PROJECTION_DECODE;
+			} else if (action == JSO_PROJECTION_SKIP) {
+				action = JSO_PROJECTION_DESCEND;
+			}
+		}
+	}
+
+	return action;
+}
+
+/* add the complete value to the current container or set it as a result */
+static jso_sax_action jso_projection_add(jso_projection *proj, jso_value *value)
+{
+	if (proj->levels_count == 0) {
+		proj->result = *value;
+		return JSO_SAX_CONTINUE;
+	}
+
+	jso_projection_level *level = &proj->levels[proj->levels_count - 1];
+	if (JSO_TYPE(level->value) == JSO_TYPE_OBJECT) {
+		if (jso_object_add(JSO_OBJVAL(level->value), level->key, value) == JSO_SUCCESS) {
+			level->key = NULL;
+			return JSO_SAX_CONTINUE;
+		}
+	} else {
+		/* the skipped elements are replaced with null to preserve the indexes */
+		jso_array *arr = JSO_ARRVAL(level->value);
+		jso_value null_value;
+		JSO_VALUE_SET_NULL(null_value);
+		while (JSO_ARRAY_LEN(arr) + 1 < level->index) {
+			if (jso_array_append(arr, &null_value) == JSO_FAILURE) {
+				break;
+			}
+		}
+		if (JSO_ARRAY_LEN(arr) + 1 == level->index && jso_array_append(arr, value) == JSO_SUCCESS) {
+			return JSO_SAX_CONTINUE;
+		}
+	}
+
+	jso_value_clear(value);
+	proj->alloc_failed = JSO_TRUE;
+	return JSO_SAX_ABORT;
+}
+
+/* get the action for the next array element or for the root value */
+static jso_projection_action jso_projection_value_action(jso_projection *proj)
+{
+	if (proj->levels_count == 0) {
+		return JSO_PROJECTION_DESCEND;
+	}
+	jso_projection_level *level = &proj->levels[proj->levels_count - 1];
+	if (JSO_TYPE(level->value) == JSO_TYPE_ARRAY) {
+		return jso_projection_match(proj, NULL, 0, level->index++);
+	}
+	return proj->action;
+}
+
+/* add the scalar value if it is on the path */
+static jso_sax_action jso_projection_scalar(jso_projection *proj, jso_value *value)
+{
+	if (jso_projection_value_action(proj) == JSO_PROJECTION_SKIP) {
+		return JSO_SAX_CONTINUE;
+	}
+	return jso_projection_add(proj, value);
+}
+
+/* open the container if it is on the path */
+static jso_sax_action jso_projection_container_start(jso_projection *proj, jso_bool is_object)
+{
+	jso_projection_action action = jso_projection_value_action(proj);
+	if (action == JSO_PROJECTION_SKIP) {
+		return JSO_SAX_SKIP;
+	}
+
+	if (proj->levels_count == proj->levels_size) {
+		size_t levels_size = proj->levels_size ? proj->levels_size * 2 : 16;
+		jso_projection_level *levels
+				= jso_realloc(proj->levels, levels_size * sizeof(jso_projection_level));
+		if (levels == NULL) {
+			proj->alloc_failed = JSO_TRUE;
+			return JSO_SAX_ABORT;
+		}
+		proj->levels = levels;
+		proj->levels_size = levels_size;
+	}
+
+	jso_projection_level *level = &proj->levels[proj->levels_count];
+	if (is_object) {
+		jso_object *obj = jso_object_alloc();
+		if (obj == NULL) {
+			proj->alloc_failed = JSO_TRUE;
+			return JSO_SAX_ABORT;
+		}
+		JSO_VALUE_SET_OBJECT(level->value, obj);
+	} else {
+		jso_array *arr = jso_array_alloc();
+		if (arr == NULL) {
+			proj->alloc_failed = JSO_TRUE;
+			return JSO_SAX_ABORT;
+		}
+		JSO_VALUE_SET_ARRAY(level->value, arr);
+	}
+	level->key = NULL;
+	level->index = 0;
+	++proj->levels_count;
+	if (action == JSO_PROJECTION_DECODE && proj->decode_depth == 0) {
+		proj->decode_depth = proj->levels_count;
+	}
+
+	return JSO_SAX_CONTINUE;
+}
+
+/* close the container and add it to its parent */
+static jso_sax_action jso_projection_container_end(jso_projection *proj)
+{
+	jso_projection_level *level = &proj->levels[--proj->levels_count];
+	if (proj->decode_depth > proj->levels_count) {
+		proj->decode_depth = 0;
+	}
+	return jso_projection_add(proj, &level->value);
+}
+
+static jso_sax_action jso_projection_object_start(void *ctx)
+{
+	return jso_projection_container_start(ctx, JSO_TRUE);
+}
+
+static jso_sax_action jso_projection_object_key(void *ctx, const jso_ctype *key, size_t len)
+{
+	jso_projection *proj = ctx;
+	proj->action = jso_projection_match(proj, key, len, 0);
+	if (proj->action == JSO_PROJECTION_SKIP) {
+		return JSO_SAX_SKIP;
+	}
+
+	jso_string *str = jso_string_create_from_cstr_len((const char *) key, len);
+	if (str == NULL) {
+		proj->alloc_failed = JSO_TRUE;
+		return JSO_SAX_ABORT;
+	}
+	proj->levels[proj->levels_count - 1].key = str;
+
+	return JSO_SAX_CONTINUE;
+}
+
+static jso_sax_action jso_projection_array_start(void *ctx)
+{
+	return jso_projection_container_start(ctx, JSO_FALSE);
+}
+
+static jso_sax_action jso_projection_end(void *ctx)
+{
+	return jso_projection_container_end(ctx);
+}
+
+static jso_sax_action jso_projection_null_value(void *ctx)
+{
+	jso_value value;
+	JSO_VALUE_SET_NULL(value);
+	return jso_projection_scalar(ctx, &value);
+}
+
+static jso_sax_action jso_projection_bool_value(void *ctx, jso_bool bval)
+{
+	jso_value value;
+	JSO_VALUE_SET_BOOL(value, bval);
+	return jso_projection_scalar(ctx, &value);
+}
+
+static jso_sax_action jso_projection_int_value(void *ctx, jso_int ival)
+{
+	jso_value value;
+	JSO_VALUE_SET_INT(value, ival);
+	return jso_projection_scalar(ctx, &value);
+}
+
+static jso_sax_action jso_projection_double_value(void *ctx, jso_double dval)
+{
+	jso_value value;
+	JSO_VALUE_SET_DOUBLE(value, dval);
+	return jso_projection_scalar(ctx, &value);
+}
+
+static jso_sax_action jso_projection_string_value(void *ctx, const jso_ctype *str, size_t len)
+{
+	jso_projection *proj = ctx;
+	if (jso_projection_value_action(proj) == JSO_PROJECTION_SKIP) {
+		return JSO_SAX_CONTINUE;
+	}
+
+	jso_value value;
+	jso_string *sval = jso_string_create_from_cstr_len((const char *) str, len);
+	if (sval == NULL) {
+		proj->alloc_failed = JSO_TRUE;
+		return JSO_SAX_ABORT;
+	}
+	JSO_VALUE_SET_STRING(value, sval);
+
+	return jso_projection_add(proj, &value);
+}
+
+static const jso_sax_callbacks jso_projection_callbacks = {
+	.object_start = jso_projection_object_start,
+	.object_key = jso_projection_object_key,
+	.object_end = jso_projection_end,
+	.array_start = jso_projection_array_start,
+	.array_end = jso_projection_end,
+	.null_value = jso_projection_null_value,
+	.bool_value = jso_projection_bool_value,
+	.int_value = jso_projection_int_value,
+	.double_value = jso_projection_double_value,
+	.string_value = jso_projection_string_value,
+};
+
+JSO_API jso_rc jso_parse_projection_io(jso_io *io, jso_pointer **pointers, size_t pointers_count,
+		const jso_parser_options *options, jso_value *result)
+{
+	jso_rc rc;
+	jso_projection proj;
+	const jso_allocator *allocator = jso_mm_enter(options->allocator);
+
+	memset(&proj, 0, sizeof(jso_projection));
+	JSO_VALUE_SET_NULL(proj.result);
+	proj.pointers = pointers;
+	proj.pointers_count = pointers_count;
+	proj.matched = jso_calloc(pointers_count ? pointers_count : 1, sizeof(size_t));
+	if (proj.matched == NULL) {
+		jso_mm_leave(allocator);
+		return JSO_FAILURE;
+	}
+
+	rc = jso_sax_parse_io(io, &jso_projection_callbacks, &proj, options, result);
+	if (rc == JSO_SUCCESS) {
+		*result = proj.result;
+	} else {
+		/* release the partially built tree */
+		jso_value_clear(&proj.result);
+		while (proj.levels_count > 0) {
+			jso_projection_level *level = &proj.levels[--proj.levels_count];
+			jso_value_clear(&level->value);
+			if (level->key != NULL) {
+				jso_string_free(level->key);
+			}
+		}
+		if (proj.alloc_failed) {
+			JSO_ASSERT_EQ(JSO_EVAL_P(result)->type, JSO_ERROR_ABORT);
+			JSO_EVAL_P(result)->type = JSO_ERROR_ALLOC;
+		}
+	}
+
+	jso_free(proj.levels);
+	jso_free(proj.matched);
+	jso_mm_leave(allocator);
+
+	return rc;
+}
+
+JSO_API jso_rc jso_parse_projection_cstr(const char *cstr, size_t len, jso_pointer **pointers,
+		size_t pointers_count, const jso_parser_options *options, jso_value *result)
+{
+	const jso_allocator *allocator = jso_mm_enter(options->allocator);
+	jso_io *io = jso_io_string_open_from_cstr(cstr, len);
+	jso_rc rc = jso_parse_projection_io(io, pointers, pointers_count, options, result);
+	JSO_IO_FREE(io);
+	jso_mm_leave(allocator);
+	return rc;
+}
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "../jso_sax.h"
+#include "../jso_parser.tab.h"
+#include "../io/jso_io_string.h"
+
+#define JSO_SAX_CALL(_name, ...) \
+	(callbacks->_name != NULL ? callbacks->_name(ctx, __VA_ARGS__) : JSO_SAX_CONTINUE)
+
+#define JSO_SAX_CALL_0(_name) \
+	(callbacks->_name != NULL ? callbacks->_name(ctx) : JSO_SAX_CONTINUE)
+
+/**
+ * @brief Expected token class.
+ */
+typedef enum {
+	JSO_SAX_EXPECT_VALUE,
+	JSO_SAX_EXPECT_FIRST_VALUE,
+	JSO_SAX_EXPECT_KEY,
+	JSO_SAX_EXPECT_FIRST_KEY,
+	JSO_SAX_EXPECT_COLON,
+	JSO_SAX_EXPECT_NEXT,
+	JSO_SAX_EXPECT_END
+} jso_sax_expect;
+
+/* set error of the passed type on the current scanner location */
+static jso_rc jso_sax_error(jso_scanner *s, jso_error_type type, jso_value *error)
+{
+	JSO_VALUE_SET_ERROR_P(error, jso_error_new_ex(type, &s->loc));
+	return JSO_FAILURE;
+}
+
+/* check whether the token is a scalar value */
+static inline jso_bool jso_sax_is_scalar(int token)
+{
+	switch (token) {
+		case JSO_T_NUL:
+		case JSO_T_TRUE:
+		case JSO_T_FALSE:
+		case JSO_T_LONG:
+		case JSO_T_DOUBLE:
+		case JSO_T_STRING:
+		case JSO_T_ESTRING:
+			return JSO_TRUE;
+		default:
+			return JSO_FALSE;
+	}
+}
+
+/* deliver the scalar value */
+static jso_sax_action jso_sax_scalar(
+		jso_scanner *s, int token, const jso_sax_callbacks *callbacks, void *ctx)
+{
+	switch (token) {
+		case JSO_T_NUL:
+			return JSO_SAX_CALL_0(null_value);
+		case JSO_T_TRUE:
+			return JSO_SAX_CALL(bool_value, JSO_TRUE);
+		case JSO_T_FALSE:
+			return JSO_SAX_CALL(bool_value, JSO_FALSE);
+		case JSO_T_LONG:
+			return JSO_SAX_CALL(int_value, JSO_IVAL(s->value));
+		case JSO_T_DOUBLE:
+			return JSO_SAX_CALL(double_value, JSO_DVAL(s->value));
+		default:
+			return JSO_SAX_CALL(string_value, s->view, s->view_len);
+	}
+}
+
+/* run the state machine over the scanned tokens */
+static jso_rc jso_sax_parse(jso_scanner *s, const jso_sax_callbacks *callbacks, void *ctx,
+		jso_uint max_depth, jso_value *error)
+{
+	jso_sax_expect expect = JSO_SAX_EXPECT_VALUE;
+	jso_sax_action action;
+	jso_bool skip_value = JSO_FALSE;
+
+	for (;;) {
+		jso_bool in_object = jso_scanner_in_object(s);
+		int token = jso_scan(s);
+
+		if (token == JSO_T_ERROR) {
+			*error = s->value;
+			return JSO_FAILURE;
+		}
+		if (token == JSO_T_ENOMEM) {
+			return jso_sax_error(s, JSO_ERROR_ALLOC, error);
+		}
+
+		switch (expect) {
+			case JSO_SAX_EXPECT_FIRST_VALUE:
+				if (token == ']') {
+					action = JSO_SAX_CALL_0(array_end);
+					break;
+				}
+				/* fall through */
+			case JSO_SAX_EXPECT_VALUE:
+				if (token == '{' || token == '[') {
+					if (max_depth && s->depth > max_depth) {
+						return jso_sax_error(s, JSO_ERROR_DEPTH, error);
+					}
+					if (skip_value) {
+						action = JSO_SAX_SKIP;
+					} else if (token == '{') {
+						action = JSO_SAX_CALL_0(object_start);
+					} else {
+						action = JSO_SAX_CALL_0(array_start);
+					}
+					if (action == JSO_SAX_SKIP) {
+						if (jso_scanner_skip(s) == JSO_T_EOI) {
+							return jso_sax_error(s, JSO_ERROR_SYNTAX, error);
+						}
+						break;
+					}
+					if (action == JSO_SAX_CONTINUE) {
+						expect = token == '{' ? JSO_SAX_EXPECT_FIRST_KEY
+								: JSO_SAX_EXPECT_FIRST_VALUE;
+						continue;
+					}
+					break;
+				}
+				if (!jso_sax_is_scalar(token)) {
+					return jso_sax_error(s, JSO_ERROR_SYNTAX, error);
+				}
+				action = skip_value ? JSO_SAX_CONTINUE : jso_sax_scalar(s, token, callbacks, ctx);
+				break;
+			case JSO_SAX_EXPECT_FIRST_KEY:
+				if (token == '}') {
+					action = JSO_SAX_CALL_0(object_end);
+					break;
+				}
+				/* fall through */
+			case JSO_SAX_EXPECT_KEY:
+				if (token != JSO_T_STRING && token != JSO_T_ESTRING) {
+					return jso_sax_error(s, JSO_ERROR_SYNTAX, error);
+				}
+				action = JSO_SAX_CALL(object_key, s->view, s->view_len);
+				skip_value = action == JSO_SAX_SKIP;
+				expect = JSO_SAX_EXPECT_COLON;
+				if (action == JSO_SAX_ABORT) {
+					break;
+				}
+				continue;
+			case JSO_SAX_EXPECT_COLON:
+				if (token != ':') {
+					return jso_sax_error(s, JSO_ERROR_SYNTAX, error);
+				}
+				expect = JSO_SAX_EXPECT_VALUE;
+				continue;
+			case JSO_SAX_EXPECT_NEXT:
+				if (token == ',') {
+					expect = in_object ? JSO_SAX_EXPECT_KEY : JSO_SAX_EXPECT_VALUE;
+					continue;
+				}
+				if (token == '}' && in_object) {
+					action = JSO_SAX_CALL_0(object_end);
+				} else if (token == ']' && !in_object) {
+					action = JSO_SAX_CALL_0(array_end);
+				} else {
+					return jso_sax_error(s, JSO_ERROR_SYNTAX, error);
+				}
+				break;
+			default:
+				if (token != JSO_T_EOI) {
+					return jso_sax_error(s, JSO_ERROR_SYNTAX, error);
+				}
+				return JSO_SUCCESS;
+		}
+
+		/* the value is complete */
+		if (action == JSO_SAX_ABORT) {
+			return jso_sax_error(s, JSO_ERROR_ABORT, error);
+		}
+		skip_value = JSO_FALSE;
+		expect = s->depth == 0 ? JSO_SAX_EXPECT_END : JSO_SAX_EXPECT_NEXT;
+	}
+}
+
+JSO_API jso_rc jso_sax_parse_io(jso_io *io, const jso_sax_callbacks *callbacks, void *ctx,
+		const jso_parser_options *options, jso_value *error)
+{
+	jso_rc rc;
+	jso_scanner scanner;
+	const jso_allocator *allocator = jso_mm_enter(options->allocator);
+
+	jso_scanner_init(&scanner, io);
+	scanner.borrow = JSO_TRUE;
+
+	rc = jso_sax_parse(&scanner, callbacks, ctx, options->max_depth, error);
+
+	jso_scanner_clear(&scanner);
+	jso_mm_leave(allocator);
+
+	return rc;
+}
+
+JSO_API jso_rc jso_sax_parse_cstr(const char *cstr, size_t len,
+		const jso_sax_callbacks *callbacks, void *ctx, const jso_parser_options *options,
+		jso_value *error)
+{
+	const jso_allocator *allocator = jso_mm_enter(options->allocator);
+	jso_io *io = jso_io_string_open_from_cstr(cstr, len);
+	jso_rc rc = jso_sax_parse_io(io, callbacks, ctx, options, error);
+	JSO_IO_FREE(io);
+	jso_mm_leave(allocator);
+	return rc;
+}
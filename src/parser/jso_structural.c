@@ -0,0 +1,386 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "../jso_parser.h"
+#include "../jso_parser.tab.h"
+#include "../jso_simd.h"
+
+#include <string.h>
+
+#ifdef __GNUC__
+#define JSO_STRUCTURAL_CTZ(mask) ((size_t) __builtin_ctzll(mask))
+#else
+static inline size_t jso_structural_ctz(jso_uint64 mask)
+{
+	size_t pos = 0;
+	while (!(mask & 1)) {
+		mask >>= 1;
+		++pos;
+	}
+	return pos;
+}
+#define JSO_STRUCTURAL_CTZ(mask) jso_structural_ctz(mask)
+#endif
+
+/* call the parser hook if it is set and check whether it succeeded */
+#define JSO_STRUCTURAL_HOOK(_parser, _name, ...) \
+	((_parser)->hooks._name == NULL \
+			|| (_parser)->hooks._name(_parser, __VA_ARGS__) == JSO_ERROR_NONE)
+
+#define JSO_STRUCTURAL_HOOK_0(_parser, _name) \
+	((_parser)->hooks._name == NULL || (_parser)->hooks._name(_parser) == JSO_ERROR_NONE)
+
+/**
+ * @brief Open container.
+ */
+typedef struct _jso_structural_level {
+	/** object if the container is an object and it is already created */
+	jso_object *object;
+	/** array if the container is an array and it is already created */
+	jso_array *array;
+	/** key of the current member */
+	jso_value key;
+	/** whether the container is an object */
+	jso_bool is_object;
+	/** whether the container is created (it is created with the first member) */
+	jso_bool created;
+} jso_structural_level;
+
+/**
+ * @brief Structural parser state.
+ */
+typedef struct _jso_structural {
+	/** parser with the scanner used for the scalars */
+	jso_parser *parser;
+	/** input start */
+	jso_ctype *input;
+	/** positions of the structural characters followed by the input length */
+	jso_uint32 *indexes;
+	/** number of the structural characters */
+	size_t indexes_count;
+	/** capacity of the indexes */
+	size_t indexes_size;
+	/** stack of the open containers */
+	jso_structural_level *levels;
+	/** number of the open containers */
+	size_t levels_count;
+	/** capacity of the containers stack */
+	size_t levels_size;
+} jso_structural;
+
+/* find positions of all structural characters in the input */
+static jso_rc jso_structural_index(jso_structural *st, size_t len)
+{
+	jso_simd_structural_state state = { 0 };
+	jso_ctype tail[JSO_SIMD_BLOCK_SIZE];
+
+	/* the positions are stored in 32 bits to keep the index small and empty input is an error */
+	if (len == 0 || len >= UINT32_MAX) {
+		return JSO_FAILURE;
+	}
+
+	for (size_t pos = 0; pos < len; pos += JSO_SIMD_BLOCK_SIZE) {
+		const jso_ctype *block = st->input + pos;
+		if (len - pos < JSO_SIMD_BLOCK_SIZE) {
+			/* the last block is padded by whitespace */
+			memset(tail, ' ', JSO_SIMD_BLOCK_SIZE);
+			memcpy(tail, block, len - pos);
+			block = tail;
+		}
+		if (st->indexes_count + JSO_SIMD_BLOCK_SIZE + 1 > st->indexes_size) {
+			size_t size = st->indexes_size ? st->indexes_size * 2
+										   : len / 8 + 2 * JSO_SIMD_BLOCK_SIZE;
+			jso_uint32 *indexes = jso_realloc(st->indexes, size * sizeof(jso_uint32));
+			if (indexes == NULL) {
+				return JSO_FAILURE;
+			}
+			st->indexes = indexes;
+			st->indexes_size = size;
+		}
+		jso_uint64 mask = jso_simd_structural_block(&state, block);
+		while (mask) {
+			st->indexes[st->indexes_count++] = (jso_uint32) (pos + JSO_STRUCTURAL_CTZ(mask));
+			mask &= mask - 1;
+		}
+	}
+	/* the input ends in the unterminated string */
+	if (state.in_string) {
+		return JSO_FAILURE;
+	}
+	st->indexes[st->indexes_count] = (jso_uint32) len;
+
+	return JSO_SUCCESS;
+}
+
+/* get the structural character */
+static inline jso_ctype jso_structural_char(jso_structural *st, size_t index)
+{
+	return index < st->indexes_count ? st->input[st->indexes[index]] : 0;
+}
+
+/* scan the scalar starting at the index and check that only whitespace follows it */
+static int jso_structural_scan(jso_structural *st, size_t index)
+{
+	jso_scanner *s = &st->parser->scanner;
+	jso_ctype *end = st->input + st->indexes[index + 1];
+
+	JSO_IO_CURSOR(s->io) = st->input + st->indexes[index];
+	int token = jso_scan(s);
+	switch (token) {
+		case JSO_T_NUL:
+		case JSO_T_TRUE:
+		case JSO_T_FALSE:
+		case JSO_T_LONG:
+		case JSO_T_DOUBLE:
+		case JSO_T_STRING:
+		case JSO_T_ESTRING: {
+			jso_ctype *cursor = JSO_IO_CURSOR(s->io);
+			if (cursor == end
+					|| (cursor < end
+							&& (*cursor == ' ' || *cursor == '\t' || *cursor == '\n'
+									|| *cursor == '\r'))) {
+				return token;
+			}
+			break;
+		}
+	}
+	jso_value_clear(&s->value);
+
+	return JSO_T_ERROR;
+}
+
+/* open the new container */
+static jso_structural_level *jso_structural_push(jso_structural *st, jso_bool is_object)
+{
+	if (st->levels_count == st->levels_size) {
+		size_t size = st->levels_size ? st->levels_size * 2 : 16;
+		jso_structural_level *levels = jso_realloc(st->levels, size * sizeof(jso_structural_level));
+		if (levels == NULL) {
+			return NULL;
+		}
+		st->levels = levels;
+		st->levels_size = size;
+	}
+
+	jso_structural_level *level = &st->levels[st->levels_count++];
+	level->object = NULL;
+	level->array = NULL;
+	JSO_VALUE_SET_NULL(level->key);
+	level->is_object = is_object;
+	level->created = JSO_FALSE;
+
+	return level;
+}
+
+/* create the container if it is not created yet */
+static jso_rc jso_structural_create(jso_parser *parser, jso_structural_level *level)
+{
+	if (!level->created) {
+		level->created = JSO_TRUE;
+		if (level->is_object) {
+			return JSO_STRUCTURAL_HOOK(parser, object_create, &level->object) ? JSO_SUCCESS
+																				: JSO_FAILURE;
+		}
+		return JSO_STRUCTURAL_HOOK(parser, array_create, &level->array) ? JSO_SUCCESS
+																		: JSO_FAILURE;
+	}
+	return JSO_SUCCESS;
+}
+
+/* scan the member key and the following colon */
+static jso_rc jso_structural_key(jso_structural *st, size_t *index, jso_structural_level *level)
+{
+	jso_parser *parser = st->parser;
+
+	if (jso_structural_char(st, *index) != '"') {
+		return JSO_FAILURE;
+	}
+	parser->scanner.key = JSO_TRUE;
+	int token = jso_structural_scan(st, *index);
+	parser->scanner.key = JSO_FALSE;
+	if (token != JSO_T_STRING && token != JSO_T_ESTRING) {
+		return JSO_FAILURE;
+	}
+	level->key = parser->scanner.value;
+	if (!JSO_STRUCTURAL_HOOK(parser, object_key, JSO_STR(level->key))
+			|| jso_structural_char(st, *index + 1) != ':') {
+		return JSO_FAILURE;
+	}
+	*index += 2;
+
+	return JSO_SUCCESS;
+}
+
+/* add the complete value to the innermost container */
+static jso_rc jso_structural_add(jso_parser *parser, jso_structural_level *level, jso_value *value)
+{
+	if (jso_structural_create(parser, level) == JSO_FAILURE) {
+		jso_value_clear(value);
+		return JSO_FAILURE;
+	}
+	if (level->is_object) {
+		/* the key is owned by the object after the update */
+		jso_value key = level->key;
+		JSO_VALUE_SET_NULL(level->key);
+		if (!JSO_STRUCTURAL_HOOK(parser, object_update, level->object, JSO_STR(key), value)) {
+			jso_value_clear(&key);
+			jso_value_clear(value);
+			return JSO_FAILURE;
+		}
+	} else if (!JSO_STRUCTURAL_HOOK(parser, array_append, level->array, value)) {
+		jso_value_clear(value);
+		return JSO_FAILURE;
+	}
+
+	return JSO_SUCCESS;
+}
+
+/* close the innermost container and set it to the value */
+static jso_rc jso_structural_pop(jso_structural *st, jso_value *value)
+{
+	jso_parser *parser = st->parser;
+	jso_structural_level *level = &st->levels[st->levels_count - 1];
+
+	jso_parser_depth_decrease(parser);
+	if (jso_structural_create(parser, level) == JSO_FAILURE
+			|| !(level->is_object ? JSO_STRUCTURAL_HOOK_0(parser, object_end)
+								  : JSO_STRUCTURAL_HOOK_0(parser, array_end))) {
+		return JSO_FAILURE;
+	}
+	if (level->is_object) {
+		JSO_VALUE_SET_OBJECT_P(value, level->object);
+	} else {
+		JSO_VALUE_SET_ARRAY_P(value, level->array);
+	}
+	--st->levels_count;
+
+	if (!JSO_STRUCTURAL_HOOK(parser, value, value)) {
+		jso_value_clear(value);
+		return JSO_FAILURE;
+	}
+
+	return JSO_SUCCESS;
+}
+
+/* walk the structural index and build the values by the parser hooks in the grammar order */
+static jso_rc jso_structural_walk(jso_structural *st)
+{
+	jso_parser *parser = st->parser;
+	size_t index = 0;
+	jso_value value;
+
+	for (;;) {
+		/* start of the value */
+		jso_ctype c = jso_structural_char(st, index);
+		if (c == '{' || c == '[') {
+			jso_bool is_object = c == '{';
+			if (jso_parser_depth_increase(parser) != JSO_ERROR_NONE
+					|| !(is_object ? JSO_STRUCTURAL_HOOK_0(parser, object_start)
+								   : JSO_STRUCTURAL_HOOK_0(parser, array_start))) {
+				return JSO_FAILURE;
+			}
+			jso_structural_level *level = jso_structural_push(st, is_object);
+			if (level == NULL) {
+				return JSO_FAILURE;
+			}
+			if (jso_structural_char(st, ++index) != (is_object ? '}' : ']')) {
+				if (is_object && jso_structural_key(st, &index, level) == JSO_FAILURE) {
+					return JSO_FAILURE;
+				}
+				continue;
+			}
+			++index;
+			if (jso_structural_pop(st, &value) == JSO_FAILURE) {
+				return JSO_FAILURE;
+			}
+		} else {
+			if (index >= st->indexes_count || jso_structural_scan(st, index++) == JSO_T_ERROR) {
+				return JSO_FAILURE;
+			}
+			value = parser->scanner.value;
+			if (!JSO_STRUCTURAL_HOOK(parser, value, &value)) {
+				jso_value_clear(&value);
+				return JSO_FAILURE;
+			}
+		}
+
+		/* the value is complete so it is added to its container that can be closed as well */
+		for (;;) {
+			if (st->levels_count == 0) {
+				if (index != st->indexes_count) {
+					jso_value_clear(&value);
+					return JSO_FAILURE;
+				}
+				parser->result = value;
+				return JSO_SUCCESS;
+			}
+			jso_structural_level *level = &st->levels[st->levels_count - 1];
+			if (jso_structural_add(parser, level, &value) == JSO_FAILURE) {
+				return JSO_FAILURE;
+			}
+			c = jso_structural_char(st, index++);
+			if (c == ',') {
+				if (level->is_object && jso_structural_key(st, &index, level) == JSO_FAILURE) {
+					return JSO_FAILURE;
+				}
+				break;
+			}
+			if (c != (level->is_object ? '}' : ']')
+					|| jso_structural_pop(st, &value) == JSO_FAILURE) {
+				return JSO_FAILURE;
+			}
+		}
+	}
+}
+
+JSO_API jso_rc jso_structural_parse(jso_parser *parser)
+{
+	jso_io *io = parser->scanner.io;
+	jso_structural st;
+	jso_rc rc;
+
+	memset(&st, 0, sizeof(jso_structural));
+	st.parser = parser;
+	st.input = JSO_IO_CURSOR(io);
+
+	rc = jso_structural_index(&st, (size_t) (JSO_IO_LIMIT(io) - JSO_IO_CURSOR(io)));
+	if (rc == JSO_SUCCESS) {
+		rc = jso_structural_walk(&st);
+	}
+
+	/* release the partially built values */
+	while (st.levels_count > 0) {
+		jso_structural_level *level = &st.levels[--st.levels_count];
+		jso_value_clear(&level->key);
+		if (level->object != NULL) {
+			jso_object_free(level->object);
+		}
+		if (level->array != NULL) {
+			jso_array_free(level->array);
+		}
+	}
+	jso_free(st.levels);
+	jso_free(st.indexes);
+
+	return rc;
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "../jso_parser.h"
+#include "../jso_parser.tab.h"
+
+/**
+ * @brief Tokens expected by the validator.
+ */
+typedef enum {
+	/** any value */
+	JSO_VALIDATOR_EXPECT_VALUE,
+	/** any value or end of the array */
+	JSO_VALIDATOR_EXPECT_VALUE_OR_END,
+	/** object key */
+	JSO_VALIDATOR_EXPECT_KEY,
+	/** object key or end of the object */
+	JSO_VALIDATOR_EXPECT_KEY_OR_END,
+	/** colon after the object key */
+	JSO_VALIDATOR_EXPECT_COLON,
+	/** comma or end of the container */
+	JSO_VALIDATOR_EXPECT_NEXT,
+	/** end of the input after the root value */
+	JSO_VALIDATOR_EXPECT_EOI,
+} jso_validator_expect;
+
+/* check the tokens following the first token without creating their values */
+static jso_rc jso_validator_walk(jso_parser *parser, int token)
+{
+	jso_scanner *s = &parser->scanner;
+	jso_validator_expect expect = JSO_VALIDATOR_EXPECT_VALUE;
+	jso_bool in_object = JSO_FALSE;
+
+	while (JSO_TRUE) {
+		switch (token) {
+			case '{':
+			case '[':
+				if ((expect != JSO_VALIDATOR_EXPECT_VALUE
+							&& expect != JSO_VALIDATOR_EXPECT_VALUE_OR_END)
+						|| jso_parser_depth_increase(parser) != JSO_ERROR_NONE) {
+					return JSO_FAILURE;
+				}
+				in_object = token == '{';
+				expect = in_object ? JSO_VALIDATOR_EXPECT_KEY_OR_END
+								   : JSO_VALIDATOR_EXPECT_VALUE_OR_END;
+				/* the keys are not hashed as they are not created */
+				s->key = JSO_FALSE;
+				break;
+			case '}':
+			case ']':
+				if (in_object != (token == '}')
+						|| (expect != JSO_VALIDATOR_EXPECT_NEXT
+								&& expect != JSO_VALIDATOR_EXPECT_KEY_OR_END
+								&& expect != JSO_VALIDATOR_EXPECT_VALUE_OR_END)) {
+					return JSO_FAILURE;
+				}
+				jso_parser_depth_decrease(parser);
+				/* the container has been already removed from the scanner stack */
+				in_object = jso_scanner_in_object(s);
+				expect = parser->depth ? JSO_VALIDATOR_EXPECT_NEXT : JSO_VALIDATOR_EXPECT_EOI;
+				break;
+			case ':':
+				if (expect != JSO_VALIDATOR_EXPECT_COLON) {
+					return JSO_FAILURE;
+				}
+				expect = JSO_VALIDATOR_EXPECT_VALUE;
+				break;
+			case ',':
+				if (expect != JSO_VALIDATOR_EXPECT_NEXT) {
+					return JSO_FAILURE;
+				}
+				expect = in_object ? JSO_VALIDATOR_EXPECT_KEY : JSO_VALIDATOR_EXPECT_VALUE;
+				s->key = JSO_FALSE;
+				break;
+			case JSO_T_STRING:
+			case JSO_T_ESTRING:
+				if (expect == JSO_VALIDATOR_EXPECT_KEY
+						|| expect == JSO_VALIDATOR_EXPECT_KEY_OR_END) {
+					expect = JSO_VALIDATOR_EXPECT_COLON;
+					break;
+				}
+				if (expect != JSO_VALIDATOR_EXPECT_VALUE
+						&& expect != JSO_VALIDATOR_EXPECT_VALUE_OR_END) {
+					return JSO_FAILURE;
+				}
+				expect = parser->depth ? JSO_VALIDATOR_EXPECT_NEXT : JSO_VALIDATOR_EXPECT_EOI;
+				break;
+			case JSO_T_NUL:
+			case JSO_T_TRUE:
+			case JSO_T_FALSE:
+			case JSO_T_LONG:
+			case JSO_T_DOUBLE:
+				if (expect != JSO_VALIDATOR_EXPECT_VALUE
+						&& expect != JSO_VALIDATOR_EXPECT_VALUE_OR_END) {
+					return JSO_FAILURE;
+				}
+				expect = parser->depth ? JSO_VALIDATOR_EXPECT_NEXT : JSO_VALIDATOR_EXPECT_EOI;
+				break;
+			case JSO_T_EOI:
+				return expect == JSO_VALIDATOR_EXPECT_EOI ? JSO_SUCCESS : JSO_FAILURE;
+			default:
+				/* release the scanner error */
+				jso_value_clear(&s->value);
+				return JSO_FAILURE;
+		}
+		token = jso_scan(s);
+	}
+}
+
+JSO_API jso_rc jso_validator_parse(jso_parser *parser)
+{
+	jso_scanner *s = &parser->scanner;
+	jso_value root;
+	jso_rc rc;
+
+	/* the root scalar is created so the result is the same as for the grammar */
+	int token = jso_scan(s);
+	if (token == '{') {
+		JSO_VALUE_SET_OBJECT(root, NULL);
+	} else if (token == '[') {
+		JSO_VALUE_SET_ARRAY(root, NULL);
+	} else {
+		root = s->value;
+		JSO_VALUE_SET_NULL(s->value);
+	}
+
+	s->validate = JSO_TRUE;
+	rc = jso_validator_walk(parser, token);
+	s->validate = JSO_FALSE;
+
+	if (rc == JSO_SUCCESS) {
+		parser->result = root;
+	} else if (token != '{' && token != '[') {
+		jso_value_clear(&root);
+	}
+
+	return rc;
+}
@@ -87,7 +87,8 @@ static jso_rc jso_pointer_compile(jso_pointer *jp, jso_string *pointer_value)
 	}
 	if (*pos != '/') {
 		jso_pointer_error_format(jp, JSO_POINTER_ERROR_INVALID_FORMAT,
-				"JsonPointer must start with slash, pointer: %s", (const char *) pos);
+				"JsonPointer must start with slash, pointer: %.*s", (int) pointer_len,
+				(const char *) pos);
 		return JSO_FAILURE;
 	}
 	++pos;
@@ -108,6 +109,10 @@ static jso_rc jso_pointer_compile(jso_pointer *jp, jso_string *pointer_value)
 		return JSO_FAILURE;
 	}
 	jp->pointer_value = jso_string_copy(pointer_value);
+	if (jp->pointer_value == NULL) {
+		jso_pointer_error_set(jp, JSO_POINTER_ERROR_ALLOC, "JsonPointer value allocation failed");
+		return JSO_FAILURE;
+	}
 	jp->tokens_count = tokens_count;
 	jso_string *token;
 	pos = start + 1;
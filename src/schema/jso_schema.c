@@ -45,7 +45,7 @@ JSO_API void jso_schema_options_init(jso_schema_options *options)
 	memset(options, 0, sizeof(jso_schema_options));
 }
 
-JSO_API jso_rc jso_schema_parse_ex(
+static jso_rc jso_schema_parse_data(
 		jso_schema *schema, jso_value *data, const jso_schema_options *options)
 {
 	if (JSO_TYPE_P(data) != JSO_TYPE_OBJECT) {
@@ -71,6 +71,20 @@ JSO_API jso_rc jso_schema_parse_ex(
 	return JSO_SUCCESS;
 }
 
+JSO_API jso_rc jso_schema_parse_ex(
+		jso_schema *schema, jso_value *data, const jso_schema_options *options)
+{
+	// All schema memory is allocated by the same allocator that is used for freeing.
+	schema->allocator = jso_mm_resolve(options->allocator);
+	schema->skip_error_detail = options->skip_error_detail;
+	schema->compile = !options->skip_compile;
+	const jso_allocator *allocator = jso_mm_enter(schema->allocator);
+	jso_rc rc = jso_schema_parse_data(schema, data, options);
+	jso_mm_leave(allocator);
+
+	return rc;
+}
+
 JSO_API jso_rc jso_schema_parse(jso_schema *schema, jso_value *data)
 {
 	jso_schema_options options;
@@ -81,10 +95,13 @@ JSO_API jso_rc jso_schema_parse(jso_schema *schema, jso_value *data)
 
 static inline void jso_schema_empty(jso_schema *schema)
 {
+	const jso_allocator *allocator = jso_mm_enter(schema->allocator);
 	jso_schema_value_free(schema->root);
-	jso_value_free(&schema->doc);
 	jso_schema_error_clear(&schema->error);
 	jso_ht_clear(&schema->uri_deref_cache);
+	jso_mm_leave(allocator);
+	// The document is owned by the data allocator.
+	jso_value_free(&schema->doc);
 }
 
 JSO_API void jso_schema_clear(jso_schema *schema)
@@ -24,25 +24,133 @@
 #include "jso_schema_error.h"
 
 #include "../jso.h"
+#include "../jso_number.h"
+#include "../jso_re.h"
 
 #include <stdarg.h>
 #include <stdio.h>
 
+/* definition of the validation error code */
+typedef struct _jso_schema_error_code_def {
+	/** type of the error */
+	jso_schema_error_type type;
+	/** checked keyword */
+	const char *keyword;
+	/** message format with the operands formatted as strings */
+	const char *format;
+	/** number of the format operands */
+	size_t operands_count;
+} jso_schema_error_code_def;
+
+static const jso_schema_error_code_def jso_schema_error_codes[JSO_SCHEMA_ERROR_CODE_COUNT] = {
+	[JSO_SCHEMA_ERROR_CODE_TYPE] = { JSO_SCHEMA_ERROR_VALIDATION_TYPE, "type",
+			"Invalid validation type, expected %s but received %s", 2 },
+	[JSO_SCHEMA_ERROR_CODE_TYPE_ALTERNATIVE] = { JSO_SCHEMA_ERROR_VALIDATION_TYPE, "type",
+			"Invalid validation type, expected %s or %s but received %s", 3 },
+	[JSO_SCHEMA_ERROR_CODE_TYPE_LIST] = { JSO_SCHEMA_ERROR_VALIDATION_TYPE, "type",
+			"Value is not any of the listed types", 0 },
+	[JSO_SCHEMA_ERROR_CODE_TYPE_SCHEMA] = { JSO_SCHEMA_ERROR_VALIDATION_TYPE, "type",
+			"Invalid schema type, expected %s but received %s", 2 },
+	[JSO_SCHEMA_ERROR_CODE_TYPE_INTEGER_FRACTION] = { JSO_SCHEMA_ERROR_VALIDATION_TYPE, "type",
+			"Double integer type cannot have decimal point", 0 },
+	[JSO_SCHEMA_ERROR_CODE_FALSE] = { JSO_SCHEMA_ERROR_VALIDATION_FALSE, NULL,
+			"Schema value is always invalid", 0 },
+	[JSO_SCHEMA_ERROR_CODE_ENUM] = { JSO_SCHEMA_ERROR_VALIDATION_KEYWORD, "enum",
+			"Instance value not found in enum values", 0 },
+	[JSO_SCHEMA_ERROR_CODE_CONST] = { JSO_SCHEMA_ERROR_VALIDATION_KEYWORD, "const",
+			"Instance value is not equal to const value", 0 },
+	[JSO_SCHEMA_ERROR_CODE_ANY_OF] = { JSO_SCHEMA_ERROR_VALIDATION_COMPOSITION, "anyOf",
+			"No anyOf subschema was valid", 0 },
+	[JSO_SCHEMA_ERROR_CODE_ONE_OF] = { JSO_SCHEMA_ERROR_VALIDATION_COMPOSITION, "oneOf",
+			"No oneOf subschema was valid", 0 },
+	[JSO_SCHEMA_ERROR_CODE_ONE_OF_MORE] = { JSO_SCHEMA_ERROR_VALIDATION_COMPOSITION, "oneOf",
+			"More than one oneOf subschema was valid", 0 },
+	[JSO_SCHEMA_ERROR_CODE_NOT] = { JSO_SCHEMA_ERROR_VALIDATION_COMPOSITION, "not",
+			"Negated valid validation", 0 },
+	[JSO_SCHEMA_ERROR_CODE_MINIMUM] = { JSO_SCHEMA_ERROR_VALIDATION_KEYWORD, "minimum",
+			"Value %s is lower than minimum value %s", 2 },
+	[JSO_SCHEMA_ERROR_CODE_MAXIMUM] = { JSO_SCHEMA_ERROR_VALIDATION_KEYWORD, "maximum",
+			"Value %s is greater than maximum value %s", 2 },
+	[JSO_SCHEMA_ERROR_CODE_EXCLUSIVE_MINIMUM] = { JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
+			"exclusiveMinimum", "Value %s is %s exclusive minimum value %s", 3 },
+	[JSO_SCHEMA_ERROR_CODE_EXCLUSIVE_MAXIMUM] = { JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
+			"exclusiveMaximum", "Value %s is %s exclusive maximum value %s", 3 },
+	[JSO_SCHEMA_ERROR_CODE_EXCLUSIVE_MINIMUM_EQUAL] = { JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
+			"exclusiveMinimum", "Value %s is equal to exclusive minimum", 1 },
+	[JSO_SCHEMA_ERROR_CODE_EXCLUSIVE_MAXIMUM_EQUAL] = { JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
+			"exclusiveMaximum", "Value %s is equal to exclusive maximum", 1 },
+	[JSO_SCHEMA_ERROR_CODE_MULTIPLE_OF] = { JSO_SCHEMA_ERROR_VALIDATION_KEYWORD, "multipleOf",
+			"Value %s is not multiple of %s", 2 },
+	[JSO_SCHEMA_ERROR_CODE_MIN_LENGTH] = { JSO_SCHEMA_ERROR_VALIDATION_KEYWORD, "minLength",
+			"String length %s is lower than minimum length %s", 2 },
+	[JSO_SCHEMA_ERROR_CODE_MAX_LENGTH] = { JSO_SCHEMA_ERROR_VALIDATION_KEYWORD, "maxLength",
+			"String length %s is greater than maximum length %s", 2 },
+	[JSO_SCHEMA_ERROR_CODE_PATTERN] = { JSO_SCHEMA_ERROR_VALIDATION_KEYWORD, "pattern",
+			"String pattern %s does not match value %s", 2 },
+	[JSO_SCHEMA_ERROR_CODE_MIN_ITEMS] = { JSO_SCHEMA_ERROR_VALIDATION_KEYWORD, "minItems",
+			"Array number of items is %s which is lower than minimum number of items %s", 2 },
+	[JSO_SCHEMA_ERROR_CODE_MAX_ITEMS] = { JSO_SCHEMA_ERROR_VALIDATION_KEYWORD, "maxItems",
+			"Array number of items is %s which is greater than max number of items %s", 2 },
+	[JSO_SCHEMA_ERROR_CODE_ADDITIONAL_ITEMS] = { JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
+			"additionalItems",
+			"Array additional items are not allowed and number of items is lower", 0 },
+	[JSO_SCHEMA_ERROR_CODE_UNIQUE_ITEMS] = { JSO_SCHEMA_ERROR_VALIDATION_KEYWORD, "uniqueItems",
+			"Array is not unique", 0 },
+	[JSO_SCHEMA_ERROR_CODE_CONTAINS] = { JSO_SCHEMA_ERROR_VALIDATION_KEYWORD, "contains",
+			"Array does not contain item that validate against contains schema", 0 },
+	[JSO_SCHEMA_ERROR_CODE_MIN_PROPERTIES] = { JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
+			"minProperties",
+			"Object number of properties is %s which is lower than minimum number of "
+			"properties %s",
+			2 },
+	[JSO_SCHEMA_ERROR_CODE_MAX_PROPERTIES] = { JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
+			"maxProperties",
+			"Object number of properties is %s which is greater than maximum number of "
+			"properties %s",
+			2 },
+	[JSO_SCHEMA_ERROR_CODE_REQUIRED] = { JSO_SCHEMA_ERROR_VALIDATION_KEYWORD, "required",
+			"Object does not have required property with key %s", 1 },
+	[JSO_SCHEMA_ERROR_CODE_PROPERTY_NAMES] = { JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
+			"propertyNames", "Object key %s does not validate against propertyNames schema", 1 },
+	[JSO_SCHEMA_ERROR_CODE_ADDITIONAL_PROPERTIES] = { JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
+			"additionalProperties",
+			"Object does not allow additional properties but added property with key %s which "
+			"is not found in properties or matches any pattern property",
+			1 },
+	[JSO_SCHEMA_ERROR_CODE_DEPENDENCIES] = { JSO_SCHEMA_ERROR_VALIDATION_KEYWORD, "dependencies",
+			"Object key %s is required by dependency %s but it is not present", 2 },
+};
+
+/* allocate the message buffer if it does not exist yet */
+static jso_rc jso_schema_error_alloc_message(jso_schema_error *error)
+{
+	if (error->message == NULL) {
+		const jso_allocator *allocator = jso_mm_get_allocator();
+		char *new_message = jso_allocator_malloc(allocator, JSO_SCHEMA_ERROR_FORMAT_SIZE + 1);
+		if (new_message == NULL) {
+			return JSO_FAILURE;
+		}
+		error->message = new_message;
+		error->allocator = allocator;
+	}
+
+	return JSO_SUCCESS;
+}
+
 jso_rc jso_schema_error_set(jso_schema *schema, jso_schema_error_type type, const char *message)
 {
 	size_t message_len = strlen(message) + 1;
 	JSO_ASSERT_LE(message_len, JSO_SCHEMA_ERROR_FORMAT_SIZE);
 
-	if (JSO_SCHEMA_ERROR_MESSAGE(schema) == NULL) {
-		char *new_message = jso_malloc(JSO_SCHEMA_ERROR_FORMAT_SIZE + 1);
-		if (new_message == NULL) {
-			return JSO_FAILURE;
-		}
-		JSO_SCHEMA_ERROR_MESSAGE(schema) = new_message;
+	if (jso_schema_error_alloc_message(JSO_SCHEMA_ERROR(schema)) == JSO_FAILURE) {
+		return JSO_FAILURE;
 	}
 
-	memcpy(JSO_SCHEMA_ERROR_MESSAGE(schema), message, message_len);
+	memcpy(schema->error.message, message, message_len);
 	JSO_SCHEMA_ERROR_TYPE(schema) = type;
+	JSO_SCHEMA_ERROR_CODE(schema) = JSO_SCHEMA_ERROR_CODE_NONE;
+	schema->error.path_len = 0;
+	schema->error.path[0] = '\0';
 
 	return JSO_SUCCESS;
 }
@@ -68,13 +176,184 @@ jso_rc jso_schema_error_format(
 	return jso_schema_error_set(schema, type, buf);
 }
 
+jso_rc jso_schema_error_pattern_match(jso_schema *schema, jso_re_code *code, int match_result)
+{
+	jso_ctype buf[256];
+	jso_string *pattern = JSO_RE_CODE_PATTERN(code);
+
+	return jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_PATTERN,
+			"Matching pattern %.*s failed: %s", (int) JSO_STRING_LEN(pattern),
+			(const char *) JSO_STRING_VAL(pattern),
+			jso_re_get_match_error_message(match_result, buf, sizeof(buf)));
+}
+
+/* write the JSON pointer of the position instance from its last token to the path buffer */
+static void jso_schema_error_record_path(
+		jso_schema_error *error, jso_schema_validation_position *pos)
+{
+	char buf[JSO_SCHEMA_ERROR_PATH_SIZE];
+	char *start = buf + sizeof(buf);
+
+	for (; pos != NULL && pos->parent != NULL; pos = pos->parent) {
+		jso_schema_validation_position *parent = pos->parent;
+		if (parent->depth == pos->depth) {
+			/* composed position validates the same instance as its parent */
+			continue;
+		}
+		char index_buf[24];
+		const char *token;
+		size_t token_len, escaped_len;
+		if (parent->object_key != NULL) {
+			token = jso_virt_string_val(parent->object_key);
+			token_len = escaped_len = jso_virt_string_len(parent->object_key);
+			for (size_t i = 0; i < token_len; i++) {
+				escaped_len += token[i] == '~' || token[i] == '/';
+			}
+		} else {
+			/* the array count is incremented only after the item is validated */
+			token = index_buf;
+			token_len = escaped_len
+					= snprintf(index_buf, sizeof(index_buf), "%zu", parent->count);
+		}
+		/* the deepest tokens are kept and the rest is replaced with "..." */
+		if ((size_t) (start - buf) < escaped_len + 1 + 3) {
+			start -= 3;
+			memcpy(start, "...", 3);
+			break;
+		}
+		for (size_t i = token_len; i > 0; i--) {
+			char c = token[i - 1];
+			if (c == '~' || c == '/') {
+				*--start = c == '~' ? '0' : '1';
+				c = '~';
+			}
+			*--start = c;
+		}
+		*--start = '/';
+	}
+
+	error->path_len = buf + sizeof(buf) - start;
+	memcpy(error->path, start, error->path_len);
+	error->path[error->path_len] = '\0';
+}
+
+jso_schema_error_type jso_schema_error_record(jso_schema *schema,
+		jso_schema_validation_position *pos, jso_schema_error_code code, va_list args)
+{
+	const jso_schema_error_code_def *def = &jso_schema_error_codes[code];
+	jso_schema_error *error = JSO_SCHEMA_ERROR(schema);
+
+	error->type = def->type;
+	error->code = code;
+	error->rendered = false;
+	error->value = pos != NULL ? pos->current_value : NULL;
+	error->depth = pos != NULL ? pos->depth : 0;
+	error->strings_len = 0;
+	if (schema->skip_error_detail) {
+		error->operands_count = 0;
+		error->path_len = 0;
+		error->path[0] = '\0';
+		return def->type;
+	}
+
+	jso_schema_error_record_path(error, pos);
+
+	error->operands_count = def->operands_count;
+	for (size_t i = 0; i < def->operands_count; i++) {
+		jso_schema_error_operand *op = &error->operands[i];
+		*op = va_arg(args, jso_schema_error_operand);
+		if (op->type == JSO_SCHEMA_ERROR_OPERAND_STRING) {
+			/* the string is truncated if it does not fit to the buffer */
+			size_t len = JSO_MIN(
+					op->data.str.len, JSO_SCHEMA_ERROR_STRINGS_SIZE - error->strings_len);
+			memcpy(error->strings + error->strings_len, op->data.str.val, len);
+			op->data.str.val = NULL;
+			op->data.str.offset = error->strings_len;
+			op->data.str.len = len;
+			error->strings_len += len;
+		}
+	}
+
+	return def->type;
+}
+
+/* format the operand to the buffer or return its string */
+static const char *jso_schema_error_operand_render(
+		jso_schema_error *error, size_t index, char *buf, size_t size)
+{
+	if (index >= error->operands_count) {
+		/* the operand is not recorded if the detail is skipped */
+		return "?";
+	}
+
+	jso_schema_error_operand *op = &error->operands[index];
+	jso_number_string nstr;
+	switch (op->type) {
+		case JSO_SCHEMA_ERROR_OPERAND_INT:
+			snprintf(buf, size, "%lld", (long long) op->data.ival);
+			return buf;
+		case JSO_SCHEMA_ERROR_OPERAND_UINT:
+			snprintf(buf, size, "%llu", (unsigned long long) op->data.uval);
+			return buf;
+		case JSO_SCHEMA_ERROR_OPERAND_NUMBER:
+			snprintf(buf, size, "%s", jso_number_cstr_from_number(&nstr, &op->data.num));
+			return buf;
+		case JSO_SCHEMA_ERROR_OPERAND_CSTR:
+			return op->data.cstr;
+		case JSO_SCHEMA_ERROR_OPERAND_STRING:
+			snprintf(buf, size, "%.*s", (int) op->data.str.len,
+					error->strings + op->data.str.offset);
+			return buf;
+		default:
+			return "?";
+	}
+}
+
+JSO_API const char *jso_schema_error_message(jso_schema_error *error)
+{
+	if (error->type == JSO_SCHEMA_ERROR_NONE) {
+		return NULL;
+	}
+	if (error->code == JSO_SCHEMA_ERROR_CODE_NONE || error->rendered) {
+		return error->message;
+	}
+	if (jso_schema_error_alloc_message(error) == JSO_FAILURE) {
+		return "Allocating schema error message failed";
+	}
+
+	char bufs[JSO_SCHEMA_ERROR_OPERANDS_SIZE][JSO_SCHEMA_ERROR_STRINGS_SIZE + 1];
+	const char *operands[JSO_SCHEMA_ERROR_OPERANDS_SIZE];
+	for (size_t i = 0; i < JSO_SCHEMA_ERROR_OPERANDS_SIZE; i++) {
+		operands[i] = jso_schema_error_operand_render(error, i, bufs[i], sizeof(bufs[i]));
+	}
+	snprintf(error->message, JSO_SCHEMA_ERROR_FORMAT_SIZE,
+			jso_schema_error_codes[error->code].format, operands[0], operands[1], operands[2]);
+	error->rendered = true;
+
+	return error->message;
+}
+
+JSO_API const char *jso_schema_error_path(jso_schema_error *error)
+{
+	return error->path;
+}
+
+JSO_API const char *jso_schema_error_code_keyword(jso_schema_error_code code)
+{
+	return code < JSO_SCHEMA_ERROR_CODE_COUNT ? jso_schema_error_codes[code].keyword : NULL;
+}
+
 void jso_schema_error_clear(jso_schema_error *error)
 {
 	if (error->message) {
-		jso_free(error->message);
+		jso_allocator_free(error->allocator, error->message);
 		error->message = NULL;
+		error->allocator = NULL;
 	}
 	error->type = JSO_SCHEMA_ERROR_NONE;
+	error->code = JSO_SCHEMA_ERROR_CODE_NONE;
+	error->path_len = 0;
+	error->path[0] = '\0';
 }
 
 void jso_schema_error_free(jso_schema_error *error)
@@ -93,6 +372,10 @@ JSO_API jso_schema_error *jso_schema_move_error(jso_schema *schema)
 	*new_error = *schema_error;
 	schema_error->message = NULL;
 	schema_error->type = JSO_SCHEMA_ERROR_NONE;
+	schema_error->allocator = NULL;
+	schema_error->code = JSO_SCHEMA_ERROR_CODE_NONE;
+	schema_error->path_len = 0;
+	schema_error->path[0] = '\0';
 
 	return new_error;
 }
@@ -31,6 +31,8 @@
 
 #include "../jso_schema.h"
 
+#include <stdarg.h>
+
 #define JSO_SCHEMA_ERROR_FORMAT_SIZE 512
 
 jso_rc jso_schema_error_set(jso_schema *schema, jso_schema_error_type type, const char *message);
@@ -38,6 +40,43 @@ jso_rc jso_schema_error_set(jso_schema *schema, jso_schema_error_type type, cons
 jso_rc jso_schema_error_format(
 		jso_schema *schema, jso_schema_error_type type, const char *format, ...);
 
+jso_rc jso_schema_error_pattern_match(jso_schema *schema, jso_re_code *code, int match_result);
+
+jso_schema_error_type jso_schema_error_record(jso_schema *schema,
+		jso_schema_validation_position *pos, jso_schema_error_code code, va_list args);
+
+static inline jso_schema_error_operand jso_schema_error_operand_int(jso_int val)
+{
+	jso_schema_error_operand op = { .type = JSO_SCHEMA_ERROR_OPERAND_INT, .data.ival = val };
+	return op;
+}
+
+static inline jso_schema_error_operand jso_schema_error_operand_uint(jso_uint val)
+{
+	jso_schema_error_operand op = { .type = JSO_SCHEMA_ERROR_OPERAND_UINT, .data.uval = val };
+	return op;
+}
+
+static inline jso_schema_error_operand jso_schema_error_operand_number(jso_number *num)
+{
+	jso_schema_error_operand op = { .type = JSO_SCHEMA_ERROR_OPERAND_NUMBER, .data.num = *num };
+	return op;
+}
+
+static inline jso_schema_error_operand jso_schema_error_operand_cstr(const char *val)
+{
+	jso_schema_error_operand op = { .type = JSO_SCHEMA_ERROR_OPERAND_CSTR, .data.cstr = val };
+	return op;
+}
+
+static inline jso_schema_error_operand jso_schema_error_operand_string(const char *val, size_t len)
+{
+	jso_schema_error_operand op = { .type = JSO_SCHEMA_ERROR_OPERAND_STRING,
+		.data.str.val = val,
+		.data.str.len = len };
+	return op;
+}
+
 static inline void jso_schema_clear_error(jso_schema *schema)
 {
 	jso_schema_error_clear(JSO_SCHEMA_ERROR(schema));
@@ -180,6 +180,8 @@ jso_rc jso_schema_keyword_set_union_of_2_types(jso_schema *schema, jso_value *da
 jso_rc jso_schema_keyword_validate_array_of_strings(
 		jso_schema *schema, const char *key, jso_array *arr, jso_uint32 keyword_flags);
 
+void jso_schema_keyword_hash_array_of_strings(jso_array *arr);
+
 jso_rc jso_schema_keyword_convert_to_number(jso_schema_keyword *schema_keyword, jso_number *num);
 
 void jso_schema_keyword_clear(jso_schema_keyword *keyword);
@@ -61,6 +61,18 @@ jso_rc jso_schema_keyword_validate_array_of_strings(
 	return JSO_SUCCESS;
 }
 
+void jso_schema_keyword_hash_array_of_strings(jso_array *arr)
+{
+	jso_value *item;
+
+	/* the hashes are cached in the strings so they must not be computed during validation */
+	JSO_ARRAY_FOREACH(arr, item)
+	{
+		jso_string_hash(JSO_STR_P(item));
+	}
+	JSO_ARRAY_FOREACH_END;
+}
+
 jso_schema_keyword *jso_schema_keyword_get_array(jso_schema *schema, jso_value *data,
 		const char *key, jso_bool error_on_invalid_type, jso_uint32 keyword_flags,
 		jso_schema_keyword *schema_keyword, jso_value *val, jso_schema_value *parent)
@@ -94,6 +106,7 @@ jso_schema_keyword *jso_schema_keyword_get_array_of_strings(jso_schema *schema,
 			== JSO_FAILURE) {
 		return NULL;
 	}
+	jso_schema_keyword_hash_array_of_strings(arr);
 
 	JSO_SCHEMA_KEYWORD_FLAGS_P(schema_keyword) = keyword_flags | JSO_SCHEMA_KEYWORD_FLAG_PRESENT;
 	JSO_SCHEMA_KEYWORD_TYPE_P(schema_keyword) = JSO_SCHEMA_KEYWORD_TYPE_ARRAY_OF_STRINGS;
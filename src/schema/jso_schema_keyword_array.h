@@ -34,6 +34,8 @@
 jso_rc jso_schema_keyword_validate_array_of_strings(
 		jso_schema *schema, const char *key, jso_array *arr, jso_uint32 keyword_flags);
 
+void jso_schema_keyword_hash_array_of_strings(jso_array *arr);
+
 jso_schema_keyword *jso_schema_keyword_get_array(jso_schema *schema, jso_value *data,
 		const char *key, jso_bool error_on_invalid_type, jso_uint32 keyword_flags,
 		jso_schema_keyword *schema_keyword, jso_value *val, jso_schema_value *parent);
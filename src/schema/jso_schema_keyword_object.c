@@ -111,6 +111,7 @@ static inline jso_schema_keyword *jso_schema_keyword_get_custom_object(jso_schem
 					== JSO_FAILURE) {
 				return NULL;
 			}
+			jso_schema_keyword_hash_array_of_strings(arr);
 			JSO_VALUE_SET_ARRAY(objval, jso_array_copy(arr));
 		} else {
 			if (JSO_TYPE_P(item) != JSO_TYPE_OBJECT
@@ -142,7 +143,15 @@ static inline jso_schema_keyword *jso_schema_keyword_get_custom_object(jso_schem
 			JSO_VALUE_SET_SCHEMA_VALUE(objval, schema_value);
 		}
 
-		jso_rc add_res = jso_object_add(schema_obj, jso_string_copy(objkey), &objval);
+		jso_string *schema_objkey = jso_string_copy(objkey);
+		if (schema_objkey == NULL) {
+			jso_schema_error_format(schema, JSO_SCHEMA_ERROR_KEYWORD_ALLOC,
+					"Allocating object key for keyword %s failed", key);
+			jso_value_clear(&objval);
+			jso_object_free(schema_obj);
+			return NULL;
+		}
+		jso_rc add_res = jso_object_add(schema_obj, schema_objkey, &objval);
 		JSO_ASSERT_EQ(add_res, JSO_SUCCESS);
 	}
 	JSO_OBJECT_FOREACH_END;
@@ -37,8 +37,9 @@ jso_re_code *jso_schema_keyword_get_regexp_code(
 					"Allocating regular expression code for keyword %s failed", keyword_key);
 		} else {
 			jso_schema_error_format(schema, JSO_SCHEMA_ERROR_KEYWORD_ALLOC,
-					"Allocating regular expression code for key %s in keyword %s failed",
-					JSO_STRING_VAL(object_key), keyword_key);
+					"Allocating regular expression code for key %.*s in keyword %s failed",
+					(int) JSO_STRING_LEN(object_key), (const char *) JSO_STRING_VAL(object_key),
+					keyword_key);
 		}
 		return NULL;
 	}
@@ -53,9 +54,10 @@ jso_re_code *jso_schema_keyword_get_regexp_code(
 					jso_re_get_error_message(code, buf, sizeof(buf)));
 		} else {
 			jso_schema_error_format(schema, JSO_SCHEMA_ERROR_KEYWORD_PREP,
-					"Compiling regular expression for key %s in keyword %s failed at position %zu "
-					"with error: %s",
-					JSO_STRING_VAL(object_key), keyword_key, jso_re_get_error_offset(code),
+					"Compiling regular expression for key %.*s in keyword %s failed at position "
+					"%zu with error: %s",
+					(int) JSO_STRING_LEN(object_key), (const char *) JSO_STRING_VAL(object_key),
+					keyword_key, jso_re_get_error_offset(code),
 					jso_re_get_error_message(code, buf, sizeof(buf)));
 		}
 		jso_re_code_free(code);
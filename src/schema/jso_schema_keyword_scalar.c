@@ -35,11 +35,15 @@ jso_schema_keyword *jso_schema_keyword_get_any(jso_schema *schema, jso_value *da
 {
 	val = jso_schema_data_get_value(schema, data, key, keyword_flags, val);
 	if (val != NULL) {
+		val = jso_value_copy(val);
+		if (val == NULL) {
+			jso_schema_error_format(schema, JSO_SCHEMA_ERROR_KEYWORD_ALLOC,
+					"Allocating value for keyword %s failed", key);
+			return NULL;
+		}
 		JSO_SCHEMA_KEYWORD_FLAGS_P(schema_keyword)
 				= keyword_flags | JSO_SCHEMA_KEYWORD_FLAG_PRESENT;
 		JSO_SCHEMA_KEYWORD_TYPE_P(schema_keyword) = JSO_SCHEMA_KEYWORD_TYPE_ANY;
-		val = jso_value_copy(val);
-		JSO_ASSERT_NOT_NULL(val);
 		JSO_SCHEMA_KEYWORD_DATA_ANY_P(schema_keyword) = val;
 		return schema_keyword;
 	}
@@ -182,10 +186,16 @@ jso_schema_keyword *jso_schema_keyword_get_string(jso_schema *schema, jso_value
 	val = jso_schema_data_get(
 			schema, data, key, JSO_TYPE_STRING, keyword_flags, error_on_invalid_type, val);
 	if (val != NULL) {
+		jso_string *str = jso_string_copy(JSO_STR_P(val));
+		if (str == NULL) {
+			jso_schema_error_format(schema, JSO_SCHEMA_ERROR_KEYWORD_ALLOC,
+					"Allocating string for keyword %s failed", key);
+			return NULL;
+		}
 		JSO_SCHEMA_KEYWORD_FLAGS_P(schema_keyword)
 				= keyword_flags | JSO_SCHEMA_KEYWORD_FLAG_PRESENT;
 		JSO_SCHEMA_KEYWORD_TYPE_P(schema_keyword) = JSO_SCHEMA_KEYWORD_TYPE_STRING;
-		JSO_SCHEMA_KEYWORD_DATA_STR_P(schema_keyword) = jso_string_copy(JSO_STR_P(val));
+		JSO_SCHEMA_KEYWORD_DATA_STR_P(schema_keyword) = str;
 		return schema_keyword;
 	}
 	return NULL;
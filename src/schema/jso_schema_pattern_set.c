@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "jso_schema_pattern_set.h"
+
+#include "jso_schema_error.h"
+
+#include "../jso.h"
+#include "../jso_re.h"
+
+#include <ctype.h>
+#include <string.h>
+
+/* check whether the pattern has alternation outside of any group that makes the anchor partial */
+static jso_bool jso_schema_pattern_has_top_alternation(const char *pattern, size_t len)
+{
+	size_t depth = 0;
+	for (size_t i = 0; i < len; i++) {
+		switch (pattern[i]) {
+			case '\\':
+				++i;
+				break;
+			case '[':
+				/* skip the class where the closing bracket can be the first item */
+				++i;
+				if (i < len && pattern[i] == '^') {
+					++i;
+				}
+				if (i < len && pattern[i] == ']') {
+					++i;
+				}
+				while (i < len && pattern[i] != ']') {
+					if (pattern[i] == '\\') {
+						++i;
+					}
+					++i;
+				}
+				break;
+			case '(':
+				++depth;
+				break;
+			case ')':
+				if (depth > 0) {
+					--depth;
+				}
+				break;
+			case '|':
+				if (depth == 0) {
+					return true;
+				}
+				break;
+		}
+	}
+
+	return false;
+}
+
+/* find the literal prefix of the anchored pattern */
+static void jso_schema_pattern_entry_init_prefix(
+		jso_schema_pattern_entry *entry, const char *pattern, size_t len)
+{
+	static const char metachars[] = ".^$|?*+()[]{}";
+	static const char quantifiers[] = "?*+{";
+
+	entry->prefix_len = 0;
+	entry->literal = false;
+	if (len == 0 || pattern[0] != '^' || jso_schema_pattern_has_top_alternation(pattern, len)) {
+		return;
+	}
+
+	size_t i = 1;
+	while (i < len && entry->prefix_len < JSO_SCHEMA_PATTERN_PREFIX_SIZE) {
+		char c = pattern[i];
+		size_t next = i + 1;
+		if (c == '\\') {
+			/* only escaped punctuation is literal (e.g. \d or \1 are not) */
+			if (next >= len || isalnum((unsigned char) pattern[next])) {
+				break;
+			}
+			c = pattern[next++];
+		} else if (memchr(metachars, c, sizeof(metachars) - 1) != NULL) {
+			break;
+		}
+		/* the quantified character does not have to be present */
+		if (next < len && memchr(quantifiers, pattern[next], sizeof(quantifiers) - 1) != NULL) {
+			break;
+		}
+		entry->prefix[entry->prefix_len++] = c;
+		i = next;
+	}
+	entry->literal = i == len;
+}
+
+jso_schema_pattern_set *jso_schema_pattern_set_create(jso_schema *schema, jso_object *pattern_props)
+{
+	jso_schema_pattern_set *set = jso_calloc(1, sizeof(jso_schema_pattern_set));
+	if (set == NULL) {
+		goto alloc_error;
+	}
+	size_t count = JSO_OBJECT_COUNT(pattern_props);
+	set->entries = jso_calloc(count ? count : 1, sizeof(jso_schema_pattern_entry));
+	set->order = jso_calloc(count ? count : 1, sizeof(jso_uint32));
+	if (set->entries == NULL || set->order == NULL) {
+		goto alloc_error;
+	}
+	set->count = count;
+
+	jso_string *pkey;
+	jso_value *pval;
+	size_t index = 0;
+	jso_uint32 bucket_counts[257] = { 0 };
+	JSO_OBJECT_FOREACH(pattern_props, pkey, pval)
+	{
+		JSO_ASSERT_EQ(JSO_TYPE_P(pval), JSO_TYPE_SCHEMA_VALUE);
+		jso_schema_pattern_entry *entry = &set->entries[index++];
+		entry->value = JSO_SVVAL_P(pval);
+		jso_string *pattern = JSO_RE_CODE_PATTERN(JSO_SCHEMA_VALUE_REGEXP_P(entry->value));
+		jso_schema_pattern_entry_init_prefix(
+				entry, (const char *) JSO_STRING_VAL(pattern), JSO_STRING_LEN(pattern));
+		++bucket_counts[entry->prefix_len ? (unsigned char) entry->prefix[0] : 256];
+	}
+	JSO_OBJECT_FOREACH_END;
+	JSO_USE(pkey);
+
+	/* group the entries by the first prefix byte so a key checks only the entries it can match */
+	jso_uint32 start = 0;
+	for (size_t b = 0; b < 257; b++) {
+		set->buckets[b] = start;
+		start += bucket_counts[b];
+	}
+	jso_uint32 positions[257];
+	memcpy(positions, set->buckets, sizeof(positions));
+	for (jso_uint32 i = 0; i < count; i++) {
+		jso_schema_pattern_entry *entry = &set->entries[i];
+		set->order[positions[entry->prefix_len ? (unsigned char) entry->prefix[0] : 256]++] = i;
+	}
+
+	return set;
+
+alloc_error:
+	jso_schema_pattern_set_free(set);
+	jso_schema_error_set(schema, JSO_SCHEMA_ERROR_KEYWORD_ALLOC,
+			"Allocating pattern set for keyword patternProperties failed");
+	return NULL;
+}
+
+void jso_schema_pattern_set_free(jso_schema_pattern_set *set)
+{
+	if (set != NULL) {
+		jso_free(set->entries);
+		jso_free(set->order);
+		jso_free(set);
+	}
+}
+
+void jso_schema_pattern_memo_free(jso_schema_pattern_memo *memo, const jso_allocator *allocator)
+{
+	if (memo != NULL) {
+		jso_allocator_free(allocator, memo->matches);
+		jso_allocator_free(allocator, memo);
+	}
+}
+
+/* get the stack memo with the matches capacity for the set */
+static jso_schema_pattern_memo *jso_schema_pattern_memo_get(
+		jso_schema_validation_stack *stack, jso_schema_pattern_set *set)
+{
+	const jso_allocator *allocator = stack->root_schema->allocator;
+	jso_schema_pattern_memo *memo = stack->pattern_memo;
+	if (memo == NULL) {
+		memo = jso_allocator_calloc(allocator, 1, sizeof(jso_schema_pattern_memo));
+		if (memo == NULL) {
+			return NULL;
+		}
+		stack->pattern_memo = memo;
+	}
+	if (memo->matches_capacity < set->count) {
+		jso_uint32 *matches
+				= jso_allocator_realloc(allocator, memo->matches, set->count * sizeof(jso_uint32));
+		if (matches == NULL) {
+			return NULL;
+		}
+		memo->matches = matches;
+		memo->matches_capacity = set->count;
+	}
+
+	return memo;
+}
+
+/* check whether the entry matches the key (1 if matched, 0 if not, -1 on match error) */
+static inline int jso_schema_pattern_entry_match(jso_schema_pattern_entry *entry,
+		jso_schema_validation_stack *stack, const char *key, size_t key_len)
+{
+	if (key_len < entry->prefix_len || memcmp(key, entry->prefix, entry->prefix_len) != 0) {
+		return 0;
+	}
+	if (entry->literal) {
+		return 1;
+	}
+	jso_re_code *code = JSO_SCHEMA_VALUE_REGEXP_P(entry->value);
+	int match_result = jso_re_match(key, key_len, code, stack->match_data);
+	if (match_result == JSO_RE_ERROR_NOMATCH) {
+		return 0;
+	}
+	if (match_result < 0) {
+		jso_schema_error_pattern_match(stack->root_schema, code, match_result);
+		return -1;
+	}
+	return 1;
+}
+
+jso_rc jso_schema_pattern_set_match(jso_schema_pattern_set *set, jso_schema_validation_stack *stack,
+		jso_virt_string *key, const jso_uint32 **matches, size_t *matches_count)
+{
+	const char *key_val = jso_virt_string_val(key);
+	size_t key_len = jso_virt_string_len(key);
+	jso_schema_pattern_memo *memo = jso_schema_pattern_memo_get(stack, set);
+	if (memo == NULL) {
+		jso_schema_error_set(stack->root_schema, JSO_SCHEMA_ERROR_VALIDATION_ALLOC,
+				"Allocating pattern properties memo failed");
+		return JSO_FAILURE;
+	}
+
+	/* the same keys repeat in the array items so their matches are memoized */
+	jso_uint32 hash = jso_string_hash_update(
+			JSO_STRING_HASH_INIT, (const jso_ctype *) key_val, key_len);
+	jso_schema_pattern_memo_slot *slot
+			= &memo->slots[(hash ^ (hash >> 15)) & (JSO_SCHEMA_PATTERN_MEMO_SIZE - 1)];
+	if (slot->set == set && slot->hash == hash && slot->key_len == key_len
+			&& memcmp(slot->key, key_val, key_len) == 0) {
+		*matches = slot->matches;
+		*matches_count = slot->count;
+		return JSO_SUCCESS;
+	}
+
+	size_t count = 0;
+	if (key_len > 0) {
+		jso_uint32 bucket = (unsigned char) key_val[0];
+		for (jso_uint32 i = set->buckets[bucket]; i < set->buckets[bucket + 1]; i++) {
+			jso_uint32 index = set->order[i];
+			int matched = jso_schema_pattern_entry_match(
+					&set->entries[index], stack, key_val, key_len);
+			if (matched < 0) {
+				return JSO_FAILURE;
+			}
+			if (matched) {
+				memo->matches[count++] = index;
+			}
+		}
+	}
+	for (jso_uint32 i = set->buckets[256]; i < set->count; i++) {
+		jso_uint32 index = set->order[i];
+		int matched
+				= jso_schema_pattern_entry_match(&set->entries[index], stack, key_val, key_len);
+		if (matched < 0) {
+			return JSO_FAILURE;
+		}
+		if (matched) {
+			memo->matches[count++] = index;
+		}
+	}
+
+	/* keep the pattern properties order (there are usually only few matches) */
+	for (size_t i = 1; i < count; i++) {
+		jso_uint32 index = memo->matches[i];
+		size_t j = i;
+		for (; j > 0 && memo->matches[j - 1] > index; j--) {
+			memo->matches[j] = memo->matches[j - 1];
+		}
+		memo->matches[j] = index;
+	}
+
+	if (key_len <= JSO_SCHEMA_PATTERN_MEMO_KEY_SIZE && count <= JSO_SCHEMA_PATTERN_MEMO_MATCHES) {
+		slot->set = set;
+		slot->hash = hash;
+		slot->key_len = key_len;
+		slot->count = count;
+		memcpy(slot->key, key_val, key_len);
+		memcpy(slot->matches, memo->matches, count * sizeof(jso_uint32));
+	}
+
+	*matches = memo->matches;
+	*matches_count = count;
+	return JSO_SUCCESS;
+}
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/**
+ * @file jso_schema_pattern_set.h
+ * @brief JsonSchema combined matcher of the pattern properties.
+ */
+
+#ifndef JSO_SCHEMA_PATTERN_SET_H
+#define JSO_SCHEMA_PATTERN_SET_H
+
+#include "../jso_schema.h"
+
+/** @brief Maximal length of the pattern literal prefix. */
+#define JSO_SCHEMA_PATTERN_PREFIX_SIZE 32
+
+/** @brief Number of the pattern memo slots (must be power of 2). */
+#define JSO_SCHEMA_PATTERN_MEMO_SIZE 256
+
+/** @brief Maximal length of the key that is memoized. */
+#define JSO_SCHEMA_PATTERN_MEMO_KEY_SIZE 48
+
+/** @brief Maximal number of the matched patterns that is memoized. */
+#define JSO_SCHEMA_PATTERN_MEMO_MATCHES 8
+
+/**
+ * @brief Pattern property entry.
+ */
+typedef struct _jso_schema_pattern_entry {
+	/** schema value of the pattern property with the compiled regular expression */
+	jso_schema_value *value;
+	/** literal prefix that every matched key starts with */
+	char prefix[JSO_SCHEMA_PATTERN_PREFIX_SIZE];
+	/** prefix length */
+	size_t prefix_len;
+	/** whether the whole pattern is the anchored literal prefix so no regex needs to run */
+	jso_bool literal;
+} jso_schema_pattern_entry;
+
+/**
+ * @brief Combined matcher of the pattern properties.
+ */
+struct _jso_schema_pattern_set {
+	/** entries in the pattern properties order */
+	jso_schema_pattern_entry *entries;
+	/** number of entries */
+	size_t count;
+	/** entry indices grouped by the first prefix byte with the not prefixed entries at the end */
+	jso_uint32 *order;
+	/** start of the first prefix byte groups in order and start of the not prefixed entries */
+	jso_uint32 buckets[257];
+};
+
+/**
+ * @brief Memoized matches of a single key.
+ */
+typedef struct _jso_schema_pattern_memo_slot {
+	/** pattern set of the matches or NULL if the slot is empty */
+	const jso_schema_pattern_set *set;
+	/** key hash */
+	jso_uint32 hash;
+	/** number of matches */
+	jso_uint32 count;
+	/** key length */
+	size_t key_len;
+	/** key value */
+	char key[JSO_SCHEMA_PATTERN_MEMO_KEY_SIZE];
+	/** matched entry indices */
+	jso_uint32 matches[JSO_SCHEMA_PATTERN_MEMO_MATCHES];
+} jso_schema_pattern_memo_slot;
+
+/**
+ * @brief Pattern matches memo of a validation stack.
+ */
+struct _jso_schema_pattern_memo {
+	/** memoized keys */
+	jso_schema_pattern_memo_slot slots[JSO_SCHEMA_PATTERN_MEMO_SIZE];
+	/** matched entry indices of the last not memoized key */
+	jso_uint32 *matches;
+	/** capacity of the matches */
+	size_t matches_capacity;
+};
+
+/**
+ * Create pattern set from the pattern properties.
+ *
+ * @param schema schema for setting error
+ * @param pattern_props pattern properties object of schema values with regular expressions
+ * @return Created pattern set or NULL on error.
+ */
+jso_schema_pattern_set *jso_schema_pattern_set_create(
+		jso_schema *schema, jso_object *pattern_props);
+
+/**
+ * Free pattern set.
+ *
+ * @param set pattern set (can be NULL)
+ */
+void jso_schema_pattern_set_free(jso_schema_pattern_set *set);
+
+/**
+ * Find all pattern properties matching the key.
+ *
+ * The matches are in the pattern properties order and are valid until the next match.
+ *
+ * @param set pattern set
+ * @param stack validation stack holding the memo
+ * @param key instance key
+ * @param matches matched entry indices
+ * @param matches_count number of matched entries
+ * @return JSO_SUCCESS on success, otherwise JSO_FAILURE.
+ */
+jso_rc jso_schema_pattern_set_match(jso_schema_pattern_set *set, jso_schema_validation_stack *stack,
+		jso_virt_string *key, const jso_uint32 **matches, size_t *matches_count);
+
+/**
+ * Get schema value of the pattern set entry.
+ *
+ * @param set pattern set
+ * @param index entry index
+ * @return Schema value of the pattern property.
+ */
+static inline jso_schema_value *jso_schema_pattern_set_value(
+		jso_schema_pattern_set *set, jso_uint32 index)
+{
+	return set->entries[index].value;
+}
+
+/**
+ * Free pattern memo.
+ *
+ * @param memo pattern memo (can be NULL)
+ * @param allocator allocator of the memo
+ */
+void jso_schema_pattern_memo_free(jso_schema_pattern_memo *memo, const jso_allocator *allocator);
+
+#endif /* JSO_SCHEMA_PATTERN_SET_H */
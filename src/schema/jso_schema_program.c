@@ -0,0 +1,364 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "jso_schema_array.h"
+#include "jso_schema_error.h"
+#include "jso_schema_keyword.h"
+#include "jso_schema_program.h"
+
+#include "../jso.h"
+
+/**
+ * @brief Program builder with the operations of a single value.
+ */
+typedef struct _jso_schema_program_builder {
+	/** emitted operations */
+	jso_schema_op ops[JSO_SCHEMA_PROGRAM_MAX_OPS];
+	/** number of emitted operations */
+	size_t count;
+} jso_schema_program_builder;
+
+static inline jso_schema_op *jso_schema_program_emit(
+		jso_schema_program_builder *builder, jso_schema_op_code code)
+{
+	JSO_ASSERT_LT(builder->count, JSO_SCHEMA_PROGRAM_MAX_OPS - 1);
+	jso_schema_op *op = &builder->ops[builder->count++];
+	op->code = code;
+	return op;
+}
+
+static inline void jso_schema_program_emit_int(
+		jso_schema_program_builder *builder, jso_schema_op_code code, jso_schema_keyword *keyword)
+{
+	jso_schema_program_emit(builder, code)->ival = JSO_SCHEMA_KEYWORD_DATA_INT_P(keyword);
+}
+
+static inline void jso_schema_program_emit_uint(
+		jso_schema_program_builder *builder, jso_schema_op_code code, jso_schema_keyword *keyword)
+{
+	jso_schema_program_emit(builder, code)->uval = JSO_SCHEMA_KEYWORD_DATA_UINT_P(keyword);
+}
+
+static inline void jso_schema_program_emit_number(
+		jso_schema_program_builder *builder, jso_schema_op_code code, jso_schema_keyword *keyword)
+{
+	jso_schema_op *op = jso_schema_program_emit(builder, code);
+	JSO_ASSERT_EQ(jso_schema_keyword_convert_to_number(keyword, &op->num), JSO_SUCCESS);
+}
+
+static void jso_schema_program_compile_common(
+		jso_schema *schema, jso_schema_program_builder *builder, jso_schema_value *value)
+{
+	jso_schema_value_common *comval = JSO_SCHEMA_VALUE_DATA_COMMON_P(value);
+
+	if (JSO_SCHEMA_KW_IS_SET(comval->any_of)) {
+		jso_schema_program_emit(builder, JSO_SCHEMA_OP_ANY_OF);
+	}
+	if (JSO_SCHEMA_KW_IS_SET(comval->one_of)) {
+		jso_schema_program_emit(builder, JSO_SCHEMA_OP_ONE_OF);
+	}
+	if (JSO_SCHEMA_KW_IS_SET(comval->type_list)) {
+		jso_schema_program_emit(builder, JSO_SCHEMA_OP_TYPE_LIST);
+	}
+	if (JSO_SCHEMA_KW_IS_SET(comval->enum_elements)) {
+		jso_schema_program_emit(builder, JSO_SCHEMA_OP_ENUM)->arr
+				= JSO_SCHEMA_KEYWORD_DATA_ARR(comval->enum_elements);
+	}
+	if (JSO_SCHEMA_KW_IS_SET(comval->const_value)) {
+		jso_schema_program_emit(builder, JSO_SCHEMA_OP_CONST)->val
+				= JSO_SCHEMA_KEYWORD_DATA_ANY(comval->const_value);
+	}
+}
+
+static void jso_schema_program_compile_integer(
+		jso_schema *schema, jso_schema_program_builder *builder, jso_schema_value *value)
+{
+	jso_schema_value_integer *intval = JSO_SCHEMA_VALUE_DATA_INT_P(value);
+
+	jso_schema_program_emit(builder, JSO_SCHEMA_OP_TYPE_INTEGER);
+
+	if (schema->version >= JSO_SCHEMA_VERSION_DRAFT_06) {
+		if (JSO_SCHEMA_KW_IS_SET(intval->minimum)) {
+			jso_schema_program_emit_int(builder, JSO_SCHEMA_OP_INT_MINIMUM, &intval->minimum);
+		}
+		if (JSO_SCHEMA_KW_IS_SET(intval->exclusive_minimum)) {
+			jso_schema_program_emit_int(
+					builder, JSO_SCHEMA_OP_INT_EXCLUSIVE_MINIMUM, &intval->exclusive_minimum);
+		}
+		if (JSO_SCHEMA_KW_IS_SET(intval->maximum)) {
+			jso_schema_program_emit_int(builder, JSO_SCHEMA_OP_INT_MAXIMUM, &intval->maximum);
+		}
+		if (JSO_SCHEMA_KW_IS_SET(intval->exclusive_maximum)) {
+			jso_schema_program_emit_int(
+					builder, JSO_SCHEMA_OP_INT_EXCLUSIVE_MAXIMUM, &intval->exclusive_maximum);
+		}
+	} else { // Draft 4
+		if (JSO_SCHEMA_KW_IS_SET(intval->minimum)) {
+			jso_schema_program_emit_int(builder, JSO_SCHEMA_OP_INT_MINIMUM, &intval->minimum);
+			if (JSO_SCHEMA_KW_IS_SET(intval->exclusive_minimum)
+					&& JSO_SCHEMA_KEYWORD_DATA_BOOL(intval->exclusive_minimum)) {
+				jso_schema_program_emit_int(
+						builder, JSO_SCHEMA_OP_INT_MINIMUM_EQUAL, &intval->minimum);
+			}
+		}
+		if (JSO_SCHEMA_KW_IS_SET(intval->maximum)) {
+			jso_schema_program_emit_int(builder, JSO_SCHEMA_OP_INT_MAXIMUM, &intval->maximum);
+			if (JSO_SCHEMA_KW_IS_SET(intval->exclusive_maximum)
+					&& JSO_SCHEMA_KEYWORD_DATA_BOOL(intval->exclusive_maximum)) {
+				jso_schema_program_emit_int(
+						builder, JSO_SCHEMA_OP_INT_MAXIMUM_EQUAL, &intval->maximum);
+			}
+		}
+	}
+
+	if (JSO_SCHEMA_KW_IS_SET(intval->multiple_of)) {
+		jso_schema_program_emit_int(builder, JSO_SCHEMA_OP_INT_MULTIPLE_OF, &intval->multiple_of);
+	}
+}
+
+static void jso_schema_program_compile_number(
+		jso_schema *schema, jso_schema_program_builder *builder, jso_schema_value *value)
+{
+	jso_schema_value_number *numval = JSO_SCHEMA_VALUE_DATA_NUM_P(value);
+
+	jso_schema_program_emit(builder, JSO_SCHEMA_OP_TYPE_NUMBER);
+
+	if (schema->version >= JSO_SCHEMA_VERSION_DRAFT_06) {
+		if (JSO_SCHEMA_KW_IS_SET(numval->minimum)) {
+			jso_schema_program_emit_number(builder, JSO_SCHEMA_OP_NUM_MINIMUM, &numval->minimum);
+		}
+		if (JSO_SCHEMA_KW_IS_SET(numval->exclusive_minimum)) {
+			jso_schema_program_emit_number(
+					builder, JSO_SCHEMA_OP_NUM_EXCLUSIVE_MINIMUM, &numval->exclusive_minimum);
+		}
+		if (JSO_SCHEMA_KW_IS_SET(numval->maximum)) {
+			jso_schema_program_emit_number(builder, JSO_SCHEMA_OP_NUM_MAXIMUM, &numval->maximum);
+		}
+		if (JSO_SCHEMA_KW_IS_SET(numval->exclusive_maximum)) {
+			jso_schema_program_emit_number(
+					builder, JSO_SCHEMA_OP_NUM_EXCLUSIVE_MAXIMUM, &numval->exclusive_maximum);
+		}
+	} else { // Draft 4
+		if (JSO_SCHEMA_KW_IS_SET(numval->minimum)) {
+			jso_schema_program_emit_number(builder, JSO_SCHEMA_OP_NUM_MINIMUM, &numval->minimum);
+			if (JSO_SCHEMA_KW_IS_SET(numval->exclusive_minimum)
+					&& JSO_SCHEMA_KEYWORD_DATA_BOOL(numval->exclusive_minimum)) {
+				jso_schema_program_emit_number(
+						builder, JSO_SCHEMA_OP_NUM_MINIMUM_EQUAL, &numval->minimum);
+			}
+		}
+		if (JSO_SCHEMA_KW_IS_SET(numval->maximum)) {
+			jso_schema_program_emit_number(builder, JSO_SCHEMA_OP_NUM_MAXIMUM, &numval->maximum);
+			if (JSO_SCHEMA_KW_IS_SET(numval->exclusive_maximum)
+					&& JSO_SCHEMA_KEYWORD_DATA_BOOL(numval->exclusive_maximum)) {
+				jso_schema_program_emit_number(
+						builder, JSO_SCHEMA_OP_NUM_MAXIMUM_EQUAL, &numval->maximum);
+			}
+		}
+	}
+
+	if (JSO_SCHEMA_KW_IS_SET(numval->multiple_of)) {
+		jso_schema_program_emit_number(
+				builder, JSO_SCHEMA_OP_NUM_MULTIPLE_OF, &numval->multiple_of);
+	}
+}
+
+static void jso_schema_program_compile_string(
+		jso_schema *schema, jso_schema_program_builder *builder, jso_schema_value *value)
+{
+	jso_schema_value_string *strval = JSO_SCHEMA_VALUE_DATA_STR_P(value);
+
+	jso_schema_program_emit(builder, JSO_SCHEMA_OP_TYPE_STRING);
+
+	if (JSO_SCHEMA_KW_IS_SET(strval->min_length)) {
+		jso_schema_program_emit_uint(builder, JSO_SCHEMA_OP_MIN_LENGTH, &strval->min_length);
+	}
+	if (JSO_SCHEMA_KW_IS_SET(strval->max_length)) {
+		jso_schema_program_emit_uint(builder, JSO_SCHEMA_OP_MAX_LENGTH, &strval->max_length);
+	}
+	if (JSO_SCHEMA_KW_IS_SET(strval->pattern)) {
+		JSO_ASSERT_EQ(JSO_SCHEMA_KEYWORD_TYPE(strval->pattern), JSO_SCHEMA_KEYWORD_TYPE_REGEXP);
+		jso_schema_program_emit(builder, JSO_SCHEMA_OP_PATTERN)->re
+				= JSO_SCHEMA_KEYWORD_DATA_RE(strval->pattern);
+	}
+}
+
+static void jso_schema_program_compile_array(
+		jso_schema *schema, jso_schema_program_builder *builder, jso_schema_value *value)
+{
+	jso_schema_value_array *arrval = JSO_SCHEMA_VALUE_DATA_ARR_P(value);
+
+	jso_schema_program_emit(builder, JSO_SCHEMA_OP_TYPE_ARRAY);
+
+	if (JSO_SCHEMA_KW_IS_SET(arrval->min_items)) {
+		jso_schema_program_emit_uint(builder, JSO_SCHEMA_OP_MIN_ITEMS, &arrval->min_items);
+	}
+	if (JSO_SCHEMA_KW_IS_SET(arrval->unique_items)
+			&& JSO_SCHEMA_KEYWORD_DATA_BOOL(arrval->unique_items)) {
+		jso_schema_program_emit(builder, JSO_SCHEMA_OP_UNIQUE_ITEMS);
+	}
+	if (JSO_SCHEMA_KW_IS_SET(arrval->contains)) {
+		jso_schema_program_emit(builder, JSO_SCHEMA_OP_CONTAINS)->value
+				= JSO_SCHEMA_KEYWORD_DATA_SCHEMA_OBJ(arrval->contains);
+	}
+}
+
+static void jso_schema_program_compile_object(
+		jso_schema *schema, jso_schema_program_builder *builder, jso_schema_value *value)
+{
+	jso_schema_value_object *objval = JSO_SCHEMA_VALUE_DATA_OBJ_P(value);
+
+	jso_schema_program_emit(builder, JSO_SCHEMA_OP_TYPE_OBJECT);
+
+	if (JSO_SCHEMA_KW_IS_SET(objval->dependencies)) {
+		jso_schema_program_emit(builder, JSO_SCHEMA_OP_DEPENDENCIES)->obj
+				= JSO_SCHEMA_KEYWORD_DATA_OBJ_SCHEMA_OBJ(objval->dependencies);
+	}
+	if (JSO_SCHEMA_KW_IS_SET(objval->min_properties)) {
+		jso_schema_program_emit_uint(
+				builder, JSO_SCHEMA_OP_MIN_PROPERTIES, &objval->min_properties);
+	}
+	if (JSO_SCHEMA_KW_IS_SET(objval->required)) {
+		jso_schema_program_emit(builder, JSO_SCHEMA_OP_REQUIRED)->arr
+				= JSO_SCHEMA_KEYWORD_DATA_ARR_STR(objval->required);
+	}
+}
+
+static void jso_schema_program_compile_none(
+		jso_schema *schema, jso_schema_program_builder *builder, jso_schema_value *value)
+{
+}
+
+static void jso_schema_program_compile_null(
+		jso_schema *schema, jso_schema_program_builder *builder, jso_schema_value *value)
+{
+	jso_schema_program_emit(builder, JSO_SCHEMA_OP_TYPE_NULL);
+}
+
+static void jso_schema_program_compile_boolean(
+		jso_schema *schema, jso_schema_program_builder *builder, jso_schema_value *value)
+{
+	jso_schema_program_emit(builder, JSO_SCHEMA_OP_TYPE_BOOLEAN);
+}
+
+typedef void (*jso_schema_program_compile_callback)(
+		jso_schema *schema, jso_schema_program_builder *builder, jso_schema_value *value);
+
+static const jso_schema_program_compile_callback schema_program_compile_callbacks[] = {
+	[JSO_SCHEMA_VALUE_TYPE_MIXED] = jso_schema_program_compile_none,
+	[JSO_SCHEMA_VALUE_TYPE_NULL] = jso_schema_program_compile_null,
+	[JSO_SCHEMA_VALUE_TYPE_BOOLEAN] = jso_schema_program_compile_boolean,
+	[JSO_SCHEMA_VALUE_TYPE_INTEGER] = jso_schema_program_compile_integer,
+	[JSO_SCHEMA_VALUE_TYPE_NUMBER] = jso_schema_program_compile_number,
+	[JSO_SCHEMA_VALUE_TYPE_STRING] = jso_schema_program_compile_string,
+	[JSO_SCHEMA_VALUE_TYPE_ARRAY] = jso_schema_program_compile_array,
+	[JSO_SCHEMA_VALUE_TYPE_OBJECT] = jso_schema_program_compile_object,
+};
+
+static inline jso_bool jso_schema_program_has_schema_objects(jso_schema_keyword *keyword)
+{
+	return JSO_SCHEMA_KEYWORD_IS_PRESENT_P(keyword)
+			&& JSO_SCHEMA_KEYWORD_DATA_ARR_SCHEMA_OBJ_P(keyword)->len > 0;
+}
+
+static jso_bool jso_schema_program_is_composed(jso_schema_value *value)
+{
+	jso_schema_value_common *comval = JSO_SCHEMA_VALUE_DATA_COMMON_P(value);
+
+	return value->ref != NULL || jso_schema_program_has_schema_objects(&comval->type_any)
+			|| jso_schema_program_has_schema_objects(&comval->type_list)
+			|| jso_schema_program_has_schema_objects(&comval->all_of)
+			|| jso_schema_program_has_schema_objects(&comval->any_of)
+			|| jso_schema_program_has_schema_objects(&comval->one_of)
+			|| JSO_SCHEMA_KW_IS_SET(comval->not);
+}
+
+static jso_rc jso_schema_program_compile_typed(jso_schema *schema, jso_schema_keyword *keyword)
+{
+	if (!JSO_SCHEMA_KEYWORD_IS_PRESENT_P(keyword)) {
+		return JSO_SUCCESS;
+	}
+	jso_schema_value *value;
+	jso_schema_array *array = JSO_SCHEMA_KEYWORD_DATA_ARR_SCHEMA_OBJ_P(keyword);
+	JSO_SCHEMA_ARRAY_FOREACH(array, value)
+	{
+		if (jso_schema_program_compile(schema, value) == JSO_FAILURE) {
+			return JSO_FAILURE;
+		}
+	}
+	JSO_SCHEMA_ARRAY_FOREACH_END;
+
+	return JSO_SUCCESS;
+}
+
+jso_rc jso_schema_program_compile(jso_schema *schema, jso_schema_value *value)
+{
+	if (value->program != NULL
+			|| JSO_SCHEMA_VALUE_TYPE_P(value) == JSO_SCHEMA_VALUE_TYPE_OBJECT_BOOLEAN) {
+		return JSO_SUCCESS;
+	}
+
+	jso_schema_value_common *comval = JSO_SCHEMA_VALUE_DATA_COMMON_P(value);
+	if (jso_schema_program_compile_typed(schema, &comval->type_any) == JSO_FAILURE
+			|| jso_schema_program_compile_typed(schema, &comval->type_list) == JSO_FAILURE) {
+		return JSO_FAILURE;
+	}
+
+	jso_schema_program_builder builder;
+	builder.count = 0;
+	jso_schema_value *jump = NULL;
+
+	if (JSO_SCHEMA_VALUE_FLAGS_P(value) & JSO_SCHEMA_VALUE_FLAG_REF_ONLY) {
+		// The reference target is already parsed and compiled so the chain of references is
+		// resolved to its final target.
+		JSO_ASSERT_NOT_NULL(value->ref);
+		jump = JSO_SCHEMA_REFERENCE_RESULT(value->ref);
+		if (jump != NULL) {
+			jump = jso_schema_program_target(jump);
+		}
+	} else {
+		jso_schema_program_compile_common(schema, &builder, value);
+		schema_program_compile_callbacks[JSO_SCHEMA_VALUE_TYPE_P(value)](schema, &builder, value);
+	}
+	jso_schema_program_emit(&builder, JSO_SCHEMA_OP_END);
+
+	jso_schema_program *program
+			= jso_malloc(sizeof(jso_schema_program) + builder.count * sizeof(jso_schema_op));
+	if (program == NULL) {
+		jso_schema_error_set(
+				schema, JSO_SCHEMA_ERROR_VALUE_DATA_ALLOC, "Allocating value program failed");
+		return JSO_FAILURE;
+	}
+	program->jump = jump;
+	program->composed = jso_schema_program_is_composed(value);
+	program->count = builder.count - 1;
+	memcpy(program->ops, builder.ops, builder.count * sizeof(jso_schema_op));
+	value->program = program;
+
+	return JSO_SUCCESS;
+}
+
+void jso_schema_program_free(jso_schema_program *program)
+{
+	jso_free(program);
+}
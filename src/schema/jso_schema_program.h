@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/**
+ * @file jso_schema_program.h
+ * @brief JsonSchema validation program compiled from the value keywords.
+ */
+
+#ifndef JSO_SCHEMA_PROGRAM_H
+#define JSO_SCHEMA_PROGRAM_H
+
+#include "../jso_schema.h"
+
+/** @brief Maximal number of operations of a single value program including the end. */
+#define JSO_SCHEMA_PROGRAM_MAX_OPS 16
+
+/**
+ * @brief Validation program operation code.
+ *
+ * The operations are executed in the order of the interpreted keyword checks so the first failed
+ * check reports the same error.
+ */
+typedef enum _jso_schema_op_code {
+	/** end of the program */
+	JSO_SCHEMA_OP_END = 0,
+	/** anyOf composition result check */
+	JSO_SCHEMA_OP_ANY_OF,
+	/** oneOf composition result check */
+	JSO_SCHEMA_OP_ONE_OF,
+	/** type list composition result check */
+	JSO_SCHEMA_OP_TYPE_LIST,
+	/** enum check with array operand */
+	JSO_SCHEMA_OP_ENUM,
+	/** const check with value operand */
+	JSO_SCHEMA_OP_CONST,
+	/** null type check */
+	JSO_SCHEMA_OP_TYPE_NULL,
+	/** boolean type check */
+	JSO_SCHEMA_OP_TYPE_BOOLEAN,
+	/** integer type check loading the instance integer */
+	JSO_SCHEMA_OP_TYPE_INTEGER,
+	/** number type check loading the instance number */
+	JSO_SCHEMA_OP_TYPE_NUMBER,
+	/** string type check loading the instance string */
+	JSO_SCHEMA_OP_TYPE_STRING,
+	/** array type check */
+	JSO_SCHEMA_OP_TYPE_ARRAY,
+	/** object type check */
+	JSO_SCHEMA_OP_TYPE_OBJECT,
+	/** integer minimum check */
+	JSO_SCHEMA_OP_INT_MINIMUM,
+	/** integer exclusiveMinimum check */
+	JSO_SCHEMA_OP_INT_EXCLUSIVE_MINIMUM,
+	/** integer Draft 4 exclusiveMinimum check of the instance equal to minimum */
+	JSO_SCHEMA_OP_INT_MINIMUM_EQUAL,
+	/** integer maximum check */
+	JSO_SCHEMA_OP_INT_MAXIMUM,
+	/** integer exclusiveMaximum check */
+	JSO_SCHEMA_OP_INT_EXCLUSIVE_MAXIMUM,
+	/** integer Draft 4 exclusiveMaximum check of the instance equal to maximum */
+	JSO_SCHEMA_OP_INT_MAXIMUM_EQUAL,
+	/** integer multipleOf check */
+	JSO_SCHEMA_OP_INT_MULTIPLE_OF,
+	/** number minimum check */
+	JSO_SCHEMA_OP_NUM_MINIMUM,
+	/** number exclusiveMinimum check */
+	JSO_SCHEMA_OP_NUM_EXCLUSIVE_MINIMUM,
+	/** number Draft 4 exclusiveMinimum check of the instance equal to minimum */
+	JSO_SCHEMA_OP_NUM_MINIMUM_EQUAL,
+	/** number maximum check */
+	JSO_SCHEMA_OP_NUM_MAXIMUM,
+	/** number exclusiveMaximum check */
+	JSO_SCHEMA_OP_NUM_EXCLUSIVE_MAXIMUM,
+	/** number Draft 4 exclusiveMaximum check of the instance equal to maximum */
+	JSO_SCHEMA_OP_NUM_MAXIMUM_EQUAL,
+	/** number multipleOf check */
+	JSO_SCHEMA_OP_NUM_MULTIPLE_OF,
+	/** string minLength check */
+	JSO_SCHEMA_OP_MIN_LENGTH,
+	/** string maxLength check */
+	JSO_SCHEMA_OP_MAX_LENGTH,
+	/** string pattern check */
+	JSO_SCHEMA_OP_PATTERN,
+	/** array minItems check */
+	JSO_SCHEMA_OP_MIN_ITEMS,
+	/** array uniqueItems check */
+	JSO_SCHEMA_OP_UNIQUE_ITEMS,
+	/** array contains check */
+	JSO_SCHEMA_OP_CONTAINS,
+	/** object property dependencies check */
+	JSO_SCHEMA_OP_DEPENDENCIES,
+	/** object minProperties check */
+	JSO_SCHEMA_OP_MIN_PROPERTIES,
+	/** object required check */
+	JSO_SCHEMA_OP_REQUIRED,
+} jso_schema_op_code;
+
+/**
+ * @brief Validation program operation.
+ */
+typedef struct _jso_schema_op {
+	/** operation code */
+	jso_schema_op_code code;
+	/** operand of the operation */
+	union {
+		/** integer operand */
+		jso_int ival;
+		/** unsigned integer operand */
+		jso_uint uval;
+		/** number operand converted from the keyword on compilation */
+		jso_number num;
+		/** regular expression operand */
+		jso_re_code *re;
+		/** value operand */
+		jso_value *val;
+		/** array operand */
+		jso_array *arr;
+		/** object operand */
+		jso_object *obj;
+		/** schema value operand */
+		jso_schema_value *value;
+	};
+} jso_schema_op;
+
+/**
+ * @brief Validation program of a schema value.
+ *
+ * The program contains only operations for the keywords that are set. The keywords that push
+ * the child values (properties, items and compositions) are still handled by the stack.
+ */
+struct _jso_schema_program {
+	/** resolved reference target that is validated instead of the reference only value */
+	jso_schema_value *jump;
+	/** whether the value has a reference or composition that pushes the composed positions */
+	jso_bool composed;
+	/** number of operations without the end operation */
+	size_t count;
+	/** operations terminated by @ref JSO_SCHEMA_OP_END */
+	jso_schema_op ops[];
+};
+
+/**
+ * Compile the value keywords to the validation program.
+ *
+ * The typed subschemas of the value type are compiled as well because they are not parsed
+ * as separate values. The value is kept unchanged if it is already compiled.
+ *
+ * @param schema schema for setting error
+ * @param value schema value
+ * @return JSO_SUCCESS on success, otherwise JSO_FAILURE.
+ */
+jso_rc jso_schema_program_compile(jso_schema *schema, jso_schema_value *value);
+
+/**
+ * Free validation program.
+ *
+ * @param program validation program (can be NULL)
+ */
+void jso_schema_program_free(jso_schema_program *program);
+
+/**
+ * Get value that is validated in place of the supplied value.
+ *
+ * This is the reference target for the compiled reference only values so the reference is
+ * resolved without an extra composed position.
+ *
+ * @param value schema value
+ * @return The jump target or the supplied value.
+ */
+static inline jso_schema_value *jso_schema_program_target(jso_schema_value *value)
+{
+	if (value->program != NULL && value->program->jump != NULL) {
+		return value->program->jump;
+	}
+	return value;
+}
+
+#endif /* JSO_SCHEMA_PROGRAM_H */
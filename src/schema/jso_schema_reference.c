@@ -60,8 +60,8 @@ void jso_schema_reference_free(jso_schema_reference *ref)
 	}
 }
 
-jso_rc jso_schema_reference_resolve(jso_schema_reference *ref, jso_schema_uri *base_uri,
-		jso_schema_value *root_value, jso_value *doc)
+static jso_rc jso_schema_reference_resolve_value(jso_schema_reference *ref,
+		jso_schema_uri *base_uri, jso_schema_value *root_value, jso_value *doc)
 {
 	if (ref->result != NULL) {
 		return JSO_SUCCESS;
@@ -128,6 +128,11 @@ jso_rc jso_schema_reference_resolve(jso_schema_reference *ref, jso_schema_uri *b
 	}
 
 	jso_string *key = jso_string_copy(uri_str);
+	if (key == NULL) {
+		jso_schema_error_format(schema, JSO_SCHEMA_ERROR_REFERENCE_ALLOC,
+				"Reference cache key allocation failed");
+		return JSO_FAILURE;
+	}
 	jso_value ref_value;
 	JSO_VALUE_SET_SCHEMA_VALUE(ref_value, ref_schema_value);
 	if (jso_ht_set(&schema->uri_deref_cache, key, &ref_value, true) == JSO_FAILURE) {
@@ -141,3 +146,14 @@ jso_rc jso_schema_reference_resolve(jso_schema_reference *ref, jso_schema_uri *b
 
 	return JSO_SUCCESS;
 }
+
+jso_rc jso_schema_reference_resolve(jso_schema_reference *ref, jso_schema_uri *base_uri,
+		jso_schema_value *root_value, jso_value *doc)
+{
+	// Resolving can happen during validation so the schema allocator needs to be used.
+	const jso_allocator *allocator = jso_mm_enter(ref->schema->allocator);
+	jso_rc rc = jso_schema_reference_resolve_value(ref, base_uri, root_value, doc);
+	jso_mm_leave(allocator);
+
+	return rc;
+}
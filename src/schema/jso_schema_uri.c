@@ -48,6 +48,10 @@ jso_rc jso_schema_uri_parse(jso_schema *schema, jso_schema_uri *uri, jso_string
 {
 	jso_schema_uri_parse_internal(uri, uri_value);
 	uri->uri = jso_string_copy(uri_value);
+	if (uri->uri == NULL) {
+		jso_schema_error_set(schema, JSO_SCHEMA_ERROR_URI_ALLOC, "Allocating URI failed");
+		return JSO_FAILURE;
+	}
 	return JSO_SUCCESS;
 }
 
@@ -116,6 +120,11 @@ jso_rc jso_schema_uri_inherit(
 {
 	if (parent_uri->uri) {
 		current_uri->uri = jso_string_copy(parent_uri->uri);
+		if (current_uri->uri == NULL) {
+			jso_schema_error_set(
+					schema, JSO_SCHEMA_ERROR_URI_ALLOC, "Allocating inherited URI failed");
+			return JSO_FAILURE;
+		}
 		current_uri->path_start = parent_uri->path_start;
 		current_uri->fragment_start = parent_uri->fragment_start;
 	}
@@ -37,6 +37,10 @@ jso_schema_validation_result jso_schema_validation_array_start(
 jso_schema_validation_result jso_schema_validation_array_append(
 		jso_schema_validation_stack *stack, jso_schema_validation_position *pos);
 
+jso_schema_validation_result jso_schema_validation_array_contains(jso_schema *schema,
+		jso_schema_validation_stack *stack, jso_schema_validation_position *pos,
+		jso_virt_value *instance, jso_schema_value *contains);
+
 jso_schema_validation_result jso_schema_validation_array_value(jso_schema *schema,
 		jso_schema_validation_stack *stack, jso_schema_validation_position *pos,
 		jso_virt_value *instance);
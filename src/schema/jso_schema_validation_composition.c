@@ -25,6 +25,8 @@
 #include "jso_schema_validation_stack.h"
 
 #include "jso_schema_array.h"
+#include "jso_schema_error.h"
+#include "jso_schema_program.h"
 #include "jso_schema_reference.h"
 
 #include "../jso.h"
@@ -83,20 +85,19 @@ jso_schema_validation_result jso_schema_validation_composition_push(
 		JSO_ASSERT_EQ(JSO_SCHEMA_VALUE_TYPE_OBJECT_BOOLEAN, JSO_SCHEMA_VALUE_TYPE_P(current_value));
 		return JSO_SCHEMA_VALIDATION_VALID;
 	}
+	if (current_value->program != NULL && !current_value->program->composed) {
+		return JSO_SCHEMA_VALIDATION_VALID;
+	}
 
 	jso_schema_reference *ref = JSO_SCHEMA_VALUE_REF_P(current_value);
 	if (ref != NULL) {
 		jso_schema_value *result = JSO_SCHEMA_REFERENCE_RESULT(ref);
-		// result could be a NULL for $dynamicRef
+		// References are resolved when the schema is parsed so the validation never modifies the
+		// schema and it can be shared by more threads.
 		if (result == NULL) {
-			jso_schema *schema = stack->root_schema;
-			if (jso_schema_reference_resolve(
-						ref, &schema->root->base_uri, schema->root, &schema->doc)
-					== JSO_FAILURE) {
-				return JSO_SCHEMA_VALIDATION_ERROR;
-			}
-			result = JSO_SCHEMA_REFERENCE_RESULT(ref);
-			JSO_ASSERT_NOT_NULL(result);
+			jso_schema_error_set(stack->root_schema, JSO_SCHEMA_ERROR_REFERENCE_RESOLVE,
+					"Reference is not resolved");
+			return JSO_SCHEMA_VALIDATION_ERROR;
 		}
 		if (jso_schema_validation_stack_push_composed(
 					stack, result, pos, JSO_SCHEMA_VALIDATION_COMPOSITION_REF)
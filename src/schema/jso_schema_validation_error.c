@@ -21,40 +21,68 @@
  *
  */
 
+#include "jso_schema_validation_error.h"
 #include "jso_schema_error.h"
 #include "jso_schema_value.h"
 
 #include "../jso.h"
 
+#include <stdarg.h>
+
+/*
+ * Record the validation error of the position with the operands of the error code and return
+ * the invalid result.
+ */
+jso_schema_validation_result jso_schema_validation_error(jso_schema *schema,
+		jso_schema_validation_position *pos, jso_schema_error_code code, ...)
+{
+	va_list args;
+
+	va_start(args, code);
+	jso_schema_error_type type = jso_schema_error_record(schema, pos, code, args);
+	va_end(args);
+
+	switch (type) {
+		case JSO_SCHEMA_ERROR_VALIDATION_TYPE:
+			pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_TYPE;
+			break;
+		case JSO_SCHEMA_ERROR_VALIDATION_COMPOSITION:
+			pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_COMPOSITION;
+			break;
+		case JSO_SCHEMA_ERROR_VALIDATION_FALSE:
+			pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_VALUE;
+			break;
+		default:
+			pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_KEYWORD;
+			break;
+	}
+
+	return JSO_SCHEMA_VALIDATION_INVALID;
+}
+
 jso_schema_validation_result jso_schema_validation_value_type_error_ex(jso_schema *schema,
 		jso_schema_validation_position *pos, jso_value_type expected,
 		jso_value_type expected_alternative, jso_value_type actual)
 {
-	jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_TYPE,
-			"Invalid validation type, expected %s or %s but received %s",
-			jso_value_type_to_string(expected), jso_value_type_to_string(expected_alternative),
-			jso_value_type_to_string(actual));
-	pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_TYPE;
-	return JSO_SCHEMA_VALIDATION_INVALID;
+	return jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_TYPE_ALTERNATIVE,
+			jso_schema_error_operand_cstr(jso_value_type_to_string(expected)),
+			jso_schema_error_operand_cstr(jso_value_type_to_string(expected_alternative)),
+			jso_schema_error_operand_cstr(jso_value_type_to_string(actual)));
 }
 
 jso_schema_validation_result jso_schema_validation_value_type_error(jso_schema *schema,
 		jso_schema_validation_position *pos, jso_value_type expected, jso_value_type actual)
 {
-	jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_TYPE,
-			"Invalid validation type, expected %s but received %s",
-			jso_value_type_to_string(expected), jso_value_type_to_string(actual));
-	pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_TYPE;
-	return JSO_SCHEMA_VALIDATION_INVALID;
+	return jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_TYPE,
+			jso_schema_error_operand_cstr(jso_value_type_to_string(expected)),
+			jso_schema_error_operand_cstr(jso_value_type_to_string(actual)));
 }
 
 jso_schema_validation_result jso_schema_validation_schema_value_type_error(jso_schema *schema,
 		jso_schema_validation_position *pos, jso_schema_value_type expected,
 		jso_schema_value_type actual)
 {
-	jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_TYPE,
-			"Invalid schema type, expected %s but received %s",
-			jso_schema_value_type_to_string(expected), jso_schema_value_type_to_string(actual));
-	pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_TYPE;
-	return JSO_SCHEMA_VALIDATION_INVALID;
+	return jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_TYPE_SCHEMA,
+			jso_schema_error_operand_cstr(jso_schema_value_type_to_string(expected)),
+			jso_schema_error_operand_cstr(jso_schema_value_type_to_string(actual)));
 }
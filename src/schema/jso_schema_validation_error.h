@@ -31,6 +31,9 @@
 
 #include "../jso_schema.h"
 
+jso_schema_validation_result jso_schema_validation_error(jso_schema *schema,
+		jso_schema_validation_position *pos, jso_schema_error_code code, ...);
+
 jso_schema_validation_result jso_schema_validation_value_type_error_ex(jso_schema *schema,
 		jso_schema_validation_position *pos, jso_value_type expected,
 		jso_value_type expected_alternative, jso_value_type actual);
@@ -30,6 +30,7 @@
 
 #include "jso_schema_error.h"
 #include "jso_schema_keyword.h"
+#include "jso_schema_pattern_set.h"
 
 #include "../jso_re.h"
 #include "../jso.h"
@@ -50,12 +51,8 @@ jso_schema_validation_result jso_schema_validation_object_key(jso_schema_validat
 		size_t objlen = pos->count;
 		if (objlen > kw_uval) {
 			jso_schema_validation_set_final_result(pos, JSO_SCHEMA_VALIDATION_INVALID);
-			jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
-					"Object number of properties is %zu which is greater than maximum number of "
-					"properties %lu",
-					objlen, kw_uval);
-			pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_KEYWORD;
-			return JSO_SCHEMA_VALIDATION_INVALID;
+			return jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_MAX_PROPERTIES,
+					jso_schema_error_operand_uint(objlen), jso_schema_error_operand_uint(kw_uval));
 		}
 	}
 
@@ -84,8 +81,8 @@ jso_schema_validation_result jso_schema_validation_object_key(jso_schema_validat
 					&& (key_pos->composition_type != JSO_SCHEMA_VALIDATION_COMPOSITION_ANY
 							|| !key_pos->parent->any_of_valid)) {
 				if (key_pos->current_value->type == JSO_SCHEMA_VALUE_TYPE_STRING) {
-					key_pos->validation_result
-							= jso_schema_validation_string_value_str(schema, key_pos, key);
+					key_pos->validation_result = jso_schema_validation_string_value_str(
+							schema, stack, key_pos, key);
 					if (jso_schema_validation_stream_should_terminate(schema, key_pos)) {
 						return JSO_FAILURE;
 					}
@@ -104,11 +101,9 @@ jso_schema_validation_result jso_schema_validation_object_key(jso_schema_validat
 
 		if (property_names_invalid) {
 			jso_schema_validation_set_final_result(pos, JSO_SCHEMA_VALIDATION_INVALID);
-			jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
-					"Object key %s does not validate against propertyNames schema",
-					jso_virt_string_val(key));
-			pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_KEYWORD;
-			return JSO_SCHEMA_VALIDATION_INVALID;
+			return jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_PROPERTY_NAMES,
+					jso_schema_error_operand_string(
+							jso_virt_string_val(key), jso_virt_string_len(key)));
 		}
 	}
 
@@ -128,30 +123,21 @@ jso_schema_validation_result jso_schema_validation_object_key(jso_schema_validat
 		}
 	}
 
-	if (JSO_SCHEMA_KW_IS_SET(objval->pattern_properties)) {
-		jso_string *pkey;
-		jso_value *pval;
-		jso_object *pattern_props
-				= JSO_SCHEMA_KEYWORD_DATA_OBJ_SCHEMA_OBJ(objval->pattern_properties);
-		JSO_OBJECT_FOREACH(pattern_props, pkey, pval)
-		{
-			JSO_ASSERT_EQ(JSO_TYPE_P(pval), JSO_TYPE_SCHEMA_VALUE);
-			jso_schema_value *schema_value = JSO_SVVAL_P(pval);
-			jso_re_code *code = JSO_SCHEMA_VALUE_REGEXP_P(schema_value);
-			JSO_ASSERT_NOT_NULL(code);
-			jso_re_match_data *match_data = jso_re_match_data_create(code);
-			int match_result = jso_re_match(
-					jso_virt_string_val(key), jso_virt_string_len(key), code, match_data);
-			jso_re_match_data_free(match_data);
-			if (match_result > 0) {
-				if (jso_schema_validation_stack_push_basic(stack, schema_value, pos) == NULL) {
-					return JSO_SCHEMA_VALIDATION_ERROR;
-				}
-				found = true;
+	if (objval->pattern_set != NULL) {
+		const jso_uint32 *matches;
+		size_t matches_count;
+		if (jso_schema_pattern_set_match(objval->pattern_set, stack, key, &matches, &matches_count)
+				== JSO_FAILURE) {
+			return JSO_SCHEMA_VALIDATION_ERROR;
+		}
+		for (size_t i = 0; i < matches_count; i++) {
+			if (jso_schema_validation_stack_push_basic(stack,
+						jso_schema_pattern_set_value(objval->pattern_set, matches[i]), pos)
+					== NULL) {
+				return JSO_SCHEMA_VALIDATION_ERROR;
 			}
+			found = true;
 		}
-		JSO_OBJECT_FOREACH_END;
-		JSO_USE(pkey);
 	}
 
 	if (!found && JSO_SCHEMA_KW_IS_SET(objval->additional_properties)) {
@@ -167,13 +153,10 @@ jso_schema_validation_result jso_schema_validation_object_key(jso_schema_validat
 					JSO_SCHEMA_KEYWORD_TYPE_BOOLEAN);
 			if (!JSO_SCHEMA_KEYWORD_DATA_BOOL(objval->additional_properties)) {
 				jso_schema_validation_set_final_result(pos, JSO_SCHEMA_VALIDATION_INVALID);
-				jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
-						"Object does not allow additional properties but added property with key "
-						"%s which "
-						"is is not found in properties or matches any pattern property",
-						jso_virt_string_val(key));
-				pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_KEYWORD;
-				return JSO_SCHEMA_VALIDATION_INVALID;
+				return jso_schema_validation_error(schema, pos,
+						JSO_SCHEMA_ERROR_CODE_ADDITIONAL_PROPERTIES,
+						jso_schema_error_operand_string(
+								jso_virt_string_val(key), jso_virt_string_len(key)));
 			}
 		}
 	}
@@ -206,6 +189,54 @@ jso_schema_validation_result jso_schema_validation_object_pre_value(
 	return JSO_SCHEMA_VALIDATION_VALID;
 }
 
+jso_schema_validation_result jso_schema_validation_object_dependencies(jso_schema *schema,
+		jso_schema_validation_position *pos, jso_virt_value *instance, jso_object *dependencies)
+{
+	jso_virt_object *instance_obj = jso_virt_value_object(instance);
+	jso_string *key;
+	jso_value *val;
+	JSO_OBJECT_FOREACH(dependencies, key, val)
+	{
+		if (JSO_TYPE_P(val) == JSO_TYPE_ARRAY) {
+			jso_value *item;
+			JSO_ARRAY_FOREACH(JSO_ARRVAL_P(val), item)
+			{
+				JSO_ASSERT_EQ(JSO_TYPE_P(item), JSO_TYPE_STRING);
+				if (!jso_virt_object_has_str_key(instance_obj, JSO_STR_P(item))) {
+					return jso_schema_validation_error(schema, pos,
+							JSO_SCHEMA_ERROR_CODE_DEPENDENCIES,
+							jso_schema_error_operand_string(
+									(const char *) JSO_SVAL_P(item), JSO_SLEN_P(item)),
+							jso_schema_error_operand_string(
+									(const char *) JSO_STRING_VAL(key), JSO_STRING_LEN(key)));
+				}
+			}
+			JSO_ARRAY_FOREACH_END;
+		}
+	}
+	JSO_OBJECT_FOREACH_END;
+
+	return JSO_SCHEMA_VALIDATION_VALID;
+}
+
+jso_schema_validation_result jso_schema_validation_object_required(jso_schema *schema,
+		jso_schema_validation_position *pos, jso_virt_value *instance, jso_array *required)
+{
+	jso_value *item;
+	jso_virt_object *instance_object = jso_virt_value_object(instance);
+	JSO_ARRAY_FOREACH(required, item)
+	{
+		if (!jso_virt_object_has_str_key(instance_object, JSO_STR_P(item))) {
+			return jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_REQUIRED,
+					jso_schema_error_operand_string(
+							(const char *) JSO_SVAL_P(item), JSO_SLEN_P(item)));
+		}
+	}
+	JSO_ARRAY_FOREACH_END;
+
+	return JSO_SCHEMA_VALIDATION_VALID;
+}
+
 jso_schema_validation_result jso_schema_validation_object_value(jso_schema *schema,
 		jso_schema_validation_stack *stack, jso_schema_validation_position *pos,
 		jso_virt_value *instance)
@@ -218,58 +249,26 @@ jso_schema_validation_result jso_schema_validation_object_value(jso_schema *sche
 	jso_schema_value_object *objval = JSO_SCHEMA_VALUE_DATA_OBJ_P(pos->current_value);
 
 	if (JSO_SCHEMA_KW_IS_SET(objval->dependencies)) {
-		jso_string *key;
-		jso_value *val;
 		jso_object *dependencies = JSO_SCHEMA_KEYWORD_DATA_OBJ_SCHEMA_OBJ(objval->dependencies);
-		jso_virt_object *instance_obj = jso_virt_value_object(instance);
-		JSO_OBJECT_FOREACH(dependencies, key, val)
-		{
-			if (JSO_TYPE_P(val) == JSO_TYPE_ARRAY) {
-				jso_value *item;
-				JSO_ARRAY_FOREACH(JSO_ARRVAL_P(val), item)
-				{
-					JSO_ASSERT_EQ(JSO_TYPE_P(item), JSO_TYPE_STRING);
-					if (!jso_virt_object_has_str_key(instance_obj, JSO_STR_P(item))) {
-						jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
-								"Object key %s is required by dependency %s but it is not present",
-								JSO_SVAL_P(item), JSO_STRING_VAL(key));
-						pos->validation_invalid_reason
-								= JSO_SCHEMA_VALIDATION_INVALID_REASON_KEYWORD;
-						return JSO_SCHEMA_VALIDATION_INVALID;
-					}
-				}
-				JSO_ARRAY_FOREACH_END;
-			}
+		jso_schema_validation_result result
+				= jso_schema_validation_object_dependencies(schema, pos, instance, dependencies);
+		if (result != JSO_SCHEMA_VALIDATION_VALID) {
+			return result;
 		}
-		JSO_OBJECT_FOREACH_END;
 	}
 
 	if (JSO_SCHEMA_KW_IS_SET(objval->min_properties)) {
 		jso_uint kw_uval = JSO_SCHEMA_KEYWORD_DATA_UINT(objval->min_properties);
 		size_t objlen = jso_virt_object_count(jso_virt_value_object(instance));
 		if (objlen < kw_uval) {
-			jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
-					"Object number of properties is %zu which is lower than minimum number of "
-					"properties %lu",
-					objlen, kw_uval);
-			pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_KEYWORD;
-			return JSO_SCHEMA_VALIDATION_INVALID;
+			return jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_MIN_PROPERTIES,
+					jso_schema_error_operand_uint(objlen), jso_schema_error_operand_uint(kw_uval));
 		}
 	}
 
 	if (JSO_SCHEMA_KW_IS_SET(objval->required)) {
-		jso_value *item;
-		jso_virt_object *instance_object = jso_virt_value_object(instance);
-		JSO_ARRAY_FOREACH(JSO_SCHEMA_KEYWORD_DATA_ARR_STR(objval->required), item)
-		{
-			if (!jso_virt_object_has_str_key(instance_object, JSO_STR_P(item))) {
-				jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
-						"Object does not have required property with key %s", JSO_SVAL_P(item));
-				pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_KEYWORD;
-				return JSO_SCHEMA_VALIDATION_INVALID;
-			}
-		}
-		JSO_ARRAY_FOREACH_END;
+		return jso_schema_validation_object_required(
+				schema, pos, instance, JSO_SCHEMA_KEYWORD_DATA_ARR_STR(objval->required));
 	}
 
 	return JSO_SCHEMA_VALIDATION_VALID;
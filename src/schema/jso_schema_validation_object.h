@@ -37,6 +37,12 @@ jso_schema_validation_result jso_schema_validation_object_key(jso_schema_validat
 jso_schema_validation_result jso_schema_validation_object_pre_value(
 		jso_schema_validation_stack *stack, jso_schema_validation_position *pos);
 
+jso_schema_validation_result jso_schema_validation_object_dependencies(jso_schema *schema,
+		jso_schema_validation_position *pos, jso_virt_value *instance, jso_object *dependencies);
+
+jso_schema_validation_result jso_schema_validation_object_required(jso_schema *schema,
+		jso_schema_validation_position *pos, jso_virt_value *instance, jso_array *required);
+
 jso_schema_validation_result jso_schema_validation_object_value(jso_schema *schema,
 		jso_schema_validation_stack *stack, jso_schema_validation_position *pos,
 		jso_virt_value *instance);
@@ -0,0 +1,334 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "jso_schema_validation_array.h"
+#include "jso_schema_validation_error.h"
+#include "jso_schema_validation_object.h"
+#include "jso_schema_validation_program.h"
+#include "jso_schema_validation_string.h"
+
+#include "jso_schema_error.h"
+#include "jso_schema_program.h"
+
+#include "../jso.h"
+#include "../jso_number.h"
+
+#include <math.h>
+
+jso_schema_validation_result jso_schema_validation_program(jso_schema *schema,
+		jso_schema_validation_stack *stack, jso_schema_validation_position *pos,
+		jso_schema_program *program, jso_virt_value *instance)
+{
+	jso_schema_validation_result result;
+	jso_value_type inst_type;
+	jso_int inst_ival = 0;
+	jso_number inst_num = { 0 };
+	jso_virt_string *inst_str = NULL;
+	size_t len;
+
+	for (jso_schema_op *op = program->ops;; op++) {
+		switch (op->code) {
+			case JSO_SCHEMA_OP_END:
+				return JSO_SCHEMA_VALIDATION_VALID;
+
+			case JSO_SCHEMA_OP_ANY_OF:
+				if (!pos->any_of_valid) {
+					return jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_ANY_OF);
+				}
+				jso_schema_reset_error(schema);
+				break;
+			case JSO_SCHEMA_OP_ONE_OF:
+				if (!pos->one_of_valid) {
+					return jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_ONE_OF);
+				}
+				jso_schema_reset_error(schema);
+				break;
+			case JSO_SCHEMA_OP_TYPE_LIST:
+				if (!pos->type_valid) {
+					return jso_schema_validation_error(
+							schema, pos, JSO_SCHEMA_ERROR_CODE_TYPE_LIST);
+				}
+				jso_schema_reset_error(schema);
+				break;
+			case JSO_SCHEMA_OP_ENUM: {
+				jso_value *item;
+				bool found = false;
+				JSO_ARRAY_FOREACH(op->arr, item)
+				{
+					if (jso_virt_value_equals(instance, item)) {
+						found = true;
+						break;
+					}
+				}
+				JSO_ARRAY_FOREACH_END;
+				if (!found) {
+					return jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_ENUM);
+				}
+				break;
+			}
+			case JSO_SCHEMA_OP_CONST:
+				if (!jso_virt_value_equals(instance, op->val)) {
+					return jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_CONST);
+				}
+				break;
+
+			case JSO_SCHEMA_OP_TYPE_NULL:
+			case JSO_SCHEMA_OP_TYPE_BOOLEAN:
+			case JSO_SCHEMA_OP_TYPE_ARRAY:
+			case JSO_SCHEMA_OP_TYPE_OBJECT: {
+				static const jso_value_type expected_types[] = {
+					[JSO_SCHEMA_OP_TYPE_NULL] = JSO_TYPE_NULL,
+					[JSO_SCHEMA_OP_TYPE_BOOLEAN] = JSO_TYPE_BOOL,
+					[JSO_SCHEMA_OP_TYPE_ARRAY] = JSO_TYPE_ARRAY,
+					[JSO_SCHEMA_OP_TYPE_OBJECT] = JSO_TYPE_OBJECT,
+				};
+				inst_type = jso_virt_value_type(instance);
+				if (inst_type != expected_types[op->code]) {
+					return jso_schema_validation_value_type_error(
+							schema, pos, expected_types[op->code], inst_type);
+				}
+				break;
+			}
+			case JSO_SCHEMA_OP_TYPE_INTEGER:
+				inst_type = jso_virt_value_type(instance);
+				if (inst_type == JSO_TYPE_INT) {
+					inst_ival = jso_virt_value_int(instance);
+				} else if (inst_type == JSO_TYPE_DOUBLE) {
+					jso_double inst_dval = jso_virt_value_double(instance);
+					if (nearbyint(inst_dval) != inst_dval) {
+						return jso_schema_validation_error(
+								schema, pos, JSO_SCHEMA_ERROR_CODE_TYPE_INTEGER_FRACTION);
+					}
+					inst_ival = (jso_int) inst_dval;
+				} else {
+					return jso_schema_validation_value_type_error_ex(
+							schema, pos, JSO_TYPE_INT, JSO_TYPE_DOUBLE, inst_type);
+				}
+				break;
+			case JSO_SCHEMA_OP_TYPE_NUMBER:
+				inst_type = jso_virt_value_type(instance);
+				if (inst_type == JSO_TYPE_INT) {
+					inst_num.ival = jso_virt_value_int(instance);
+					inst_num.is_int = true;
+				} else if (inst_type == JSO_TYPE_DOUBLE) {
+					inst_num.dval = jso_virt_value_double(instance);
+					inst_num.is_int = false;
+				} else {
+					return jso_schema_validation_value_type_error_ex(
+							schema, pos, JSO_TYPE_INT, JSO_TYPE_DOUBLE, inst_type);
+				}
+				break;
+			case JSO_SCHEMA_OP_TYPE_STRING:
+				inst_type = jso_virt_value_type(instance);
+				if (inst_type != JSO_TYPE_STRING) {
+					return jso_schema_validation_value_type_error(
+							schema, pos, JSO_TYPE_STRING, inst_type);
+				}
+				inst_str = jso_virt_value_string(instance);
+				break;
+
+			case JSO_SCHEMA_OP_INT_MINIMUM:
+				if (inst_ival < op->ival) {
+					return jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_MINIMUM,
+							jso_schema_error_operand_int(inst_ival),
+							jso_schema_error_operand_int(op->ival));
+				}
+				break;
+			case JSO_SCHEMA_OP_INT_EXCLUSIVE_MINIMUM:
+				if (inst_ival <= op->ival) {
+					return jso_schema_validation_error(schema, pos,
+							JSO_SCHEMA_ERROR_CODE_EXCLUSIVE_MINIMUM,
+							jso_schema_error_operand_int(inst_ival),
+							jso_schema_error_operand_cstr(
+									inst_ival == op->ival ? "equal to" : "lower than"),
+							jso_schema_error_operand_int(op->ival));
+				}
+				break;
+			case JSO_SCHEMA_OP_INT_MINIMUM_EQUAL:
+				if (inst_ival == op->ival) {
+					return jso_schema_validation_error(schema, pos,
+							JSO_SCHEMA_ERROR_CODE_EXCLUSIVE_MINIMUM_EQUAL,
+							jso_schema_error_operand_int(inst_ival));
+				}
+				break;
+			case JSO_SCHEMA_OP_INT_MAXIMUM:
+				if (inst_ival > op->ival) {
+					return jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_MAXIMUM,
+							jso_schema_error_operand_int(inst_ival),
+							jso_schema_error_operand_int(op->ival));
+				}
+				break;
+			case JSO_SCHEMA_OP_INT_EXCLUSIVE_MAXIMUM:
+				if (inst_ival >= op->ival) {
+					return jso_schema_validation_error(schema, pos,
+							JSO_SCHEMA_ERROR_CODE_EXCLUSIVE_MAXIMUM,
+							jso_schema_error_operand_int(inst_ival),
+							jso_schema_error_operand_cstr(
+									inst_ival == op->ival ? "equal to" : "greater than"),
+							jso_schema_error_operand_int(op->ival));
+				}
+				break;
+			case JSO_SCHEMA_OP_INT_MAXIMUM_EQUAL:
+				if (inst_ival == op->ival) {
+					return jso_schema_validation_error(schema, pos,
+							JSO_SCHEMA_ERROR_CODE_EXCLUSIVE_MAXIMUM_EQUAL,
+							jso_schema_error_operand_int(inst_ival));
+				}
+				break;
+			case JSO_SCHEMA_OP_INT_MULTIPLE_OF:
+				if (inst_ival % op->ival != 0) {
+					return jso_schema_validation_error(schema, pos,
+							JSO_SCHEMA_ERROR_CODE_MULTIPLE_OF,
+							jso_schema_error_operand_int(inst_ival),
+							jso_schema_error_operand_int(op->ival));
+				}
+				break;
+
+			case JSO_SCHEMA_OP_NUM_MINIMUM:
+				if (jso_number_lt(&inst_num, &op->num)) {
+					return jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_MINIMUM,
+							jso_schema_error_operand_number(&inst_num),
+							jso_schema_error_operand_number(&op->num));
+				}
+				break;
+			case JSO_SCHEMA_OP_NUM_EXCLUSIVE_MINIMUM:
+				if (jso_number_le(&inst_num, &op->num)) {
+					bool equal = jso_number_eq(&inst_num, &op->num);
+					return jso_schema_validation_error(schema, pos,
+							JSO_SCHEMA_ERROR_CODE_EXCLUSIVE_MINIMUM,
+							jso_schema_error_operand_number(&inst_num),
+							jso_schema_error_operand_cstr(equal ? "equal to" : "lower than"),
+							jso_schema_error_operand_number(&op->num));
+				}
+				break;
+			case JSO_SCHEMA_OP_NUM_MINIMUM_EQUAL:
+				if (jso_number_eq(&inst_num, &op->num)) {
+					return jso_schema_validation_error(schema, pos,
+							JSO_SCHEMA_ERROR_CODE_EXCLUSIVE_MINIMUM_EQUAL,
+							jso_schema_error_operand_number(&inst_num));
+				}
+				break;
+			case JSO_SCHEMA_OP_NUM_MAXIMUM:
+				if (jso_number_gt(&inst_num, &op->num)) {
+					return jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_MAXIMUM,
+							jso_schema_error_operand_number(&inst_num),
+							jso_schema_error_operand_number(&op->num));
+				}
+				break;
+			case JSO_SCHEMA_OP_NUM_EXCLUSIVE_MAXIMUM:
+				if (jso_number_ge(&inst_num, &op->num)) {
+					bool equal = jso_number_eq(&inst_num, &op->num);
+					return jso_schema_validation_error(schema, pos,
+							JSO_SCHEMA_ERROR_CODE_EXCLUSIVE_MAXIMUM,
+							jso_schema_error_operand_number(&inst_num),
+							jso_schema_error_operand_cstr(equal ? "equal to" : "greater than"),
+							jso_schema_error_operand_number(&op->num));
+				}
+				break;
+			case JSO_SCHEMA_OP_NUM_MAXIMUM_EQUAL:
+				if (jso_number_eq(&inst_num, &op->num)) {
+					return jso_schema_validation_error(schema, pos,
+							JSO_SCHEMA_ERROR_CODE_EXCLUSIVE_MAXIMUM_EQUAL,
+							jso_schema_error_operand_number(&inst_num));
+				}
+				break;
+			case JSO_SCHEMA_OP_NUM_MULTIPLE_OF:
+				if (!jso_number_is_multiple_of(&inst_num, &op->num)) {
+					return jso_schema_validation_error(schema, pos,
+							JSO_SCHEMA_ERROR_CODE_MULTIPLE_OF,
+							jso_schema_error_operand_number(&inst_num),
+							jso_schema_error_operand_number(&op->num));
+				}
+				break;
+
+			case JSO_SCHEMA_OP_MIN_LENGTH:
+				len = jso_virt_string_len(inst_str);
+				if (len < op->uval) {
+					return jso_schema_validation_error(schema, pos,
+							JSO_SCHEMA_ERROR_CODE_MIN_LENGTH, jso_schema_error_operand_uint(len),
+							jso_schema_error_operand_uint(op->uval));
+				}
+				break;
+			case JSO_SCHEMA_OP_MAX_LENGTH:
+				len = jso_virt_string_len(inst_str);
+				if (len > op->uval) {
+					return jso_schema_validation_error(schema, pos,
+							JSO_SCHEMA_ERROR_CODE_MAX_LENGTH, jso_schema_error_operand_uint(len),
+							jso_schema_error_operand_uint(op->uval));
+				}
+				break;
+			case JSO_SCHEMA_OP_PATTERN:
+				result = jso_schema_validation_string_pattern(
+						schema, stack, pos, op->re, inst_str);
+				if (result != JSO_SCHEMA_VALIDATION_VALID) {
+					return result;
+				}
+				break;
+
+			case JSO_SCHEMA_OP_MIN_ITEMS:
+				len = jso_virt_array_len(jso_virt_value_array(instance));
+				if (len < op->uval) {
+					return jso_schema_validation_error(schema, pos,
+							JSO_SCHEMA_ERROR_CODE_MIN_ITEMS, jso_schema_error_operand_uint(len),
+							jso_schema_error_operand_uint(op->uval));
+				}
+				break;
+			case JSO_SCHEMA_OP_UNIQUE_ITEMS:
+				if (!jso_virt_array_is_unique(jso_virt_value_array(instance))) {
+					return jso_schema_validation_error(
+							schema, pos, JSO_SCHEMA_ERROR_CODE_UNIQUE_ITEMS);
+				}
+				break;
+			case JSO_SCHEMA_OP_CONTAINS:
+				result = jso_schema_validation_array_contains(
+						schema, stack, pos, instance, op->value);
+				if (result != JSO_SCHEMA_VALIDATION_VALID) {
+					return result;
+				}
+				break;
+
+			case JSO_SCHEMA_OP_DEPENDENCIES:
+				result = jso_schema_validation_object_dependencies(
+						schema, pos, instance, op->obj);
+				if (result != JSO_SCHEMA_VALIDATION_VALID) {
+					return result;
+				}
+				break;
+			case JSO_SCHEMA_OP_MIN_PROPERTIES:
+				len = jso_virt_object_count(jso_virt_value_object(instance));
+				if (len < op->uval) {
+					return jso_schema_validation_error(schema, pos,
+							JSO_SCHEMA_ERROR_CODE_MIN_PROPERTIES,
+							jso_schema_error_operand_uint(len),
+							jso_schema_error_operand_uint(op->uval));
+				}
+				break;
+			case JSO_SCHEMA_OP_REQUIRED:
+				result = jso_schema_validation_object_required(schema, pos, instance, op->arr);
+				if (result != JSO_SCHEMA_VALIDATION_VALID) {
+					return result;
+				}
+				break;
+		}
+	}
+}
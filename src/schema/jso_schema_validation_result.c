@@ -24,6 +24,7 @@
 #include "jso_schema_validation_result.h"
 
 #include "jso_schema_error.h"
+#include "jso_schema_validation_error.h"
 
 #include "../jso.h"
 
@@ -83,10 +84,7 @@ void jso_schema_validation_result_propagate(jso_schema *schema, jso_schema_valid
 			case JSO_SCHEMA_VALIDATION_COMPOSITION_ONE:
 				if (pos->validation_result == JSO_SCHEMA_VALIDATION_VALID) {
 					if (parent_pos->one_of_valid) {
-						jso_schema_error_set(schema, JSO_SCHEMA_ERROR_VALIDATION_COMPOSITION,
-								"More than one oneOf subschema was valid");
-						pos->validation_invalid_reason
-								= JSO_SCHEMA_VALIDATION_INVALID_REASON_COMPOSITION;
+						jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_ONE_OF_MORE);
 						jso_schema_validation_set_final_result(
 								parent_pos, JSO_SCHEMA_VALIDATION_INVALID);
 					} else {
@@ -97,10 +95,7 @@ void jso_schema_validation_result_propagate(jso_schema *schema, jso_schema_valid
 			default:
 				JSO_ASSERT_EQ(pos->composition_type, JSO_SCHEMA_VALIDATION_COMPOSITION_NOT);
 				if (pos->validation_result == JSO_SCHEMA_VALIDATION_VALID) {
-					jso_schema_error_set(schema, JSO_SCHEMA_ERROR_VALIDATION_COMPOSITION,
-							"Negated valid validation");
-					pos->validation_invalid_reason
-							= JSO_SCHEMA_VALIDATION_INVALID_REASON_COMPOSITION;
+					jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_NOT);
 					jso_schema_validation_set_final_result(
 							parent_pos, JSO_SCHEMA_VALIDATION_INVALID);
 				} else {
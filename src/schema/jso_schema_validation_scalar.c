@@ -67,10 +67,8 @@ jso_schema_validation_result jso_schema_validation_integer_value(jso_schema *sch
 		inst_ival = jso_virt_value_int(instance);
 	} else if (inst_type == JSO_TYPE_DOUBLE) {
 		if (nearbyint(jso_virt_value_double(instance)) != jso_virt_value_double(instance)) {
-			jso_schema_error_set(schema, JSO_SCHEMA_ERROR_VALIDATION_TYPE,
-					"Double integer type cannot have decimal point");
-			pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_TYPE;
-			return JSO_SCHEMA_VALIDATION_INVALID;
+			return jso_schema_validation_error(schema, pos,
+					JSO_SCHEMA_ERROR_CODE_TYPE_INTEGER_FRACTION);
 		}
 		inst_ival = (jso_int) jso_virt_value_double(instance);
 	} else {
@@ -84,75 +82,71 @@ jso_schema_validation_result jso_schema_validation_integer_value(jso_schema *sch
 		if (JSO_SCHEMA_KW_IS_SET(intval->minimum)) {
 			jso_int kw_ival = JSO_SCHEMA_KEYWORD_DATA_INT(intval->minimum);
 			if (inst_ival < kw_ival) {
-				jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
-						"Value %ld is lower than minimum value %ld", inst_ival, kw_ival);
-				pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_KEYWORD;
-				return JSO_SCHEMA_VALIDATION_INVALID;
+				return jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_MINIMUM,
+						jso_schema_error_operand_int(inst_ival),
+						jso_schema_error_operand_int(kw_ival));
 			}
 		}
 		if (JSO_SCHEMA_KW_IS_SET(intval->exclusive_minimum)) {
 			jso_int kw_ival = JSO_SCHEMA_KEYWORD_DATA_INT(intval->exclusive_minimum);
 			if (inst_ival <= kw_ival) {
-				jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
-						"Value %ld is %s exclusive minimum value %ld", inst_ival,
-						inst_ival == kw_ival ? "equal to" : "lower than", kw_ival);
-				pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_KEYWORD;
-				return JSO_SCHEMA_VALIDATION_INVALID;
+				return jso_schema_validation_error(schema, pos,
+						JSO_SCHEMA_ERROR_CODE_EXCLUSIVE_MINIMUM,
+						jso_schema_error_operand_int(inst_ival),
+						jso_schema_error_operand_cstr(
+								inst_ival == kw_ival ? "equal to" : "lower than"),
+						jso_schema_error_operand_int(kw_ival));
 			}
 		}
 		if (JSO_SCHEMA_KW_IS_SET(intval->maximum)) {
 			jso_int kw_ival = JSO_SCHEMA_KEYWORD_DATA_INT(intval->maximum);
 			if (inst_ival > kw_ival) {
-				jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
-						"Value %ld is greater than maximum value %ld", inst_ival, kw_ival);
-				pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_KEYWORD;
-				return JSO_SCHEMA_VALIDATION_INVALID;
+				return jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_MAXIMUM,
+						jso_schema_error_operand_int(inst_ival),
+						jso_schema_error_operand_int(kw_ival));
 			}
 		}
 		if (JSO_SCHEMA_KW_IS_SET(intval->exclusive_maximum)) {
 			jso_int kw_ival = JSO_SCHEMA_KEYWORD_DATA_INT(intval->exclusive_maximum);
 			if (inst_ival >= kw_ival) {
-				jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
-						"Value %ld is %s equal to exclusive maximum value %ld", inst_ival,
-						inst_ival == kw_ival ? "equal to" : "greater than", kw_ival);
-				pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_KEYWORD;
-				return JSO_SCHEMA_VALIDATION_INVALID;
+				return jso_schema_validation_error(schema, pos,
+						JSO_SCHEMA_ERROR_CODE_EXCLUSIVE_MAXIMUM,
+						jso_schema_error_operand_int(inst_ival),
+						jso_schema_error_operand_cstr(
+								inst_ival == kw_ival ? "equal to" : "greater than"),
+						jso_schema_error_operand_int(kw_ival));
 			}
 		}
 	} else { // Draft 4
 		if (JSO_SCHEMA_KW_IS_SET(intval->minimum)) {
 			jso_int kw_ival = JSO_SCHEMA_KEYWORD_DATA_INT(intval->minimum);
 			if (inst_ival < kw_ival) {
-				jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
-						"Value %ld is lower than minimum value %ld", inst_ival, kw_ival);
-				pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_KEYWORD;
-				return JSO_SCHEMA_VALIDATION_INVALID;
+				return jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_MINIMUM,
+						jso_schema_error_operand_int(inst_ival),
+						jso_schema_error_operand_int(kw_ival));
 			}
 			if (JSO_SCHEMA_KW_IS_SET(intval->exclusive_minimum)
 					&& JSO_SCHEMA_KEYWORD_DATA_BOOL(intval->exclusive_minimum)
 					&& inst_ival == kw_ival) {
-				jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
-						"Value %ld is equal to exclusive minimum", inst_ival);
-				pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_KEYWORD;
-				return JSO_SCHEMA_VALIDATION_INVALID;
+				return jso_schema_validation_error(schema, pos,
+						JSO_SCHEMA_ERROR_CODE_EXCLUSIVE_MINIMUM_EQUAL,
+						jso_schema_error_operand_int(inst_ival));
 			}
 		}
 
 		if (JSO_SCHEMA_KW_IS_SET(intval->maximum)) {
 			jso_int kw_ival = JSO_SCHEMA_KEYWORD_DATA_INT(intval->maximum);
 			if (inst_ival > kw_ival) {
-				jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
-						"Value %ld is greater than maximum value %ld", inst_ival, kw_ival);
-				pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_KEYWORD;
-				return JSO_SCHEMA_VALIDATION_INVALID;
+				return jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_MAXIMUM,
+						jso_schema_error_operand_int(inst_ival),
+						jso_schema_error_operand_int(kw_ival));
 			}
 			if (JSO_SCHEMA_KW_IS_SET(intval->exclusive_maximum)
 					&& JSO_SCHEMA_KEYWORD_DATA_BOOL(intval->exclusive_maximum)
 					&& inst_ival == kw_ival) {
-				jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
-						"Value %ld is equal to exclusive maximum", inst_ival);
-				pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_KEYWORD;
-				return JSO_SCHEMA_VALIDATION_INVALID;
+				return jso_schema_validation_error(schema, pos,
+						JSO_SCHEMA_ERROR_CODE_EXCLUSIVE_MAXIMUM_EQUAL,
+						jso_schema_error_operand_int(inst_ival));
 			}
 		}
 	}
@@ -160,10 +154,8 @@ jso_schema_validation_result jso_schema_validation_integer_value(jso_schema *sch
 	if (JSO_SCHEMA_KW_IS_SET(intval->multiple_of)) {
 		jso_int kw_ival = JSO_SCHEMA_KEYWORD_DATA_INT(intval->multiple_of);
 		if (inst_ival % kw_ival != 0) {
-			jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
-					"Value %d is is not multiple of %d", inst_ival, kw_ival);
-			pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_KEYWORD;
-			return JSO_SCHEMA_VALIDATION_INVALID;
+			return jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_MULTIPLE_OF,
+					jso_schema_error_operand_int(inst_ival), jso_schema_error_operand_int(kw_ival));
 		}
 	}
 
@@ -189,7 +181,6 @@ jso_schema_validation_result jso_schema_validation_number_value(jso_schema *sche
 	}
 
 	jso_schema_value_number *numval = JSO_SCHEMA_VALUE_DATA_NUM_P(pos->current_value);
-	jso_number_string inst_num_str, kw_num_str;
 
 	if (schema->version >= JSO_SCHEMA_VERSION_DRAFT_06) {
 		if (JSO_SCHEMA_KW_IS_SET(numval->minimum)) {
@@ -197,12 +188,9 @@ jso_schema_validation_result jso_schema_validation_number_value(jso_schema *sche
 			JSO_ASSERT_EQ(
 					jso_schema_keyword_convert_to_number(&numval->minimum, &kw_num), JSO_SUCCESS);
 			if (jso_number_lt(&inst_num, &kw_num)) {
-				jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
-						"Value %s is lower than minimum value %s",
-						jso_number_cstr_from_number(&inst_num_str, &inst_num),
-						jso_number_cstr_from_number(&kw_num_str, &kw_num));
-				pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_KEYWORD;
-				return JSO_SCHEMA_VALIDATION_INVALID;
+				return jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_MINIMUM,
+						jso_schema_error_operand_number(&inst_num),
+						jso_schema_error_operand_number(&kw_num));
 			}
 		}
 		if (JSO_SCHEMA_KW_IS_SET(numval->exclusive_minimum)) {
@@ -210,13 +198,12 @@ jso_schema_validation_result jso_schema_validation_number_value(jso_schema *sche
 			JSO_ASSERT_EQ(jso_schema_keyword_convert_to_number(&numval->exclusive_minimum, &kw_num),
 					JSO_SUCCESS);
 			if (jso_number_le(&inst_num, &kw_num)) {
-				jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
-						"Value %s is %s exclusive minimum value %s",
-						jso_number_cstr_from_number(&inst_num_str, &inst_num),
-						jso_number_eq(&inst_num, &kw_num) ? "equal to" : "lower than",
-						jso_number_cstr_from_number(&kw_num_str, &kw_num));
-				pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_KEYWORD;
-				return JSO_SCHEMA_VALIDATION_INVALID;
+				return jso_schema_validation_error(schema, pos,
+						JSO_SCHEMA_ERROR_CODE_EXCLUSIVE_MINIMUM,
+						jso_schema_error_operand_number(&inst_num),
+						jso_schema_error_operand_cstr(
+								jso_number_eq(&inst_num, &kw_num) ? "equal to" : "lower than"),
+						jso_schema_error_operand_number(&kw_num));
 			}
 		}
 		if (JSO_SCHEMA_KW_IS_SET(numval->maximum)) {
@@ -224,12 +211,9 @@ jso_schema_validation_result jso_schema_validation_number_value(jso_schema *sche
 			JSO_ASSERT_EQ(
 					jso_schema_keyword_convert_to_number(&numval->maximum, &kw_num), JSO_SUCCESS);
 			if (jso_number_gt(&inst_num, &kw_num)) {
-				jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
-						"Value %s is greater than maximum value %s",
-						jso_number_cstr_from_number(&inst_num_str, &inst_num),
-						jso_number_cstr_from_number(&kw_num_str, &kw_num));
-				pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_KEYWORD;
-				return JSO_SCHEMA_VALIDATION_INVALID;
+				return jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_MAXIMUM,
+						jso_schema_error_operand_number(&inst_num),
+						jso_schema_error_operand_number(&kw_num));
 			}
 		}
 		if (JSO_SCHEMA_KW_IS_SET(numval->exclusive_maximum)) {
@@ -237,13 +221,12 @@ jso_schema_validation_result jso_schema_validation_number_value(jso_schema *sche
 			JSO_ASSERT_EQ(jso_schema_keyword_convert_to_number(&numval->exclusive_maximum, &kw_num),
 					JSO_SUCCESS);
 			if (jso_number_ge(&inst_num, &kw_num)) {
-				jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
-						"Value %s is %s equal to exclusive maximum value %s",
-						jso_number_cstr_from_number(&inst_num_str, &inst_num),
-						jso_number_eq(&inst_num, &kw_num) ? "equal to" : "greater than",
-						jso_number_cstr_from_number(&kw_num_str, &kw_num));
-				pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_KEYWORD;
-				return JSO_SCHEMA_VALIDATION_INVALID;
+				return jso_schema_validation_error(schema, pos,
+						JSO_SCHEMA_ERROR_CODE_EXCLUSIVE_MAXIMUM,
+						jso_schema_error_operand_number(&inst_num),
+						jso_schema_error_operand_cstr(
+								jso_number_eq(&inst_num, &kw_num) ? "equal to" : "greater than"),
+						jso_schema_error_operand_number(&kw_num));
 			}
 		}
 	} else {
@@ -253,21 +236,16 @@ jso_schema_validation_result jso_schema_validation_number_value(jso_schema *sche
 			JSO_ASSERT_EQ(
 					jso_schema_keyword_convert_to_number(&numval->minimum, &kw_num), JSO_SUCCESS);
 			if (jso_number_lt(&inst_num, &kw_num)) {
-				jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
-						"Value %s is lower than minimum value %s",
-						jso_number_cstr_from_number(&inst_num_str, &inst_num),
-						jso_number_cstr_from_number(&kw_num_str, &kw_num));
-				pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_KEYWORD;
-				return JSO_SCHEMA_VALIDATION_INVALID;
+				return jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_MINIMUM,
+						jso_schema_error_operand_number(&inst_num),
+						jso_schema_error_operand_number(&kw_num));
 			}
 			if (JSO_SCHEMA_KW_IS_SET(numval->exclusive_minimum)
 					&& JSO_SCHEMA_KEYWORD_DATA_BOOL(numval->exclusive_minimum)
 					&& jso_number_eq(&inst_num, &kw_num)) {
-				jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
-						"Value %s is equal to exclusive minimum",
-						jso_number_cstr_from_number(&inst_num_str, &inst_num));
-				pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_KEYWORD;
-				return JSO_SCHEMA_VALIDATION_INVALID;
+				return jso_schema_validation_error(schema, pos,
+						JSO_SCHEMA_ERROR_CODE_EXCLUSIVE_MINIMUM_EQUAL,
+						jso_schema_error_operand_number(&inst_num));
 			}
 		}
 
@@ -276,21 +254,16 @@ jso_schema_validation_result jso_schema_validation_number_value(jso_schema *sche
 			JSO_ASSERT_EQ(
 					jso_schema_keyword_convert_to_number(&numval->maximum, &kw_num), JSO_SUCCESS);
 			if (jso_number_gt(&inst_num, &kw_num)) {
-				jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
-						"Value %s is greater than maximum value %s",
-						jso_number_cstr_from_number(&inst_num_str, &inst_num),
-						jso_number_cstr_from_number(&kw_num_str, &kw_num));
-				pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_KEYWORD;
-				return JSO_SCHEMA_VALIDATION_INVALID;
+				return jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_MAXIMUM,
+						jso_schema_error_operand_number(&inst_num),
+						jso_schema_error_operand_number(&kw_num));
 			}
 			if (JSO_SCHEMA_KW_IS_SET(numval->exclusive_maximum)
 					&& JSO_SCHEMA_KEYWORD_DATA_BOOL(numval->exclusive_maximum)
 					&& jso_number_eq(&inst_num, &kw_num)) {
-				jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
-						"Value %s is equal to exclusive maximum",
-						jso_number_cstr_from_number(&inst_num_str, &inst_num));
-				pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_KEYWORD;
-				return JSO_SCHEMA_VALIDATION_INVALID;
+				return jso_schema_validation_error(schema, pos,
+						JSO_SCHEMA_ERROR_CODE_EXCLUSIVE_MAXIMUM_EQUAL,
+						jso_schema_error_operand_number(&inst_num));
 			}
 		}
 	}
@@ -300,11 +273,9 @@ jso_schema_validation_result jso_schema_validation_number_value(jso_schema *sche
 		JSO_ASSERT_EQ(
 				jso_schema_keyword_convert_to_number(&numval->multiple_of, &kw_num), JSO_SUCCESS);
 		if (!jso_number_is_multiple_of(&inst_num, &kw_num)) {
-			jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
-					"Value %s is is not multiple of keyword value",
-					jso_number_cstr_from_number(&inst_num_str, &inst_num));
-			pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_KEYWORD;
-			return JSO_SCHEMA_VALIDATION_INVALID;
+			return jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_MULTIPLE_OF,
+					jso_schema_error_operand_number(&inst_num),
+					jso_schema_error_operand_number(&kw_num));
 		}
 	}
 
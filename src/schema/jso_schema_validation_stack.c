@@ -24,18 +24,29 @@
 #include "jso_schema_validation_stack.h"
 
 #include "jso_schema_error.h"
+#include "jso_schema_pattern_set.h"
+#include "jso_schema_program.h"
 
 #include "../jso.h"
 
 jso_rc jso_schema_validation_stack_init(
 		jso_schema *schema, jso_schema_validation_stack *stack, size_t capacity)
 {
-	stack->positions = jso_malloc(capacity * sizeof(jso_schema_validation_position));
+	stack->positions = jso_allocator_malloc(
+			schema->allocator, capacity * sizeof(jso_schema_validation_position));
 	if (stack->positions == NULL) {
 		jso_schema_error_format(
 				schema, JSO_SCHEMA_ERROR_STACK_ALLOC, "Allocating stack positions failed");
 		return JSO_FAILURE;
 	}
+	stack->match_data = jso_re_match_data_create_any(schema->allocator);
+	if (stack->match_data == NULL) {
+		jso_allocator_free(schema->allocator, stack->positions);
+		jso_schema_error_format(
+				schema, JSO_SCHEMA_ERROR_STACK_ALLOC, "Allocating stack match data failed");
+		return JSO_FAILURE;
+	}
+	stack->pattern_memo = NULL;
 	stack->root_schema = schema;
 	stack->capacity = capacity;
 	stack->size = 0;
@@ -47,7 +58,9 @@ jso_rc jso_schema_validation_stack_init(
 
 void jso_schema_validation_stack_clear(jso_schema_validation_stack *stack)
 {
-	jso_free(stack->positions);
+	jso_allocator_free(stack->root_schema->allocator, stack->positions);
+	jso_re_match_data_free(stack->match_data);
+	jso_schema_pattern_memo_free(stack->pattern_memo, stack->root_schema->allocator);
 }
 
 jso_schema_validation_position *jso_schema_validation_stack_root_position(
@@ -65,9 +78,9 @@ static jso_rc jso_schema_validation_stack_resize_if_needed(jso_schema_validation
 	}
 
 	size_t new_capacity = capacity * 2;
-	jso_schema_validation_position *positions
-			= jso_realloc(stack->positions, sizeof(jso_schema_validation_position) * new_capacity);
-	if (stack->positions == NULL) {
+	jso_schema_validation_position *positions = jso_allocator_realloc(stack->root_schema->allocator,
+			stack->positions, sizeof(jso_schema_validation_position) * new_capacity);
+	if (positions == NULL) {
 		jso_schema_error_format(stack->root_schema, JSO_SCHEMA_ERROR_STACK_ALLOC,
 				"Re-allocating stack positions failed");
 		return JSO_FAILURE;
@@ -96,7 +109,7 @@ jso_schema_validation_position *jso_schema_validation_stack_push_basic(
 	}
 
 	jso_schema_validation_position *next = jso_schema_validation_stack_next(stack);
-	next->current_value = current_value;
+	next->current_value = jso_schema_program_target(current_value);
 	next->parent = parent;
 	next->depth = stack->depth;
 	if (stack->last_separator != NULL) {
@@ -118,7 +131,7 @@ jso_schema_validation_position *jso_schema_validation_stack_push_composed(
 	jso_schema_validation_position *next = jso_schema_validation_stack_next(stack);
 	next->position_type = JSO_SCHEMA_VALIDATION_POSITION_COMPOSED;
 	next->composition_type = composition_type;
-	next->current_value = current_value;
+	next->current_value = jso_schema_program_target(current_value);
 	next->parent = parent;
 	next->depth = stack->depth;
 	if (stack->last_separator != NULL) {
@@ -159,6 +172,13 @@ void jso_schema_validation_stack_reset(jso_schema_validation_stack *stack)
 	stack->size = stack->mark;
 }
 
+void jso_schema_validation_stack_rewind(jso_schema_validation_stack *stack)
+{
+	stack->size = stack->mark = 0;
+	stack->depth = 0;
+	stack->last_separator = NULL;
+}
+
 void jso_schema_validation_stack_mark(jso_schema_validation_stack *stack)
 {
 	stack->mark = stack->size;
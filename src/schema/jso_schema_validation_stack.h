@@ -66,6 +66,8 @@ void jso_schema_validation_stack_mark(jso_schema_validation_stack *stack);
 
 void jso_schema_validation_stack_reset(jso_schema_validation_stack *stack);
 
+void jso_schema_validation_stack_rewind(jso_schema_validation_stack *stack);
+
 void jso_schema_validation_stack_layer_iterator_start(
 		jso_schema_validation_stack *stack, jso_schema_validation_stack_layer_iterator *iterator);
 
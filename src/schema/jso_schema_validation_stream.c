@@ -56,6 +56,19 @@ JSO_API jso_rc jso_schema_validation_stream_init(
 	return JSO_SUCCESS;
 }
 
+JSO_API jso_rc jso_schema_validation_stream_reset(jso_schema_validation_stream *stream)
+{
+	jso_schema_validation_stack *stack = JSO_STREAM_VALIDATION_STREAM_STACK_P(stream);
+
+	// Keep the allocated positions and start again from the root element.
+	jso_schema_validation_stack_rewind(stack);
+	if (jso_schema_validation_stack_push_basic(stack, stack->root_schema->root, NULL) == NULL) {
+		return JSO_FAILURE;
+	}
+
+	return JSO_SUCCESS;
+}
+
 JSO_API jso_rc jso_schema_validation_stream_object_start(jso_schema_validation_stream *stream)
 {
 	jso_schema_validation_stack_layer_iterator iterator;
@@ -90,7 +103,7 @@ JSO_API jso_rc jso_schema_validation_stream_object_key(
 	jso_schema_validation_stack *stack = JSO_STREAM_VALIDATION_STREAM_STACK_P(stream);
 	jso_schema *schema = stack->root_schema;
 
-	JSO_DBG_SV("OBJECT KEY (%s)", jso_virt_string_val(key));
+	JSO_DBG_SV("OBJECT KEY (%.*s)", (int) jso_virt_string_len(key), jso_virt_string_val(key));
 
 	// Start parent iteration.
 	jso_schema_validation_stack_layer_iterator_start(stack, &iterator);
@@ -121,7 +134,8 @@ JSO_API jso_rc jso_schema_validation_stream_object_update(jso_schema_validation_
 		jso_virt_object *instance_object, jso_virt_string *instance_key,
 		jso_virt_value *instance_item)
 {
-	JSO_DBG_SV("OBJECT UPDATE (key=%s)", jso_virt_string_val(instance_key));
+	JSO_DBG_SV("OBJECT UPDATE (key=%.*s)", (int) jso_virt_string_len(instance_key),
+			jso_virt_string_val(instance_key));
 	// Currently there is nothing to do.
 	return JSO_SUCCESS;
 }
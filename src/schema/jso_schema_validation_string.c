@@ -30,44 +30,56 @@
 #include "../jso.h"
 #include "../jso_re.h"
 
-jso_schema_validation_result jso_schema_validation_string_value_str(
-		jso_schema *schema, jso_schema_validation_position *pos, jso_virt_string *instance_str)
+jso_schema_validation_result jso_schema_validation_string_pattern(jso_schema *schema,
+		jso_schema_validation_stack *stack, jso_schema_validation_position *pos, jso_re_code *code,
+		jso_virt_string *instance_str)
+{
+	int match_result = jso_re_match(jso_virt_string_val(instance_str),
+			jso_virt_string_len(instance_str), code, stack->match_data);
+	if (match_result == JSO_RE_ERROR_NOMATCH) {
+		return jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_PATTERN,
+				jso_schema_error_operand_string(
+						(const char *) JSO_STRING_VAL(JSO_RE_CODE_PATTERN(code)),
+						JSO_STRING_LEN(JSO_RE_CODE_PATTERN(code))),
+				jso_schema_error_operand_string(
+						jso_virt_string_val(instance_str), jso_virt_string_len(instance_str)));
+	}
+	if (match_result < 0) {
+		jso_schema_error_pattern_match(schema, code, match_result);
+		return JSO_SCHEMA_VALIDATION_ERROR;
+	}
+
+	return JSO_SCHEMA_VALIDATION_VALID;
+}
+
+jso_schema_validation_result jso_schema_validation_string_value_str(jso_schema *schema,
+		jso_schema_validation_stack *stack, jso_schema_validation_position *pos,
+		jso_virt_string *instance_str)
 {
 	jso_schema_value_string *strval = JSO_SCHEMA_VALUE_DATA_STR_P(pos->current_value);
 
 	if (JSO_SCHEMA_KW_IS_SET(strval->min_length)) {
 		jso_uint kw_uval = JSO_SCHEMA_KEYWORD_DATA_UINT(strval->min_length);
 		if (jso_virt_string_len(instance_str) < kw_uval) {
-			jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
-					"String length %zu is lower than minimum length %lu",
-					jso_virt_string_len(instance_str), kw_uval);
-			return JSO_SCHEMA_VALIDATION_INVALID;
+			return jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_MIN_LENGTH,
+					jso_schema_error_operand_uint(jso_virt_string_len(instance_str)),
+					jso_schema_error_operand_uint(kw_uval));
 		}
 	}
 
 	if (JSO_SCHEMA_KW_IS_SET(strval->max_length)) {
 		jso_uint kw_uval = JSO_SCHEMA_KEYWORD_DATA_UINT(strval->max_length);
 		if (jso_virt_string_len(instance_str) > kw_uval) {
-			jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
-					"String length %zu is greater than maximum length %lu",
-					jso_virt_string_len(instance_str), kw_uval);
-			return JSO_SCHEMA_VALIDATION_INVALID;
+			return jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_MAX_LENGTH,
+					jso_schema_error_operand_uint(jso_virt_string_len(instance_str)),
+					jso_schema_error_operand_uint(kw_uval));
 		}
 	}
 
 	if (JSO_SCHEMA_KW_IS_SET(strval->pattern)) {
 		JSO_ASSERT_EQ(JSO_SCHEMA_KEYWORD_TYPE(strval->pattern), JSO_SCHEMA_KEYWORD_TYPE_REGEXP);
-		jso_re_code *code = JSO_SCHEMA_KEYWORD_DATA_RE(strval->pattern);
-		jso_re_match_data *match_data = jso_re_match_data_create(code);
-		int match_result = jso_re_match(jso_virt_string_val(instance_str),
-				jso_virt_string_len(instance_str), code, match_data);
-		jso_re_match_data_free(match_data);
-		if (match_result <= 0) {
-			jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
-					"String pattern %s does not match value %s", JSO_RE_CODE_PATTERN(code),
-					jso_virt_string_val(instance_str));
-			return JSO_SCHEMA_VALIDATION_INVALID;
-		}
+		return jso_schema_validation_string_pattern(
+				schema, stack, pos, JSO_SCHEMA_KEYWORD_DATA_RE(strval->pattern), instance_str);
 	}
 
 	return JSO_SCHEMA_VALIDATION_VALID;
@@ -82,5 +94,6 @@ jso_schema_validation_result jso_schema_validation_string_value(jso_schema *sche
 				schema, pos, JSO_TYPE_STRING, jso_virt_value_type(instance));
 	}
 
-	return jso_schema_validation_string_value_str(schema, pos, jso_virt_value_string(instance));
+	return jso_schema_validation_string_value_str(
+			schema, stack, pos, jso_virt_value_string(instance));
 }
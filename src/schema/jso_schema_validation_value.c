@@ -26,6 +26,7 @@
 #include "jso_schema_validation_array.h"
 #include "jso_schema_validation_common.h"
 #include "jso_schema_validation_object.h"
+#include "jso_schema_validation_program.h"
 #include "jso_schema_validation_scalar.h"
 #include "jso_schema_validation_string.h"
 #include "jso_schema_validation_value.h"
@@ -53,10 +54,11 @@ jso_schema_validation_result jso_schema_validation_value(jso_schema *schema,
 		if (JSO_SCHEMA_VALUE_FLAGS_P(value) & JSO_SCHEMA_VALUE_FLAG_OBJECT_TRUE) {
 			return JSO_SCHEMA_VALIDATION_VALID;
 		}
-		jso_schema_error_set(
-				schema, JSO_SCHEMA_ERROR_VALIDATION_FALSE, "Schema value is always invalid");
-		pos->validation_invalid_reason = JSO_SCHEMA_VALIDATION_INVALID_REASON_VALUE;
-		return JSO_SCHEMA_VALIDATION_INVALID;
+		return jso_schema_validation_error(schema, pos, JSO_SCHEMA_ERROR_CODE_FALSE);
+	}
+
+	if (value->program != NULL) {
+		return jso_schema_validation_program(schema, stack, pos, value->program, instance);
 	}
 
 	jso_schema_validation_result result
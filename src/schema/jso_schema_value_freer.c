@@ -22,6 +22,8 @@
  */
 
 #include "jso_schema_keyword_freer.h"
+#include "jso_schema_pattern_set.h"
+#include "jso_schema_program.h"
 #include "jso_schema_reference.h"
 #include "jso_schema_uri.h"
 
@@ -119,6 +121,7 @@ static void jso_schema_value_free_object(jso_schema_value *val)
 	jso_schema_keyword_free(&objval->properties);
 	jso_schema_keyword_free(&objval->required);
 	jso_schema_keyword_free(&objval->pattern_properties);
+	jso_schema_pattern_set_free(objval->pattern_set);
 	jso_schema_keyword_free(&objval->dependencies);
 	jso_schema_keyword_free(&objval->property_names);
 	jso_free(objval);
@@ -141,6 +144,8 @@ void jso_schema_value_clear(jso_schema_value *val)
 		return;
 	}
 	jso_schema_reference_free(val->ref);
+	jso_schema_program_free(val->program);
+	val->program = NULL;
 	jso_schema_uri_clear(&val->base_uri);
 	jso_schema_value_free_common(val);
 	if (JSO_SCHEMA_VALUE_TYPE_P(val) != JSO_SCHEMA_VALUE_TYPE_MIXED) {
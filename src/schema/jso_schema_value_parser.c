@@ -25,6 +25,8 @@
 #include "jso_schema_data.h"
 #include "jso_schema_error.h"
 #include "jso_schema_keyword.h"
+#include "jso_schema_pattern_set.h"
+#include "jso_schema_program.h"
 #include "jso_schema_value.h"
 
 #include "../jso.h"
@@ -188,6 +190,14 @@ static jso_schema_value *jso_schema_value_parse_object(
 	JSO_SCHEMA_KW_SET_OBJ_OF_SCHEMA_OBJS(schema, data, properties, value, objval);
 	JSO_SCHEMA_KW_SET_EX(schema, data, patternProperties, value, objval, pattern_properties,
 			TYPE_REGEXP_OBJECT_OF_SCHEMA_OBJECTS);
+	if (JSO_SCHEMA_KW_IS_SET(objval->pattern_properties)) {
+		objval->pattern_set = jso_schema_pattern_set_create(
+				schema, JSO_SCHEMA_KEYWORD_DATA_OBJ_SCHEMA_OBJ(objval->pattern_properties));
+		if (objval->pattern_set == NULL) {
+			jso_schema_value_free(value);
+			return NULL;
+		}
+	}
 	JSO_SCHEMA_KW_SET_WITH_FLAGS(schema, data, required, value, objval, TYPE_ARRAY_OF_STRINGS,
 			JSO_SCHEMA_KEYWORD_FLAG_UNIQUE | not_empty_flag);
 	JSO_SCHEMA_KW_SET_WITH_FLAGS(schema, data, dependencies, value, objval,
@@ -257,8 +267,8 @@ static jso_schema_value *jso_schema_value_parse_by_string_type(jso_schema *schem
 			break;
 	}
 
-	jso_schema_error_format(
-			schema, JSO_SCHEMA_ERROR_TYPE_INVALID, "Invalid schema type %s", JSO_STRING_VAL(type));
+	jso_schema_error_format(schema, JSO_SCHEMA_ERROR_TYPE_INVALID, "Invalid schema type %.*s",
+			(int) JSO_STRING_LEN(type), JSO_STRING_VAL(type));
 
 	return NULL;
 }
@@ -317,7 +327,7 @@ jso_schema_value *jso_schema_value_parse_object_boolean(jso_schema *schema, jso_
 	return value;
 }
 
-jso_schema_value *jso_schema_value_parse(
+static jso_schema_value *jso_schema_value_parse_data(
 		jso_schema *schema, jso_value *data, jso_schema_value *parent)
 {
 	if (schema->version >= JSO_SCHEMA_VERSION_DRAFT_06 && JSO_TYPE_P(data) == JSO_TYPE_BOOL) {
@@ -382,3 +392,18 @@ jso_schema_value *jso_schema_value_parse(
 
 	return schema_value;
 }
+
+jso_schema_value *jso_schema_value_parse(
+		jso_schema *schema, jso_value *data, jso_schema_value *parent)
+{
+	jso_schema_value *value = jso_schema_value_parse_data(schema, data, parent);
+	if (value == NULL) {
+		return NULL;
+	}
+	if (schema->compile && jso_schema_program_compile(schema, value) == JSO_FAILURE) {
+		jso_schema_value_free(value);
+		return NULL;
+	}
+
+	return value;
+}
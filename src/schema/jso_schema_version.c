@@ -67,6 +67,6 @@ jso_rc jso_schema_version_set(
 	}
 
 	return jso_schema_error_format(schema, JSO_SCHEMA_ERROR_VERSION,
-			"Unknown $schema %s, only drafts 4 and 6 are currently supported",
-			JSO_STRING_VAL(version));
+			"Unknown $schema %.*s, only drafts 4 and 6 are currently supported",
+			(int) JSO_STRING_LEN(version), (const char *) JSO_STRING_VAL(version));
 }
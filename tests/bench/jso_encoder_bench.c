@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "../../src/jso.h"
+#include "../../src/jso_encoder.h"
+#include "../../src/jso_number.h"
+#include "../../src/jso_parser.h"
+#include "../../src/io/jso_io_file.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*
+ * Legacy encoder (every character is written separately to the output IO) kept here as a
+ * baseline for the comparison. The doubles use the same formatter as the new encoder so only
+ * the output and escaping differ.
+ */
+static jso_rc legacy_encode(jso_io *output, jso_bool pretty, jso_int depth, jso_value *val);
+
+static inline void legacy_output_cstr(jso_io *output, const char *str, size_t len)
+{
+	JSO_IO_WRITE(output, (jso_ctype *) str, len);
+}
+
+static inline void legacy_output_cchar(jso_io *output, char c)
+{
+	legacy_output_cstr(output, &c, 1);
+}
+
+static void legacy_elsep(jso_io *output, jso_bool pretty, jso_int depth)
+{
+	if (pretty) {
+		legacy_output_cstr(output, "\n", 1);
+		for (jso_int i = 0; i < depth; i++) {
+			legacy_output_cstr(output, "    ", 4);
+		}
+	}
+}
+
+static void legacy_encode_string(jso_io *output, jso_string *str)
+{
+	legacy_output_cchar(output, '"');
+	for (size_t pos = 0; pos < JSO_STRING_LEN(str); pos++) {
+		char c = JSO_STRING_VAL(str)[pos];
+		switch (c) {
+			case '"':
+				legacy_output_cstr(output, "\\\"", 2);
+				break;
+			case '\\':
+				legacy_output_cstr(output, "\\\\", 2);
+				break;
+			case '/':
+				legacy_output_cstr(output, "\\/", 2);
+				break;
+			case '\n':
+				legacy_output_cstr(output, "\\n", 2);
+				break;
+			case '\t':
+				legacy_output_cstr(output, "\\t", 2);
+				break;
+			default:
+				legacy_output_cchar(output, c);
+		}
+	}
+	legacy_output_cchar(output, '"');
+}
+
+static jso_rc legacy_encode(jso_io *output, jso_bool pretty, jso_int depth, jso_value *val)
+{
+	char buf[JSO_NUMBER_DOUBLE_BUFFER_SIZE];
+	jso_bool is_first = JSO_TRUE;
+	jso_string *key;
+	jso_value *item;
+
+	switch (JSO_TYPE_P(val)) {
+		case JSO_TYPE_NULL:
+			legacy_output_cstr(output, "null", 4);
+			break;
+		case JSO_TYPE_BOOL:
+			legacy_output_cstr(output, JSO_IVAL_P(val) ? "true" : "false", JSO_IVAL_P(val) ? 4 : 5);
+			break;
+		case JSO_TYPE_INT:
+			legacy_output_cstr(
+					output, buf, (size_t) snprintf(buf, sizeof(buf), "%ld", JSO_IVAL_P(val)));
+			break;
+		case JSO_TYPE_DOUBLE:
+			legacy_output_cstr(output, buf, jso_number_format_double(buf, JSO_DVAL_P(val)));
+			break;
+		case JSO_TYPE_STRING:
+			legacy_encode_string(output, JSO_STR_P(val));
+			break;
+		case JSO_TYPE_ARRAY:
+			legacy_output_cchar(output, '[');
+			JSO_ARRAY_FOREACH(JSO_ARRVAL_P(val), item)
+			{
+				if (is_first) {
+					is_first = JSO_FALSE;
+				} else {
+					legacy_output_cstr(output, ",", 1);
+				}
+				legacy_elsep(output, pretty, depth + 1);
+				legacy_encode(output, pretty, depth + 1, item);
+			}
+			JSO_ARRAY_FOREACH_END;
+			if (!is_first) {
+				legacy_elsep(output, pretty, depth);
+			}
+			legacy_output_cchar(output, ']');
+			break;
+		case JSO_TYPE_OBJECT:
+			legacy_output_cchar(output, '{');
+			JSO_OBJECT_FOREACH(JSO_OBJVAL_P(val), key, item)
+			{
+				if (is_first) {
+					is_first = JSO_FALSE;
+				} else {
+					legacy_output_cstr(output, ",", 1);
+				}
+				legacy_elsep(output, pretty, depth + 1);
+				legacy_encode_string(output, key);
+				legacy_output_cstr(output, ":", 1);
+				if (pretty) {
+					legacy_output_cstr(output, " ", 1);
+				}
+				legacy_encode(output, pretty, depth + 1, item);
+			}
+			JSO_OBJECT_FOREACH_END;
+			if (!is_first) {
+				legacy_elsep(output, pretty, depth);
+			}
+			legacy_output_cchar(output, '}');
+			break;
+		default:
+			return JSO_FAILURE;
+	}
+
+	return JSO_SUCCESS;
+}
+
+/* Benchmark helpers. */
+static double bench_now(void)
+{
+	struct timespec ts;
+	timespec_get(&ts, TIME_UTC);
+	return (double) ts.tv_sec * 1e9 + (double) ts.tv_nsec;
+}
+
+static unsigned int bench_seed = 12345;
+
+static unsigned int bench_rand(void)
+{
+	bench_seed = bench_seed * 1103515245 + 12345;
+	return (bench_seed >> 8) & 0xFFFFFF;
+}
+
+typedef struct _bench_doc {
+	char *json;
+	size_t len;
+	size_t size;
+} bench_doc;
+
+static void bench_doc_append(bench_doc *doc, const char *str)
+{
+	size_t len = strlen(str);
+	if (doc->len + len + 1 > doc->size) {
+		doc->size = (doc->size + len + 1) * 2;
+		doc->json = realloc(doc->json, doc->size);
+	}
+	memcpy(doc->json + doc->len, str, len + 1);
+	doc->len += len;
+}
+
+/* records with string fields, some of them with escapes and UTF-8 characters */
+static void bench_doc_records(bench_doc *doc, size_t count)
+{
+	static const char *words[] = { "lorem", "ipsum", "dolor", "sit", "amet", "consectetur",
+		"adipiscing", "elit", "sed", "do", "eiusmod", "tempor", "café", "naïve" };
+	char buf[256];
+
+	bench_doc_append(doc, "[");
+	for (size_t i = 0; i < count; i++) {
+		snprintf(buf, sizeof(buf),
+				"%s{\"id\":%zu,\"name\":\"user_%u\",\"email\":\"user%u@example.com\","
+				"\"url\":\"https://example.com/users/%u\",\"active\":%s,\"text\":\"",
+				i ? "," : "", i, bench_rand(), bench_rand(), bench_rand(),
+				i % 3 ? "true" : "false");
+		bench_doc_append(doc, buf);
+		for (int w = 0; w < 20; w++) {
+			bench_doc_append(doc, words[bench_rand() % (sizeof(words) / sizeof(words[0]))]);
+			bench_doc_append(doc, w == 9 ? "\\n" : (w == 15 ? "\\\"" : " "));
+		}
+		bench_doc_append(doc, "\",\"tags\":[\"alpha\",\"beta\",\"gamma\"]}");
+	}
+	bench_doc_append(doc, "]");
+}
+
+/* numeric rows */
+static void bench_doc_metrics(bench_doc *doc, size_t count)
+{
+	char buf[128];
+	bench_doc_append(doc, "[");
+	for (size_t i = 0; i < count; i++) {
+		snprintf(buf, sizeof(buf), "%s[%lu,%u,%.2f,true,null]", i ? "," : "",
+				1700000000000UL + i * 1000, bench_rand() % 100000,
+				(double) bench_rand() / 1000.0);
+		bench_doc_append(doc, buf);
+	}
+	bench_doc_append(doc, "]");
+}
+
+static void bench_run(const char *name, bench_doc *doc, jso_bool pretty)
+{
+	jso_parser_options parser_options = { .max_depth = 1000 };
+	jso_encoder_options options = { .max_depth = JSO_ENCODER_DEPTH_UNLIMITED, .pretty = pretty };
+	size_t rounds = 10;
+	double start, legacy_time, new_time;
+	long legacy_size, new_size;
+	jso_value val;
+
+	if (jso_parse_cstr(doc->json, doc->len, &parser_options, &val) == JSO_FAILURE) {
+		fprintf(stderr, "Parsing failed for %s\n", name);
+		exit(1);
+	}
+
+	FILE *fp = tmpfile();
+	jso_io *io = jso_io_file_open_stream(fp);
+
+	start = bench_now();
+	for (size_t r = 0; r < rounds; r++) {
+		rewind(fp);
+		legacy_encode(io, pretty, 0, &val);
+	}
+	legacy_size = ftell(fp);
+	legacy_time = bench_now() - start;
+
+	start = bench_now();
+	for (size_t r = 0; r < rounds; r++) {
+		rewind(fp);
+		jso_encode(&val, io, &options);
+	}
+	new_size = ftell(fp);
+	new_time = bench_now() - start;
+
+	if (legacy_size != new_size) {
+		fprintf(stderr, "Different output size for %s (%ld != %ld)\n", name, legacy_size,
+				new_size);
+		exit(1);
+	}
+
+	double bytes = (double) new_size * rounds;
+	printf("%-10s %-8s %10ld %10.0f %10.0f %8.2fx\n", name, pretty ? "pretty" : "compact",
+			new_size, bytes / legacy_time * 1e3, bytes / new_time * 1e3, legacy_time / new_time);
+
+	JSO_IO_FREE(io);
+	jso_value_clear(&val);
+}
+
+int main(void)
+{
+	bench_doc records = { 0 }, metrics = { 0 };
+
+	bench_doc_records(&records, 100000);
+	bench_doc_metrics(&metrics, 200000);
+
+	printf("%-10s %-8s %10s %10s %10s %9s\n", "document", "format", "bytes", "legacy MB/s",
+			"jso MB/s", "speedup");
+	bench_run("records", &records, JSO_FALSE);
+	bench_run("records", &records, JSO_TRUE);
+	bench_run("metrics", &metrics, JSO_FALSE);
+	bench_run("metrics", &metrics, JSO_TRUE);
+
+	free(records.json);
+	free(metrics.json);
+
+	return 0;
+}
@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "../../src/jso.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*
+ * Legacy hash table (modulo indexing, no stored hashes, insertion chain without removal) kept
+ * here as a baseline for the comparison.
+ */
+typedef struct _legacy_ht_entry {
+	jso_string *key;
+	jso_value value;
+	struct _legacy_ht_entry *next;
+} legacy_ht_entry;
+
+typedef struct _legacy_ht {
+	size_t count;
+	size_t capacity;
+	legacy_ht_entry *entries;
+	legacy_ht_entry *first_entry;
+	legacy_ht_entry *last_entry;
+} legacy_ht;
+
+static legacy_ht_entry *legacy_ht_find_entry(
+		legacy_ht_entry *entries, size_t capacity, jso_string *key)
+{
+	jso_uint32 index = jso_string_hash(key) % capacity;
+	while (1) {
+		legacy_ht_entry *entry = &entries[index];
+		if (entry->key == NULL || jso_string_equals(entry->key, key)) {
+			return entry;
+		}
+		index = (index + 1) % capacity;
+	}
+}
+
+static jso_rc legacy_ht_adjust_capacity(legacy_ht *ht, size_t capacity)
+{
+	legacy_ht_entry *entries = jso_calloc(capacity, sizeof(legacy_ht_entry));
+	if (entries == NULL) {
+		return JSO_FAILURE;
+	}
+
+	legacy_ht_entry *first_entry = NULL, *last_entry = NULL;
+	for (legacy_ht_entry *src_entry = ht->first_entry; src_entry; src_entry = src_entry->next) {
+		legacy_ht_entry *dest_entry = legacy_ht_find_entry(entries, capacity, src_entry->key);
+		dest_entry->key = src_entry->key;
+		dest_entry->value = src_entry->value;
+		if (last_entry) {
+			last_entry->next = dest_entry;
+		} else {
+			first_entry = dest_entry;
+		}
+		last_entry = dest_entry;
+	}
+
+	jso_free(ht->entries);
+	ht->entries = entries;
+	ht->capacity = capacity;
+	ht->first_entry = first_entry;
+	ht->last_entry = last_entry;
+
+	return JSO_SUCCESS;
+}
+
+static jso_rc legacy_ht_set(legacy_ht *ht, jso_string *key, jso_value *value)
+{
+	if (ht->count + 1 > ht->capacity * JSO_HT_MAX_LOAD) {
+		if (legacy_ht_adjust_capacity(ht, (ht->capacity + 1) * 2) == JSO_FAILURE) {
+			return JSO_FAILURE;
+		}
+	}
+
+	legacy_ht_entry *entry = legacy_ht_find_entry(ht->entries, ht->capacity, key);
+	if (entry->key == NULL) {
+		++ht->count;
+		if (ht->last_entry) {
+			ht->last_entry->next = entry;
+			ht->last_entry = entry;
+		} else {
+			ht->first_entry = ht->last_entry = entry;
+		}
+	} else {
+		jso_string_free(entry->key);
+	}
+	entry->key = key;
+	entry->value = *value;
+
+	return JSO_SUCCESS;
+}
+
+static jso_bool legacy_ht_has(legacy_ht *ht, jso_string *key)
+{
+	return ht->count > 0 && legacy_ht_find_entry(ht->entries, ht->capacity, key)->key != NULL;
+}
+
+static void legacy_ht_clear(legacy_ht *ht)
+{
+	for (legacy_ht_entry *entry = ht->first_entry; entry; entry = entry->next) {
+		jso_string_free(entry->key);
+	}
+	jso_free(ht->entries);
+	memset(ht, 0, sizeof(legacy_ht));
+}
+
+/* Benchmark helpers. */
+static double bench_now(void)
+{
+	struct timespec ts;
+	timespec_get(&ts, TIME_UTC);
+	return (double) ts.tv_sec * 1e9 + (double) ts.tv_nsec;
+}
+
+static jso_string **bench_keys_create(size_t count, const char *prefix)
+{
+	jso_string **keys = malloc(count * sizeof(jso_string *));
+	char buf[64];
+	for (size_t i = 0; i < count; i++) {
+		snprintf(buf, sizeof(buf), "%s_%zu", prefix, i);
+		keys[i] = jso_string_create_from_cstr(buf);
+		jso_string_hash(keys[i]);
+	}
+	return keys;
+}
+
+static void bench_keys_free(jso_string **keys, size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		jso_string_free(keys[i]);
+	}
+	free(keys);
+}
+
+static void bench_run(size_t size)
+{
+	size_t rounds = 4000000 / size;
+	jso_string **keys = bench_keys_create(size, "property");
+	jso_string **misses = bench_keys_create(size, "missing");
+	jso_value val;
+	size_t found = 0;
+	double start, legacy_insert, new_insert, legacy_hit, new_hit, legacy_miss, new_miss;
+
+	JSO_VALUE_SET_INT(val, 1);
+
+	start = bench_now();
+	for (size_t r = 0; r < rounds; r++) {
+		legacy_ht lht = { 0 };
+		for (size_t i = 0; i < size; i++) {
+			legacy_ht_set(&lht, jso_string_copy(keys[i]), &val);
+		}
+		legacy_ht_clear(&lht);
+	}
+	legacy_insert = bench_now() - start;
+
+	start = bench_now();
+	for (size_t r = 0; r < rounds; r++) {
+		jso_ht ht;
+		jso_ht_init(&ht);
+		for (size_t i = 0; i < size; i++) {
+			jso_ht_set(&ht, jso_string_copy(keys[i]), &val, true);
+		}
+		jso_ht_clear(&ht);
+	}
+	new_insert = bench_now() - start;
+
+	legacy_ht lht = { 0 };
+	jso_ht ht;
+	jso_ht_init(&ht);
+	for (size_t i = 0; i < size; i++) {
+		legacy_ht_set(&lht, jso_string_copy(keys[i]), &val);
+		jso_ht_set(&ht, jso_string_copy(keys[i]), &val, true);
+	}
+
+	start = bench_now();
+	for (size_t r = 0; r < rounds; r++) {
+		for (size_t i = 0; i < size; i++) {
+			found += legacy_ht_has(&lht, keys[i]);
+		}
+	}
+	legacy_hit = bench_now() - start;
+
+	start = bench_now();
+	for (size_t r = 0; r < rounds; r++) {
+		for (size_t i = 0; i < size; i++) {
+			found += jso_ht_has(&ht, keys[i]);
+		}
+	}
+	new_hit = bench_now() - start;
+
+	start = bench_now();
+	for (size_t r = 0; r < rounds; r++) {
+		for (size_t i = 0; i < size; i++) {
+			found += legacy_ht_has(&lht, misses[i]);
+		}
+	}
+	legacy_miss = bench_now() - start;
+
+	start = bench_now();
+	for (size_t r = 0; r < rounds; r++) {
+		for (size_t i = 0; i < size; i++) {
+			found += jso_ht_has(&ht, misses[i]);
+		}
+	}
+	new_miss = bench_now() - start;
+
+	legacy_ht_clear(&lht);
+	jso_ht_clear(&ht);
+
+	if (found != 2 * rounds * size) {
+		fprintf(stderr, "Unexpected number of found keys %zu\n", found);
+		exit(1);
+	}
+
+	double ops = (double) rounds * size;
+	printf("%-8zu %-8s %10.2f %10.2f %8.2fx\n", size, "insert", legacy_insert / ops,
+			new_insert / ops, legacy_insert / new_insert);
+	printf("%-8zu %-8s %10.2f %10.2f %8.2fx\n", size, "hit", legacy_hit / ops, new_hit / ops,
+			legacy_hit / new_hit);
+	printf("%-8zu %-8s %10.2f %10.2f %8.2fx\n", size, "miss", legacy_miss / ops, new_miss / ops,
+			legacy_miss / new_miss);
+
+	bench_keys_free(keys, size);
+	bench_keys_free(misses, size);
+}
+
+int main(void)
+{
+	size_t sizes[] = { 4, 16, 128, 1024, 16384, 262144 };
+
+	printf("%-8s %-8s %10s %10s %9s\n", "size", "op", "legacy ns", "jso_ht ns", "speedup");
+	for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+		bench_run(sizes[i]);
+	}
+
+	return 0;
+}
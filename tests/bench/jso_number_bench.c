@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "../../src/jso.h"
+#include "../../src/jso_number.h"
+#include "../../src/jso_parser.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Legacy conversion of the number token as done by the scanner using strtol and strtod. */
+static void legacy_number_parse(jso_number *num, const char *str, size_t len)
+{
+	jso_bool bigint = 0, negative = str[0] == '-';
+	size_t digits = len - negative;
+
+	if (memchr(str, '.', len) || memchr(str, 'e', len) || memchr(str, 'E', len)) {
+		num->is_int = false;
+		num->dval = strtod(str, NULL);
+		return;
+	}
+	if (digits >= JSO_INT_MAX_LENGTH) {
+		if (digits == JSO_INT_MAX_LENGTH) {
+			int cmp = strncmp(str + negative, JSO_INT_MAX_DIGITS, JSO_INT_MAX_LENGTH);
+			if (!(cmp < 0 || (cmp == 0 && negative))) {
+				bigint = 1;
+			}
+		} else {
+			bigint = 1;
+		}
+	}
+	if (bigint) {
+		num->is_int = false;
+		num->dval = strtod(str, NULL);
+	} else {
+		num->is_int = true;
+		num->ival = strtol(str, NULL, 10);
+	}
+}
+
+/* Benchmark helpers. */
+static double bench_now(void)
+{
+	struct timespec ts;
+	timespec_get(&ts, TIME_UTC);
+	return (double) ts.tv_sec * 1e9 + (double) ts.tv_nsec;
+}
+
+static unsigned int bench_seed = 12345;
+
+static unsigned int bench_rand(void)
+{
+	bench_seed = bench_seed * 1103515245 + 12345;
+	return (bench_seed >> 8) & 0xFFFFFF;
+}
+
+typedef struct _bench_doc {
+	char *json;
+	size_t len;
+	size_t size;
+} bench_doc;
+
+static void bench_doc_append(bench_doc *doc, const char *str)
+{
+	size_t len = strlen(str);
+	if (doc->len + len + 1 > doc->size) {
+		doc->size = (doc->size + len + 1) * 2;
+		doc->json = realloc(doc->json, doc->size);
+	}
+	memcpy(doc->json + doc->len, str, len + 1);
+	doc->len += len;
+}
+
+/* GeoJSON like coordinates with high precision doubles */
+static void bench_doc_geojson(bench_doc *doc, size_t count)
+{
+	char buf[128];
+	bench_doc_append(doc, "{\"type\":\"LineString\",\"coordinates\":[");
+	for (size_t i = 0; i < count; i++) {
+		double lon = (double) bench_rand() / 0xFFFFFF * 360.0 - 180.0;
+		double lat = (double) bench_rand() / 0xFFFFFF * 180.0 - 90.0;
+		snprintf(buf, sizeof(buf), "%s[%.*f,%.*f]", i ? "," : "", 6 + (int) (i % 9), lon,
+				6 + (int) (i % 9), lat);
+		bench_doc_append(doc, buf);
+	}
+	bench_doc_append(doc, "]}");
+}
+
+/* metrics with integer timestamps and counters and short doubles */
+static void bench_doc_metrics(bench_doc *doc, size_t count)
+{
+	char buf[128];
+	bench_doc_append(doc, "[");
+	for (size_t i = 0; i < count; i++) {
+		snprintf(buf, sizeof(buf), "%s[%lu,%u,%.2f,%.3e]", i ? "," : "",
+				1700000000000UL + i * 1000, bench_rand() % 100000,
+				(double) bench_rand() / 1000.0, (double) bench_rand() * 1e-9);
+		bench_doc_append(doc, buf);
+	}
+	bench_doc_append(doc, "]");
+}
+
+/* collect offsets of the number tokens in the document */
+static size_t bench_doc_tokens(bench_doc *doc, size_t **offsets, size_t **lengths)
+{
+	size_t count = 0;
+	*offsets = malloc(doc->len * sizeof(size_t));
+	*lengths = malloc(doc->len * sizeof(size_t));
+	for (size_t i = 0; i < doc->len; i++) {
+		char c = doc->json[i];
+		if (c == '-' || (c >= '0' && c <= '9')) {
+			size_t start = i;
+			while (i < doc->len && strchr("-+.eE0123456789", doc->json[i])) {
+				i++;
+			}
+			(*offsets)[count] = start;
+			(*lengths)[count++] = i - start;
+		}
+	}
+	return count;
+}
+
+static void bench_run(const char *name, bench_doc *doc)
+{
+	size_t *offsets, *lengths;
+	size_t count = bench_doc_tokens(doc, &offsets, &lengths);
+	size_t rounds = 20;
+	double start, legacy_time, new_time, parse_time, legacy_sum = 0, new_sum = 0;
+	jso_number num;
+
+	start = bench_now();
+	for (size_t r = 0; r < rounds; r++) {
+		for (size_t i = 0; i < count; i++) {
+			legacy_number_parse(&num, doc->json + offsets[i], lengths[i]);
+			legacy_sum += num.is_int ? (double) num.ival : num.dval;
+		}
+	}
+	legacy_time = bench_now() - start;
+
+	start = bench_now();
+	for (size_t r = 0; r < rounds; r++) {
+		for (size_t i = 0; i < count; i++) {
+			jso_number_parse(&num, doc->json + offsets[i], lengths[i]);
+			new_sum += num.is_int ? (double) num.ival : num.dval;
+		}
+	}
+	new_time = bench_now() - start;
+
+	if (legacy_sum != new_sum) {
+		fprintf(stderr, "Different results for %s\n", name);
+		exit(1);
+	}
+
+	jso_parser_options options = { .max_depth = 1000 };
+	start = bench_now();
+	for (size_t r = 0; r < rounds; r++) {
+		jso_value result;
+		if (jso_parse_cstr(doc->json, doc->len, &options, &result) == JSO_FAILURE) {
+			fprintf(stderr, "Parsing failed for %s\n", name);
+			exit(1);
+		}
+		jso_value_clear(&result);
+	}
+	parse_time = bench_now() - start;
+
+	double ops = (double) rounds * count;
+	printf("%-10s %10zu %10.2f %10.2f %8.2fx %10.0f\n", name, count, legacy_time / ops,
+			new_time / ops, legacy_time / new_time, (double) doc->len * rounds / parse_time * 1e3);
+
+	free(offsets);
+	free(lengths);
+}
+
+int main(void)
+{
+	bench_doc geojson = { 0 }, metrics = { 0 };
+
+	bench_doc_geojson(&geojson, 200000);
+	bench_doc_metrics(&metrics, 100000);
+
+	printf("%-10s %10s %10s %10s %9s %10s\n", "input", "numbers", "legacy ns", "jso ns",
+			"speedup", "parse MB/s");
+	bench_run("geojson", &geojson);
+	bench_run("metrics", &metrics);
+
+	free(geojson.json);
+	free(metrics.json);
+
+	return 0;
+}
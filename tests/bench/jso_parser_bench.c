@@ -0,0 +1,333 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "../../src/jso.h"
+#include "../../src/jso_parser.h"
+#include "../../src/jso_schema.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Benchmark helpers. */
+static double bench_now(void)
+{
+	struct timespec ts;
+	timespec_get(&ts, TIME_UTC);
+	return (double) ts.tv_sec * 1e9 + (double) ts.tv_nsec;
+}
+
+static unsigned int bench_seed = 12345;
+
+static unsigned int bench_rand(void)
+{
+	bench_seed = bench_seed * 1103515245 + 12345;
+	return (bench_seed >> 8) & 0xFFFFFF;
+}
+
+typedef struct _bench_doc {
+	char *json;
+	size_t len;
+	size_t size;
+} bench_doc;
+
+static void bench_doc_append(bench_doc *doc, const char *str)
+{
+	size_t len = strlen(str);
+	if (doc->len + len + 1 > doc->size) {
+		doc->size = (doc->size + len + 1) * 2;
+		doc->json = realloc(doc->json, doc->size);
+	}
+	memcpy(doc->json + doc->len, str, len + 1);
+	doc->len += len;
+}
+
+static void bench_doc_printf(bench_doc *doc, const char *format, ...)
+{
+	char buf[1024];
+	va_list args;
+	va_start(args, format);
+	vsnprintf(buf, sizeof(buf), format, args);
+	va_end(args);
+	bench_doc_append(doc, buf);
+}
+
+/* search result with statuses in the shape of twitter.json */
+static void bench_doc_twitter(bench_doc *doc)
+{
+	static const char *texts[] = { "@aym0566x \\n\\n名前:前田あゆみ\\n第一印象:怖っ！",
+		"RT @KATANA77: えっそれは・・・（一同） http:\\/\\/t.co\\/PkCJAcSuYK",
+		"\\u5927\\u962a\\u5e9c\\u306e\\u65b9 \\u304a\\u9858\\u3044\\u3057\\u307e\\u3059",
+		"Just posted a photo @ Somewhere http://t.co/abcdefghij #photo #daily" };
+
+	bench_doc_append(doc, "{\"statuses\":[");
+	for (size_t i = 0; i < 100; i++) {
+		unsigned int id = bench_rand();
+		bench_doc_printf(doc,
+				"%s{\"metadata\":{\"result_type\":\"recent\",\"iso_language_code\":\"ja\"},"
+				"\"created_at\":\"Sun Aug 31 00:29:15 +0000 2014\",\"id\":5058749%u,"
+				"\"id_str\":\"5058749%u\",\"text\":\"%s\",\"source\":\"<a "
+				"href=\\\"https:\\/\\/mobile.twitter.com\\\" rel=\\\"nofollow\\\">Twitter for "
+				"iPhone<\\/a>\",\"truncated\":false,\"in_reply_to_status_id\":null,"
+				"\"in_reply_to_user_id\":%u,\"in_reply_to_screen_name\":\"aym0566x\",",
+				i ? "," : "", id, id, texts[i % 4], bench_rand());
+		bench_doc_printf(doc,
+				"\"user\":{\"id\":%u,\"id_str\":\"%u\",\"name\":\"\\u3075\\u3058\\u308f\","
+				"\"screen_name\":\"user_%u\",\"location\":\"\\u5927\\u962a\",\"description\":"
+				"\"24\\/7 \\u266a music, photos and coffee \\u2615 follow me\",\"url\":null,"
+				"\"entities\":{\"description\":{\"urls\":[]}},\"protected\":false,"
+				"\"followers_count\":%u,\"friends_count\":%u,\"listed_count\":%u,"
+				"\"created_at\":\"Sun Aug 31 00:29:15 +0000 2014\",\"favourites_count\":%u,"
+				"\"utc_offset\":null,\"time_zone\":null,\"geo_enabled\":false,\"verified\":false,"
+				"\"statuses_count\":%u,\"lang\":\"ja\",\"profile_background_color\":\"C0DEED\","
+				"\"profile_image_url\":\"http:\\/\\/pbs.twimg.com\\/profile_images\\/%u\\/"
+				"normal.jpeg\",\"default_profile\":true,\"following\":false},",
+				id, id, id, bench_rand() % 1000, bench_rand() % 1000, bench_rand() % 10,
+				bench_rand() % 10000, bench_rand() % 100000, bench_rand());
+		bench_doc_printf(doc,
+				"\"geo\":null,\"coordinates\":null,\"place\":null,\"contributors\":null,"
+				"\"retweet_count\":%u,\"favorite_count\":%u,\"entities\":{\"hashtags\":[],"
+				"\"symbols\":[],\"urls\":[],\"user_mentions\":[{\"screen_name\":\"aym0566x\","
+				"\"name\":\"\\u524d\\u7530\\u3042\\u3086\\u307f\",\"id\":%u,\"id_str\":\"%u\","
+				"\"indices\":[0,9]}]},\"favorited\":false,\"retweeted\":false,\"lang\":\"ja\"}",
+				bench_rand() % 100, bench_rand() % 100, id, id);
+	}
+	bench_doc_append(doc,
+			"],\"search_metadata\":{\"completed_in\":0.087,\"max_id\":505874924095815681,"
+			"\"max_id_str\":\"505874924095815681\",\"next_results\":\"?max_id=505874847260352512"
+			"&q=%E4%B8%80&count=100&include_entities=1\",\"query\":\"%E4%B8%80\","
+			"\"refresh_url\":\"?since_id=505874924095815681&q=%E4%B8%80&include_entities=1\","
+			"\"count\":100,\"since_id\":0,\"since_id_str\":\"0\"}}");
+}
+
+/* pretty printed catalog with many integers in the shape of citm_catalog.json */
+static void bench_doc_citm(bench_doc *doc)
+{
+	static const char *names[] = { "Arri\\u00e8re-sc\\u00e8ne central", "1er balcon central",
+		"2\\u00e8me balcon bergerie cour", "Parterre", "Loge", "Orchestre" };
+
+	bench_doc_append(doc, "{\n    \"areaNames\": {\n");
+	for (size_t i = 0; i < 200; i++) {
+		bench_doc_printf(doc, "%s        \"%u\": \"%s\"", i ? ",\n" : "", 205705993 + (unsigned) i,
+				names[i % 6]);
+	}
+	bench_doc_append(doc, "\n    },\n    \"events\": {\n");
+	for (size_t i = 0; i < 400; i++) {
+		unsigned int id = 138586341 + (unsigned) i;
+		bench_doc_printf(doc,
+				"%s        \"%u\": {\n            \"description\": null,\n            \"id\": %u,\n"
+				"            \"logo\": \"/images/UE0AAAAACEKo6QAAAAZDSVRN\",\n"
+				"            \"name\": \"30th Anniversary Tour\",\n            \"subTopicIds\": [\n"
+				"                337184269,\n                337184283\n            ],\n"
+				"            \"subjectCode\": null,\n            \"subtitle\": null,\n"
+				"            \"topicIds\": [\n                324846099,\n"
+				"                107888604\n            ]\n        }",
+				i ? ",\n" : "", id, id);
+	}
+	bench_doc_append(doc, "\n    },\n    \"performances\": [\n");
+	for (size_t i = 0; i < 500; i++) {
+		bench_doc_printf(doc,
+				"%s        {\n            \"eventId\": %u,\n            \"id\": %u,\n"
+				"            \"logo\": null,\n            \"name\": null,\n"
+				"            \"prices\": [\n",
+				i ? ",\n" : "", 138586341 + bench_rand() % 400, 339887544 + (unsigned) i);
+		for (size_t j = 0; j < 3; j++) {
+			bench_doc_printf(doc,
+					"%s                {\n                    \"amount\": %u,\n"
+					"                    \"audienceSubCategoryId\": 337100890,\n"
+					"                    \"seatCategoryId\": %u\n                }",
+					j ? ",\n" : "", bench_rand() % 100000, 338937295 + (unsigned) j);
+		}
+		bench_doc_append(doc, "\n            ],\n            \"seatCategories\": [\n");
+		for (size_t j = 0; j < 3; j++) {
+			bench_doc_printf(doc,
+					"%s                {\n                    \"areas\": [\n"
+					"                        {\n                            \"areaId\": %u,\n"
+					"                            \"blockIds\": []\n                        }\n"
+					"                    ],\n                    \"seatCategoryId\": %u\n"
+					"                }",
+					j ? ",\n" : "", 205705993 + bench_rand() % 200, 338937295 + (unsigned) j);
+		}
+		bench_doc_printf(doc,
+				"\n            ],\n            \"seatMapImage\": null,\n"
+				"            \"start\": %u000,\n            \"venueCode\": \"PLEYEL_PLEYEL\"\n"
+				"        }",
+				1372701600 + bench_rand());
+	}
+	bench_doc_append(doc, "\n    ]\n}");
+}
+
+/* polygons with many coordinates in the shape of canada.json */
+static void bench_doc_canada(bench_doc *doc)
+{
+	bench_doc_append(doc, "{\"type\":\"FeatureCollection\",\"features\":[{\"type\":\"Feature\","
+						  "\"properties\":{\"name\":\"Canada\"},\"geometry\":{\"type\":\"Polygon\","
+						  "\"coordinates\":[");
+	for (size_t i = 0; i < 50; i++) {
+		bench_doc_append(doc, i ? ",[" : "[");
+		for (size_t j = 0; j < 1000; j++) {
+			bench_doc_printf(doc, "%s[%.15f,%.15f]", j ? "," : "",
+					-65.0 - (double) bench_rand() / 1e5, 43.0 + (double) bench_rand() / 1e5);
+		}
+		bench_doc_append(doc, "]");
+	}
+	bench_doc_append(doc, "]}}]}");
+}
+
+static double bench_parse(bench_doc *doc, jso_parser_options *options, size_t rounds)
+{
+	jso_value val;
+	double start = bench_now();
+	for (size_t r = 0; r < rounds; r++) {
+		if (jso_parse_cstr(doc->json, doc->len, options, &val) == JSO_FAILURE) {
+			fprintf(stderr, "Parsing failed\n");
+			exit(1);
+		}
+		jso_value_clear(&val);
+	}
+	return bench_now() - start;
+}
+
+static void bench_run(const char *name, void (*generate)(bench_doc *doc))
+{
+	bench_doc doc = { 0 };
+	jso_parser_options options = { .max_depth = 1000 };
+	jso_value default_val, structural_val;
+
+	generate(&doc);
+	size_t rounds = 50000000 / doc.len + 1;
+
+	/* both engines must produce the same values */
+	jso_parse_cstr(doc.json, doc.len, &options, &default_val);
+	options.engine = JSO_PARSER_ENGINE_STRUCTURAL;
+	jso_parse_cstr(doc.json, doc.len, &options, &structural_val);
+	if (!jso_value_equals(&default_val, &structural_val)) {
+		fprintf(stderr, "Different values parsed\n");
+		exit(1);
+	}
+	jso_value_clear(&default_val);
+	jso_value_clear(&structural_val);
+
+	options.engine = JSO_PARSER_ENGINE_DEFAULT;
+	double default_time = bench_parse(&doc, &options, rounds);
+	options.engine = JSO_PARSER_ENGINE_STRUCTURAL;
+	double structural_time = bench_parse(&doc, &options, rounds);
+	options.validate = JSO_TRUE;
+	double validate_time = bench_parse(&doc, &options, rounds);
+
+	double bytes = (double) doc.len * rounds;
+	printf("%-14s %10zu %12.3f %14.3f %8.2fx %13.3f\n", name, doc.len, bytes / default_time,
+			bytes / structural_time, default_time / structural_time, bytes / validate_time);
+
+	free(doc.json);
+}
+
+/* small RPC message */
+static void bench_doc_rpc(bench_doc *doc)
+{
+	bench_doc_append(
+			doc, "{\"jsonrpc\":\"2.0\",\"id\":12345,\"method\":\"orders.update\",\"params\":{");
+	bench_doc_append(doc, "\"order\":{\"id\":\"ord_8f2a1c\",\"customer\":\"cus_91b2\",\"items\":[");
+	for (size_t i = 0; i < 12; i++) {
+		bench_doc_printf(doc,
+				"%s{\"sku\":\"SKU-%05u\",\"name\":\"Item %zu\",\"quantity\":%u,"
+				"\"price\":%u.%02u,\"tags\":[\"new\",\"sale\"]}",
+				i ? "," : "", bench_rand() % 100000, i, bench_rand() % 10, bench_rand() % 1000,
+				bench_rand() % 100);
+	}
+	bench_doc_append(doc, "],\"shipping\":{\"method\":\"express\",\"address\":{\"street\":"
+						  "\"1 Main Street\",\"city\":\"London\",\"zip\":\"N1 9GU\"}},"
+						  "\"paid\":true,\"note\":null}}}");
+}
+
+static double bench_parse_ctx(bench_doc *doc, jso_parser_ctx *ctx, size_t rounds)
+{
+	jso_value val;
+	double start = bench_now();
+	for (size_t r = 0; r < rounds; r++) {
+		if (jso_parser_ctx_parse(ctx, doc->json, doc->len, &val) == JSO_FAILURE) {
+			fprintf(stderr, "Parsing failed\n");
+			exit(1);
+		}
+		jso_value_clear(&val);
+	}
+	return bench_now() - start;
+}
+
+static void bench_run_ctx(void)
+{
+	bench_doc doc = { 0 };
+	jso_value schema_data;
+	jso_schema schema;
+	jso_schema_options schema_options;
+	jso_parser_options options = { .max_depth = 1000 };
+	const char *schema_json = "{\"type\":\"object\",\"required\":[\"jsonrpc\",\"method\"],"
+							  "\"properties\":{\"jsonrpc\":{\"type\":\"string\"},"
+							  "\"id\":{\"type\":\"integer\"},\"params\":{\"type\":\"object\"}}}";
+	size_t rounds = 200000;
+
+	bench_doc_rpc(&doc);
+	jso_parse_cstr(schema_json, strlen(schema_json), &options, &schema_data);
+	jso_schema_init(&schema);
+	jso_schema_options_init(&schema_options);
+	schema_options.default_version = JSO_SCHEMA_VERSION_DRAFT_06;
+	if (jso_schema_parse_ex(&schema, &schema_data, &schema_options) == JSO_FAILURE) {
+		fprintf(stderr, "Schema parsing failed\n");
+		exit(1);
+	}
+
+	printf("\n%-14s %10s %12s %14s %9s\n", "rpc", "bytes", "cstr ns", "context ns", "speedup");
+	for (int with_schema = 0; with_schema <= 1; with_schema++) {
+		options.schema = with_schema ? &schema : NULL;
+		jso_parser_ctx *ctx = jso_parser_ctx_create(&options, JSO_FALSE);
+		jso_parser_ctx *arena_ctx = jso_parser_ctx_create(&options, JSO_TRUE);
+		double cstr_time = bench_parse(&doc, &options, rounds);
+		double ctx_time = bench_parse_ctx(&doc, ctx, rounds);
+		double arena_time = bench_parse_ctx(&doc, arena_ctx, rounds);
+		const char *name = with_schema ? "schema" : "plain";
+		printf("%-14s %10zu %12.1f %14.1f %8.2fx\n", name, doc.len, cstr_time / rounds,
+				ctx_time / rounds, cstr_time / ctx_time);
+		printf("%-14s %10zu %12.1f %14.1f %8.2fx\n", with_schema ? "schema arena" : "plain arena",
+				doc.len, cstr_time / rounds, arena_time / rounds, cstr_time / arena_time);
+		jso_parser_ctx_free(ctx);
+		jso_parser_ctx_free(arena_ctx);
+	}
+
+	jso_schema_clear(&schema);
+	jso_value_clear(&schema_data);
+	free(doc.json);
+}
+
+int main(void)
+{
+	printf("%-14s %10s %12s %14s %9s %13s\n", "corpus", "bytes", "default GB/s",
+			"structural GB/s", "speedup", "validate GB/s");
+	bench_run("twitter", bench_doc_twitter);
+	bench_run("citm_catalog", bench_doc_citm);
+	bench_run("canada", bench_doc_canada);
+	bench_run_ctx();
+
+	return 0;
+}
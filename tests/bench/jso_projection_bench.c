@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "../../src/jso.h"
+#include "../../src/jso_parser.h"
+#include "../../src/jso_pointer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Benchmark helpers. */
+static double bench_now(void)
+{
+	struct timespec ts;
+	timespec_get(&ts, TIME_UTC);
+	return (double) ts.tv_sec * 1e9 + (double) ts.tv_nsec;
+}
+
+static unsigned int bench_seed = 12345;
+
+static unsigned int bench_rand(void)
+{
+	bench_seed = bench_seed * 1103515245 + 12345;
+	return (bench_seed >> 8) & 0xFFFFFF;
+}
+
+typedef struct _bench_doc {
+	char *json;
+	size_t len;
+	size_t size;
+} bench_doc;
+
+static void bench_doc_append(bench_doc *doc, const char *str)
+{
+	size_t len = strlen(str);
+	if (doc->len + len + 1 > doc->size) {
+		doc->size = (doc->size + len + 1) * 2;
+		doc->json = realloc(doc->json, doc->size);
+	}
+	memcpy(doc->json + doc->len, str, len + 1);
+	doc->len += len;
+}
+
+/* API response with metadata and a list of records */
+static void bench_doc_response(bench_doc *doc, size_t count)
+{
+	static const char *words[] = { "lorem", "ipsum", "dolor", "sit", "amet", "consectetur",
+		"adipiscing", "elit", "sed", "do", "eiusmod", "tempor", "café", "naïve" };
+	char buf[256];
+
+	bench_doc_append(doc, "{\"data\":[");
+	for (size_t i = 0; i < count; i++) {
+		snprintf(buf, sizeof(buf),
+				"%s{\"id\":%zu,\"name\":\"user_%u\",\"email\":\"user%u@example.com\","
+				"\"score\":%.3f,\"active\":%s,\"text\":\"",
+				i ? "," : "", i, bench_rand(), bench_rand(), (double) bench_rand() / 1000.0,
+				i % 3 ? "true" : "false");
+		bench_doc_append(doc, buf);
+		for (int w = 0; w < 20; w++) {
+			bench_doc_append(doc, words[bench_rand() % (sizeof(words) / sizeof(words[0]))]);
+			bench_doc_append(doc, w == 9 ? "\\n" : (w == 15 ? "\\\"" : " "));
+		}
+		bench_doc_append(doc, "\",\"tags\":[\"alpha\",\"beta\",\"gamma\"],\"geo\":[1.5,2.5]}");
+	}
+	snprintf(buf, sizeof(buf),
+			"],\"meta\":{\"total\":%zu,\"page\":1,\"next\":\"https://example.com/p/2\"},"
+			"\"status\":\"ok\"}",
+			count);
+	bench_doc_append(doc, buf);
+}
+
+static const char *bench_paths[] = { "/status", "/meta/total", "/meta/next", "/data/0/id",
+	"/data/0/email", "/data/7/name" };
+
+#define BENCH_PATHS_COUNT (sizeof(bench_paths) / sizeof(bench_paths[0]))
+
+/* resolve all pointers in the document and return the sum of the value types as a check */
+static size_t bench_resolve(jso_pointer **pointers, jso_value *doc)
+{
+	size_t check = 0;
+	jso_value *value;
+	for (size_t i = 0; i < BENCH_PATHS_COUNT; i++) {
+		if (jso_pointer_resolve(pointers[i], doc, &value) == JSO_FAILURE) {
+			fprintf(stderr, "Pointer %s not found\n", bench_paths[i]);
+			exit(1);
+		}
+		check += JSO_TYPE_P(value);
+	}
+	return check;
+}
+
+static void bench_run(size_t count, jso_pointer **pointers)
+{
+	bench_doc doc = { 0 };
+	jso_parser_options options = { .max_depth = 1000 };
+	size_t rounds = 20000000 / (count * 300) + 1;
+	size_t full_check = 0, projection_check = 0;
+	double start, full_time, projection_time;
+	jso_value val;
+
+	bench_doc_response(&doc, count);
+
+	start = bench_now();
+	for (size_t r = 0; r < rounds; r++) {
+		if (jso_parse_cstr(doc.json, doc.len, &options, &val) == JSO_FAILURE) {
+			fprintf(stderr, "Parsing failed\n");
+			exit(1);
+		}
+		full_check += bench_resolve(pointers, &val);
+		jso_value_clear(&val);
+	}
+	full_time = bench_now() - start;
+
+	start = bench_now();
+	for (size_t r = 0; r < rounds; r++) {
+		if (jso_parse_projection_cstr(
+					doc.json, doc.len, pointers, BENCH_PATHS_COUNT, &options, &val)
+				== JSO_FAILURE) {
+			fprintf(stderr, "Projection parsing failed\n");
+			exit(1);
+		}
+		projection_check += bench_resolve(pointers, &val);
+		jso_value_clear(&val);
+	}
+	projection_time = bench_now() - start;
+
+	if (full_check != projection_check) {
+		fprintf(stderr, "Different values found\n");
+		exit(1);
+	}
+
+	double bytes = (double) doc.len * rounds;
+	printf("%10zu %10zu %12.0f %12.0f %8.2fx\n", count, doc.len, bytes / full_time * 1e3,
+			bytes / projection_time * 1e3, full_time / projection_time);
+
+	free(doc.json);
+}
+
+int main(void)
+{
+	jso_pointer *pointers[BENCH_PATHS_COUNT];
+
+	for (size_t i = 0; i < BENCH_PATHS_COUNT; i++) {
+		jso_string *path = jso_string_create_from_cstr(bench_paths[i]);
+		pointers[i] = jso_pointer_create(path);
+		jso_string_free(path);
+	}
+
+	printf("%10s %10s %12s %12s %9s\n", "records", "bytes", "decode MB/s", "project MB/s",
+			"speedup");
+	bench_run(10, pointers);
+	bench_run(100, pointers);
+	bench_run(1000, pointers);
+	bench_run(10000, pointers);
+
+	for (size_t i = 0; i < BENCH_PATHS_COUNT; i++) {
+		jso_pointer_free(pointers[i]);
+	}
+
+	return 0;
+}
@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "../../src/jso.h"
+#include "../../src/jso_parser.h"
+#include "../../src/jso_schema.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Benchmark helpers. */
+static double bench_now(void)
+{
+	struct timespec ts;
+	timespec_get(&ts, TIME_UTC);
+	return (double) ts.tv_sec * 1e9 + (double) ts.tv_nsec;
+}
+
+static unsigned int bench_seed = 12345;
+
+static unsigned int bench_rand(void)
+{
+	bench_seed = bench_seed * 1103515245 + 12345;
+	return (bench_seed >> 8) & 0xFFFFFF;
+}
+
+typedef struct _bench_doc {
+	char *json;
+	size_t len;
+	size_t size;
+} bench_doc;
+
+static void bench_doc_append(bench_doc *doc, const char *str)
+{
+	size_t len = strlen(str);
+	if (doc->len + len + 1 > doc->size) {
+		doc->size = (doc->size + len + 1) * 2;
+		doc->json = realloc(doc->json, doc->size);
+	}
+	memcpy(doc->json + doc->len, str, len + 1);
+	doc->len += len;
+}
+
+/* array items schema with the supplied number of pattern properties */
+static void bench_doc_schema(bench_doc *doc, size_t patterns)
+{
+	char buf[256];
+
+	bench_doc_append(doc, "{\"type\":\"array\",\"items\":{\"type\":\"object\",");
+	bench_doc_append(doc, "\"patternProperties\":{");
+	for (size_t i = 0; i < patterns; i++) {
+		snprintf(buf, sizeof(buf),
+				"%s\"^f%zu_[a-z]+$\":{\"type\":\"string\",\"pattern\":\"^[a-z]+[0-9]*$\"}",
+				i ? "," : "", i);
+		bench_doc_append(doc, buf);
+	}
+	bench_doc_append(doc, "},\"additionalProperties\":false}}");
+}
+
+/* array of objects whose keys match one of the pattern properties */
+static void bench_doc_records(bench_doc *doc, size_t count, size_t patterns)
+{
+	char buf[256];
+
+	bench_doc_append(doc, "[");
+	for (size_t i = 0; i < count; i++) {
+		bench_doc_append(doc, i ? ",{" : "{");
+		for (size_t k = 0; k < 20; k++) {
+			snprintf(buf, sizeof(buf), "%s\"f%u_key\":\"value%u\"", k ? "," : "",
+					bench_rand() % (unsigned int) patterns, bench_rand() % 1000);
+			bench_doc_append(doc, buf);
+		}
+		bench_doc_append(doc, "}");
+	}
+	bench_doc_append(doc, "]");
+}
+
+static void bench_run(size_t patterns)
+{
+	bench_doc schema_doc = { 0 }, doc = { 0 };
+	jso_parser_options options = { .max_depth = 1000 };
+	jso_schema_options schema_options;
+	jso_value schema_data, val;
+	jso_schema schema;
+	size_t rounds = 200 / patterns + 2;
+	double start, parse_time, validate_time;
+
+	bench_doc_schema(&schema_doc, patterns);
+	bench_doc_records(&doc, 2000, patterns);
+
+	if (jso_parse_cstr(schema_doc.json, schema_doc.len, &options, &schema_data) == JSO_FAILURE) {
+		fprintf(stderr, "Parsing schema failed\n");
+		exit(1);
+	}
+	jso_schema_init(&schema);
+	jso_schema_options_init(&schema_options);
+	schema_options.default_version = JSO_SCHEMA_VERSION_DRAFT_06;
+	if (jso_schema_parse_ex(&schema, &schema_data, &schema_options) == JSO_FAILURE) {
+		fprintf(stderr, "Parsing schema failed: %s\n", JSO_SCHEMA_ERROR_MESSAGE(&schema));
+		exit(1);
+	}
+
+	start = bench_now();
+	for (size_t r = 0; r < rounds; r++) {
+		if (jso_parse_cstr(doc.json, doc.len, &options, &val) == JSO_FAILURE) {
+			fprintf(stderr, "Parsing failed\n");
+			exit(1);
+		}
+		jso_value_clear(&val);
+	}
+	parse_time = bench_now() - start;
+
+	options.schema = &schema;
+	start = bench_now();
+	for (size_t r = 0; r < rounds; r++) {
+		if (jso_parse_cstr(doc.json, doc.len, &options, &val) == JSO_FAILURE) {
+			fprintf(stderr, "Validation failed\n");
+			exit(1);
+		}
+		jso_value_clear(&val);
+	}
+	validate_time = bench_now() - start;
+
+	double bytes = (double) doc.len * rounds;
+	double keys = 2000.0 * 20 * rounds;
+	printf("%10zu %10zu %12.0f %12.0f %12.0f\n", patterns, doc.len, bytes / parse_time * 1e3,
+			bytes / validate_time * 1e3, keys / validate_time * 1e9);
+
+	jso_schema_clear(&schema);
+	jso_value_clear(&schema_data);
+	free(schema_doc.json);
+	free(doc.json);
+}
+
+/* API schema of the orders with the definitions referenced by $ref */
+static void bench_doc_api_schema(bench_doc *doc)
+{
+	bench_doc_append(doc,
+			"{\"type\":\"array\",\"items\":{\"$ref\":\"#/definitions/order\"},"
+			"\"definitions\":{"
+			"\"id\":{\"type\":\"integer\",\"minimum\":1},"
+			"\"money\":{\"type\":\"number\",\"minimum\":0,\"maximum\":1000000},"
+			"\"address\":{\"type\":\"object\",\"required\":[\"street\",\"city\",\"zip\"],"
+			"\"properties\":{"
+			"\"street\":{\"type\":\"string\",\"minLength\":1,\"maxLength\":100},"
+			"\"city\":{\"type\":\"string\",\"minLength\":1,\"maxLength\":50},"
+			"\"zip\":{\"type\":\"string\",\"minLength\":5,\"maxLength\":10},"
+			"\"country\":{\"enum\":[\"CZ\",\"DE\",\"GB\",\"US\"]}},"
+			"\"additionalProperties\":false},"
+			"\"item\":{\"type\":\"object\",\"required\":[\"sku\",\"quantity\",\"price\"],"
+			"\"properties\":{"
+			"\"sku\":{\"type\":\"string\",\"minLength\":8,\"maxLength\":8},"
+			"\"quantity\":{\"type\":\"integer\",\"minimum\":1,\"maximum\":100},"
+			"\"price\":{\"$ref\":\"#/definitions/money\"}}},"
+			"\"order\":{\"type\":\"object\","
+			"\"required\":[\"id\",\"customer\",\"status\",\"items\"],"
+			"\"properties\":{"
+			"\"id\":{\"$ref\":\"#/definitions/id\"},"
+			"\"customer\":{\"type\":\"object\",\"required\":[\"id\",\"name\",\"email\"],"
+			"\"properties\":{"
+			"\"id\":{\"$ref\":\"#/definitions/id\"},"
+			"\"name\":{\"type\":\"string\",\"minLength\":1,\"maxLength\":100},"
+			"\"email\":{\"type\":\"string\",\"minLength\":3,\"maxLength\":254},"
+			"\"vip\":{\"type\":\"boolean\"}}},"
+			"\"status\":{\"enum\":[\"new\",\"paid\",\"shipped\",\"delivered\"]},"
+			"\"shipping\":{\"$ref\":\"#/definitions/address\"},"
+			"\"items\":{\"type\":\"array\",\"minItems\":1,"
+			"\"items\":{\"$ref\":\"#/definitions/item\"}},"
+			"\"total\":{\"$ref\":\"#/definitions/money\"},"
+			"\"tags\":{\"type\":\"array\",\"uniqueItems\":true,"
+			"\"items\":{\"type\":\"string\",\"maxLength\":20}},"
+			"\"note\":{\"type\":[\"string\",\"null\"]}}}}}");
+}
+
+/* array of orders valid against the API schema */
+static void bench_doc_api_orders(bench_doc *doc, size_t count)
+{
+	static const char *statuses[] = { "new", "paid", "shipped", "delivered" };
+	static const char *countries[] = { "CZ", "DE", "GB", "US" };
+	char buf[512];
+
+	bench_doc_append(doc, "[");
+	for (size_t i = 0; i < count; i++) {
+		snprintf(buf, sizeof(buf),
+				"%s{\"id\":%zu,\"customer\":{\"id\":%u,\"name\":\"Customer %u\","
+				"\"email\":\"customer%u@example.com\",\"vip\":%s},\"status\":\"%s\","
+				"\"shipping\":{\"street\":\"%u Main Street\",\"city\":\"City %u\","
+				"\"zip\":\"%05u\",\"country\":\"%s\"},\"items\":[",
+				i ? "," : "", i + 1, bench_rand() % 10000 + 1, bench_rand() % 10000,
+				bench_rand() % 10000, bench_rand() % 2 ? "true" : "false",
+				statuses[bench_rand() % 4], bench_rand() % 1000, bench_rand() % 100,
+				bench_rand() % 100000, countries[bench_rand() % 4]);
+		bench_doc_append(doc, buf);
+		size_t items = bench_rand() % 5 + 1;
+		for (size_t k = 0; k < items; k++) {
+			snprintf(buf, sizeof(buf), "%s{\"sku\":\"SKU%05u\",\"quantity\":%u,\"price\":%u.%02u}",
+					k ? "," : "", bench_rand() % 100000, bench_rand() % 10 + 1,
+					bench_rand() % 1000, bench_rand() % 100);
+			bench_doc_append(doc, buf);
+		}
+		snprintf(buf, sizeof(buf),
+				"],\"total\":%u.%02u,\"tags\":[\"web\",\"promo%u\"],\"note\":%s}",
+				bench_rand() % 5000, bench_rand() % 100, bench_rand() % 10,
+				bench_rand() % 2 ? "null" : "\"leave at the door\"");
+		bench_doc_append(doc, buf);
+	}
+	bench_doc_append(doc, "]");
+}
+
+static void bench_api_schema_parse(
+		jso_schema *schema, jso_value *schema_data, jso_bool skip_compile)
+{
+	jso_schema_options schema_options;
+
+	jso_schema_init(schema);
+	jso_schema_options_init(&schema_options);
+	schema_options.default_version = JSO_SCHEMA_VERSION_DRAFT_06;
+	schema_options.skip_compile = skip_compile;
+	if (jso_schema_parse_ex(schema, schema_data, &schema_options) == JSO_FAILURE) {
+		fprintf(stderr, "Parsing schema failed: %s\n", JSO_SCHEMA_ERROR_MESSAGE(schema));
+		exit(1);
+	}
+}
+
+static double bench_api_validate(jso_schema *schema, jso_value *val, size_t rounds)
+{
+	double start = bench_now();
+	for (size_t r = 0; r < rounds; r++) {
+		if (jso_schema_validate(schema, val) != JSO_SCHEMA_VALIDATION_VALID) {
+			fprintf(stderr, "Validation failed: %s\n", JSO_SCHEMA_ERROR_MESSAGE(schema));
+			exit(1);
+		}
+	}
+
+	return bench_now() - start;
+}
+
+static void bench_api_run(size_t count)
+{
+	bench_doc schema_doc = { 0 }, doc = { 0 };
+	jso_parser_options options = { .max_depth = 1000 };
+	jso_value schema_data, val;
+	jso_schema interpreted, compiled;
+	size_t rounds = 20000 / count + 2;
+	double interpreted_time = 0, compiled_time = 0;
+
+	bench_doc_api_schema(&schema_doc);
+	bench_doc_api_orders(&doc, count);
+
+	if (jso_parse_cstr(schema_doc.json, schema_doc.len, &options, &schema_data) == JSO_FAILURE
+			|| jso_parse_cstr(doc.json, doc.len, &options, &val) == JSO_FAILURE) {
+		fprintf(stderr, "Parsing failed\n");
+		exit(1);
+	}
+	bench_api_schema_parse(&interpreted, &schema_data, true);
+	bench_api_schema_parse(&compiled, &schema_data, false);
+
+	// the runs are interleaved and the best time is used to limit the noise
+	for (int i = 0; i < 5; i++) {
+		double time = bench_api_validate(&interpreted, &val, rounds);
+		if (i == 0 || time < interpreted_time) {
+			interpreted_time = time;
+		}
+		time = bench_api_validate(&compiled, &val, rounds);
+		if (i == 0 || time < compiled_time) {
+			compiled_time = time;
+		}
+	}
+
+	double orders = (double) count * rounds;
+	printf("%10zu %10zu %14.0f %14.0f %8.2fx\n", count, doc.len,
+			orders / interpreted_time * 1e9, orders / compiled_time * 1e9,
+			interpreted_time / compiled_time);
+
+	jso_schema_clear(&interpreted);
+	jso_schema_clear(&compiled);
+	jso_value_clear(&val);
+	jso_value_clear(&schema_data);
+	free(schema_doc.json);
+	free(doc.json);
+}
+
+int main(void)
+{
+	printf("%10s %10s %12s %12s %12s\n", "patterns", "bytes", "parse MB/s", "valid MB/s",
+			"keys/s");
+	bench_run(1);
+	bench_run(10);
+	bench_run(50);
+	bench_run(200);
+
+	printf("\n%10s %10s %14s %14s %9s\n", "orders", "bytes", "interp ord/s", "compiled ord/s",
+			"speedup");
+	bench_api_run(10);
+	bench_api_run(100);
+	bench_api_run(1000);
+
+	return 0;
+}
@@ -0,0 +1,403 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "../../src/jso_ndjson.h"
+#include "../../src/jso.h"
+#include "../../src/io/jso_io_file.h"
+
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+/* context collecting the delivered records */
+typedef struct _jso_ndjson_test_ctx {
+	/** number of delivered records */
+	size_t count;
+	/** number of records with error */
+	size_t errors;
+	/** record index after which the callback stops parsing */
+	size_t stop_index;
+	/** lines and values or errors of the first records */
+	size_t lines[16];
+	jso_value_type types[16];
+	jso_int ivals[16];
+	jso_error_type error_types[16];
+	size_t error_lines[16];
+} jso_ndjson_test_ctx;
+
+static jso_rc jso_ndjson_test_callback(void *ctx, jso_ndjson_record *record)
+{
+	jso_ndjson_test_ctx *tctx = ctx;
+
+	/* the records are delivered in the input order */
+	assert_int_equal(tctx->count, record->index);
+	if (record->index < 16) {
+		tctx->lines[record->index] = record->line;
+		tctx->types[record->index] = JSO_TYPE(record->value);
+		if (JSO_TYPE(record->value) == JSO_TYPE_INT) {
+			tctx->ivals[record->index] = JSO_IVAL(record->value);
+		} else if (JSO_TYPE(record->value) == JSO_TYPE_ERROR) {
+			tctx->error_types[record->index] = jso_value_get_error_type(&record->value);
+			tctx->error_lines[record->index] = JSO_ELOC(record->value).first_line;
+		}
+	}
+	if (JSO_TYPE(record->value) == JSO_TYPE_ERROR) {
+		++tctx->errors;
+	} else if (JSO_TYPE(record->value) == JSO_TYPE_OBJECT) {
+		/* the record number is stored in the object to check the values order */
+		jso_value *value;
+		assert_int_equal(JSO_SUCCESS,
+				jso_object_get_by_cstr_key(JSO_OBJVAL(record->value), "n", 1, &value));
+		assert_int_equal(record->index, JSO_IVAL_P(value));
+	}
+	++tctx->count;
+
+	return record->index == tctx->stop_index ? JSO_FAILURE : JSO_SUCCESS;
+}
+
+/* create input with the supplied number of objects holding their record number */
+static char *jso_ndjson_test_records(size_t count, size_t pad, size_t *len)
+{
+	size_t size = count * (pad + 64) + 1, pos = 0;
+	char *json = malloc(size);
+	assert_non_null(json);
+	for (size_t i = 0; i < count; i++) {
+		pos += snprintf(json + pos, size - pos, "{\"n\": %zu, \"s\": \"%*s\"}\n", i, (int) pad,
+				"\\\"\\n");
+	}
+	*len = pos;
+
+	return json;
+}
+
+/* A test for splitting and parsing the records. */
+static void test_jso_ndjson_parse_cstr(void **state)
+{
+	(void) state; /* unused */
+
+	jso_ndjson_test_ctx ctx = { .stop_index = SIZE_MAX };
+	jso_ndjson_options options;
+	const char *json = "1\n\n  \t\r\n2\r\n\"a\\\"\nb\"\n[1, tru]\n{\"n\": 4}\n \"x\n\ny\" \n7";
+
+	jso_ndjson_options_init(&options);
+	assert_int_equal(JSO_FAILURE,
+			jso_ndjson_parse_cstr(json, strlen(json), &options, jso_ndjson_test_callback, &ctx));
+	assert_int_equal(7, ctx.count);
+	assert_int_equal(3, ctx.errors);
+
+	/* empty lines are skipped and the records are counted from 0 */
+	assert_int_equal(1, ctx.lines[0]);
+	assert_int_equal(JSO_TYPE_INT, ctx.types[0]);
+	assert_int_equal(1, ctx.ivals[0]);
+	assert_int_equal(4, ctx.lines[1]);
+	assert_int_equal(2, ctx.ivals[1]);
+
+	/* the newline in string does not end the record */
+	assert_int_equal(5, ctx.lines[2]);
+	assert_int_equal(JSO_TYPE_ERROR, ctx.types[2]);
+	assert_int_equal(JSO_ERROR_CTRL_CHAR, ctx.error_types[2]);
+	assert_int_equal(5, ctx.error_lines[2]);
+
+	/* the error location is in the whole input */
+	assert_int_equal(7, ctx.lines[3]);
+	assert_int_equal(JSO_ERROR_TOKEN, ctx.error_types[3]);
+	assert_int_equal(7, ctx.error_lines[3]);
+	assert_int_equal(8, ctx.lines[4]);
+	assert_int_equal(JSO_TYPE_OBJECT, ctx.types[4]);
+	assert_int_equal(9, ctx.lines[5]);
+	assert_int_equal(JSO_TYPE_ERROR, ctx.types[5]);
+
+	/* the last record does not need newline */
+	assert_int_equal(12, ctx.lines[6]);
+	assert_int_equal(7, ctx.ivals[6]);
+
+	/* empty input */
+	memset(&ctx, 0, sizeof(ctx));
+	ctx.stop_index = SIZE_MAX;
+	assert_int_equal(
+			JSO_SUCCESS, jso_ndjson_parse_cstr("", 0, &options, jso_ndjson_test_callback, &ctx));
+	assert_int_equal(JSO_SUCCESS,
+			jso_ndjson_parse_cstr("\n\n", 2, &options, jso_ndjson_test_callback, &ctx));
+	assert_int_equal(0, ctx.count);
+}
+
+/* A test for parsing the records by more threads with bounded pending memory. */
+static void test_jso_ndjson_parse_threads(void **state)
+{
+	(void) state; /* unused */
+
+	size_t len;
+	char *json = jso_ndjson_test_records(5000, 20, &len);
+	jso_ndjson_options options;
+	const jso_uint threads[] = { 0, 1, 4 };
+	const size_t max_pending_bytes[] = { 1, 1000, 0 };
+
+	jso_ndjson_options_init(&options);
+	for (size_t i = 0; i < sizeof(threads) / sizeof(threads[0]); i++) {
+		for (size_t j = 0; j < sizeof(max_pending_bytes) / sizeof(max_pending_bytes[0]); j++) {
+			jso_ndjson_test_ctx ctx = { .stop_index = SIZE_MAX };
+			options.threads = threads[i];
+			options.max_pending_bytes = max_pending_bytes[j];
+			assert_int_equal(JSO_SUCCESS,
+					jso_ndjson_parse_cstr(json, len, &options, jso_ndjson_test_callback, &ctx));
+			assert_int_equal(5000, ctx.count);
+			assert_int_equal(0, ctx.errors);
+		}
+	}
+
+	/* the parsing is stopped by callback */
+	for (size_t i = 0; i < sizeof(threads) / sizeof(threads[0]); i++) {
+		jso_ndjson_test_ctx ctx = { .stop_index = 2500 };
+		options.threads = threads[i];
+		options.max_pending_bytes = 1000;
+		assert_int_equal(JSO_FAILURE,
+				jso_ndjson_parse_cstr(json, len, &options, jso_ndjson_test_callback, &ctx));
+		assert_int_equal(2501, ctx.count);
+	}
+
+	free(json);
+}
+
+/* allocator context that detects calls running at the same time */
+typedef struct _jso_ndjson_test_allocator_ctx {
+	atomic_int running;
+	atomic_int overlaps;
+	jso_mm_counter counter;
+} jso_ndjson_test_allocator_ctx;
+
+/* enter the allocator call and record the overlap with another running call */
+static void jso_ndjson_test_allocator_enter(jso_ndjson_test_allocator_ctx *ctx)
+{
+	if (atomic_fetch_add(&ctx->running, 1) != 0) {
+		atomic_fetch_add(&ctx->overlaps, 1);
+	}
+	/* widen the window for the overlapping calls */
+	for (volatile int i = 0; i < 1000; i++) {
+	}
+}
+
+static void *jso_ndjson_test_allocator_alloc(size_t size, void *ctx)
+{
+	jso_ndjson_test_allocator_ctx *actx = ctx;
+	jso_ndjson_test_allocator_enter(actx);
+	void *ptr = jso_allocator_malloc(&actx->counter.allocator, size);
+	atomic_fetch_sub(&actx->running, 1);
+	return ptr;
+}
+
+static void *jso_ndjson_test_allocator_realloc(void *ptr, size_t size, void *ctx)
+{
+	jso_ndjson_test_allocator_ctx *actx = ctx;
+	jso_ndjson_test_allocator_enter(actx);
+	void *new_ptr = jso_allocator_realloc(&actx->counter.allocator, ptr, size);
+	atomic_fetch_sub(&actx->running, 1);
+	return new_ptr;
+}
+
+static void jso_ndjson_test_allocator_free(void *ptr, void *ctx)
+{
+	jso_ndjson_test_allocator_ctx *actx = ctx;
+	jso_ndjson_test_allocator_enter(actx);
+	jso_allocator_free(&actx->counter.allocator, ptr);
+	atomic_fetch_sub(&actx->running, 1);
+}
+
+/* A test for parsing the records by more threads with allocator that is not thread safe. */
+static void test_jso_ndjson_parse_threads_allocator(void **state)
+{
+	(void) state; /* unused */
+
+	size_t len;
+	char *json = jso_ndjson_test_records(5000, 20, &len);
+	jso_ndjson_options options;
+	jso_ndjson_test_allocator_ctx actx;
+	jso_allocator allocator = { jso_ndjson_test_allocator_alloc,
+		jso_ndjson_test_allocator_realloc, jso_ndjson_test_allocator_free, &actx };
+
+	atomic_init(&actx.running, 0);
+	atomic_init(&actx.overlaps, 0);
+	jso_mm_counter_init(&actx.counter, jso_mm_get_default_allocator());
+
+	jso_ndjson_options_init(&options);
+	options.parser.allocator = &allocator;
+	options.threads = 4;
+	options.max_pending_bytes = 1000;
+	jso_ndjson_test_ctx ctx = { .stop_index = SIZE_MAX };
+	assert_int_equal(JSO_SUCCESS,
+			jso_ndjson_parse_cstr(json, len, &options, jso_ndjson_test_callback, &ctx));
+	assert_int_equal(5000, ctx.count);
+	assert_int_equal(0, ctx.errors);
+	/* the allocator calls are serialized */
+	assert_int_equal(0, atomic_load(&actx.overlaps));
+	assert_true(actx.counter.stats.alloc_calls > 0);
+	assert_int_equal(0, actx.counter.stats.used_bytes);
+
+	free(json);
+}
+
+/* A test for validating the records against schema. */
+static void test_jso_ndjson_parse_schema(void **state)
+{
+	(void) state; /* unused */
+
+	jso_value schema_data;
+	jso_schema schema;
+	jso_schema_options schema_options;
+	jso_parser_options parser_options = { .max_depth = 1000 };
+	jso_ndjson_options options;
+	const char *schema_json = "{ \"type\": \"object\", \"properties\": {"
+							  " \"n\": { \"type\": \"integer\", \"maximum\": 4000 } } }";
+	size_t len;
+	char *json = jso_ndjson_test_records(5000, 10, &len);
+
+	assert_int_equal(JSO_SUCCESS,
+			jso_parse_cstr(schema_json, strlen(schema_json), &parser_options, &schema_data));
+	jso_schema_init(&schema);
+	jso_schema_options_init(&schema_options);
+	schema_options.default_version = JSO_SCHEMA_VERSION_DRAFT_06;
+	assert_int_equal(JSO_SUCCESS, jso_schema_parse_ex(&schema, &schema_data, &schema_options));
+
+	/* every thread keeps its own validation errors */
+	jso_ndjson_options_init(&options);
+	options.parser.schema = &schema;
+	options.max_pending_bytes = 4096;
+	for (jso_uint threads = 0; threads <= 4; threads += 2) {
+		jso_ndjson_test_ctx ctx = { .stop_index = SIZE_MAX };
+		options.threads = threads;
+		assert_int_equal(JSO_FAILURE,
+				jso_ndjson_parse_cstr(json, len, &options, jso_ndjson_test_callback, &ctx));
+		assert_int_equal(5000, ctx.count);
+		assert_int_equal(999, ctx.errors);
+		assert_false(jso_schema_error_is_set(&schema));
+	}
+
+	jso_schema_clear(&schema);
+	jso_value_free(&schema_data);
+	free(json);
+}
+
+/* A test for validating the records against schema that looks up the required keys. */
+static void test_jso_ndjson_parse_schema_required(void **state)
+{
+	(void) state; /* unused */
+
+	jso_value schema_data, *required, *item;
+	jso_schema schema;
+	jso_schema_options schema_options;
+	jso_parser_options parser_options = { .max_depth = 1000 };
+	jso_ndjson_options options;
+	const char *schema_json = "{ \"type\": \"object\", \"required\": [\"n\", \"s\", \"x\"],"
+							  " \"dependencies\": { \"n\": [\"s\"] } }";
+	size_t len;
+	char *json = jso_ndjson_test_records(5000, 10, &len);
+
+	assert_int_equal(JSO_SUCCESS,
+			jso_parse_cstr(schema_json, strlen(schema_json), &parser_options, &schema_data));
+	jso_schema_init(&schema);
+	jso_schema_options_init(&schema_options);
+	schema_options.default_version = JSO_SCHEMA_VERSION_DRAFT_06;
+	assert_int_equal(JSO_SUCCESS, jso_schema_parse_ex(&schema, &schema_data, &schema_options));
+
+	/* the workers share the required strings so their hashes must not be set lazily */
+	assert_int_equal(JSO_SUCCESS,
+			jso_object_get_by_cstr_key(JSO_OBJVAL(schema_data), "required", 8, &required));
+	JSO_ARRAY_FOREACH(JSO_ARRVAL_P(required), item)
+	{
+		assert_true(jso_string_has_hash(JSO_STR_P(item)));
+	}
+	JSO_ARRAY_FOREACH_END;
+
+	jso_ndjson_options_init(&options);
+	options.parser.schema = &schema;
+	options.max_pending_bytes = 4096;
+	for (jso_uint threads = 0; threads <= 4; threads += 2) {
+		jso_ndjson_test_ctx ctx = { .stop_index = SIZE_MAX };
+		options.threads = threads;
+		assert_int_equal(JSO_FAILURE,
+				jso_ndjson_parse_cstr(json, len, &options, jso_ndjson_test_callback, &ctx));
+		assert_int_equal(5000, ctx.count);
+		assert_int_equal(5000, ctx.errors);
+		assert_false(jso_schema_error_is_set(&schema));
+	}
+
+	jso_schema_clear(&schema);
+	jso_value_free(&schema_data);
+	free(json);
+}
+
+/* A test for parsing the records from the file that is read in parts. */
+static void test_jso_ndjson_parse_io_file(void **state)
+{
+	(void) state; /* unused */
+
+	size_t len;
+	const char *path = "jso_ndjson_test.ndjson";
+	/* the records are longer than a single read */
+	char *json = jso_ndjson_test_records(20, 100000, &len);
+	jso_ndjson_options options;
+
+	FILE *fp = fopen(path, "w");
+	assert_non_null(fp);
+	assert_int_equal(len, fwrite(json, 1, len, fp));
+	fclose(fp);
+
+	jso_ndjson_options_init(&options);
+	for (jso_uint threads = 0; threads <= 2; threads += 2) {
+		jso_ndjson_test_ctx ctx = { .stop_index = SIZE_MAX };
+		jso_io *io = jso_io_file_open(path, "r");
+		assert_non_null(io);
+		options.threads = threads;
+		options.max_pending_bytes = 250000;
+		assert_int_equal(
+				JSO_SUCCESS, jso_ndjson_parse_io(io, &options, jso_ndjson_test_callback, &ctx));
+		assert_int_equal(20, ctx.count);
+		assert_int_equal(0, ctx.errors);
+		for (size_t i = 0; i < 16; i++) {
+			assert_int_equal(i + 1, ctx.lines[i]);
+		}
+		JSO_IO_FREE(io);
+	}
+
+	remove(path);
+	free(json);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_jso_ndjson_parse_cstr),
+		cmocka_unit_test(test_jso_ndjson_parse_threads),
+		cmocka_unit_test(test_jso_ndjson_parse_threads_allocator),
+		cmocka_unit_test(test_jso_ndjson_parse_schema),
+		cmocka_unit_test(test_jso_ndjson_parse_schema_required),
+		cmocka_unit_test(test_jso_ndjson_parse_io_file),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
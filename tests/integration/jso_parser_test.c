@@ -22,9 +22,16 @@
  */
 
 #include "../../src/jso_parser.h"
+#include "../../src/jso_parser_hooks.h"
+#include "../../src/jso_pointer.h"
 #include "../../src/jso.h"
+#include "../../src/jso_simd.h"
+#include "../../src/io/jso_io_mmap.h"
+#include "../../src/io/jso_io_string.h"
 
+#include <math.h>
 #include <stdarg.h>
+#include <stdio.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <setjmp.h>
@@ -95,11 +102,1103 @@ static void test_jso_parser_parse_cstr_nested_object(void **state)
 	jso_value_clear(&result);
 }
 
+/* A test for parsing integers and doubles. */
+static void test_jso_parser_parse_cstr_numbers(void **state)
+{
+	(void) state; /* unused */
+
+	jso_value result, *value;
+	jso_parser_options options = { .max_depth = 1000 };
+	const char *json = "[0, -12, 9223372036854775807, 9223372036854775808, 1.09, -0.001, "
+					   "2.5e-3, 1E2, 0.1, 4.9406564584124654e-324, 1e400]";
+	const double doubles[] = { 9223372036854775808.0, 1.09, -0.001, 2.5e-3, 1e2, 0.1,
+		4.9406564584124654e-324 };
+
+	assert_int_equal(JSO_SUCCESS, jso_parse_cstr(json, strlen(json), &options, &result));
+	assert_int_equal(JSO_TYPE_ARRAY, JSO_TYPE(result));
+	jso_array *arr = JSO_ARRVAL(result);
+	assert_int_equal(11, JSO_ARRAY_LEN(arr));
+
+	assert_int_equal(JSO_SUCCESS, jso_array_index(arr, 0, &value));
+	assert_int_equal(JSO_TYPE_INT, JSO_TYPE_P(value));
+	assert_int_equal(0, JSO_IVAL_P(value));
+	assert_int_equal(JSO_SUCCESS, jso_array_index(arr, 1, &value));
+	assert_int_equal(JSO_TYPE_INT, JSO_TYPE_P(value));
+	assert_int_equal(-12, JSO_IVAL_P(value));
+	assert_int_equal(JSO_SUCCESS, jso_array_index(arr, 2, &value));
+	assert_int_equal(JSO_TYPE_INT, JSO_TYPE_P(value));
+	assert_int_equal(9223372036854775807L, JSO_IVAL_P(value));
+
+	for (size_t i = 0; i < sizeof(doubles) / sizeof(doubles[0]); i++) {
+		assert_int_equal(JSO_SUCCESS, jso_array_index(arr, 3 + i, &value));
+		assert_int_equal(JSO_TYPE_DOUBLE, JSO_TYPE_P(value));
+		assert_true(doubles[i] == JSO_DVAL_P(value));
+	}
+
+	assert_int_equal(JSO_SUCCESS, jso_array_index(arr, 10, &value));
+	assert_int_equal(JSO_TYPE_DOUBLE, JSO_TYPE_P(value));
+	assert_true(isinf(JSO_DVAL_P(value)));
+
+	jso_value_clear(&result);
+}
+
+/* A test for parsing a C string to the document allocated in arena. */
+static void test_jso_parser_parse_cstr_arena(void **state)
+{
+	(void) state; /* unused */
+
+	jso_value result, *value;
+	jso_arena *arena = jso_arena_alloc(256);
+	jso_parser_options options = { .max_depth = 1000, .arena = arena };
+	const char *json = "{ \"av\": [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,"
+					   " 18, 19], \"sv\": \"esc\\\"aped\","
+					   " \"ov\": { \"a\": 1, \"b\": 2, \"a\": 3 } }";
+
+	assert_int_equal(JSO_SUCCESS, jso_parse_cstr(json, strlen(json), &options, &result));
+	assert_int_equal(JSO_TYPE_OBJECT, JSO_TYPE(result));
+
+	jso_object *obj = JSO_OBJVAL(result);
+	assert_true(JSO_OBJECT_FLAGS(obj) & JSO_OBJECT_FLAG_ARENA);
+	assert_int_equal(3, JSO_OBJECT_COUNT(obj));
+
+	assert_int_equal(JSO_SUCCESS, jso_object_get_by_cstr_key(obj, "av", 2, &value));
+	jso_array *arr = JSO_ARRVAL_P(value);
+	assert_true(JSO_ARRAY_FLAGS(arr) & JSO_ARRAY_FLAG_ARENA);
+	assert_int_equal(20, JSO_ARRAY_LEN(arr));
+	for (jso_int i = 0; i < 20; i++) {
+		assert_int_equal(JSO_SUCCESS, jso_array_index(arr, i, &value));
+		assert_int_equal(i, JSO_IVAL_P(value));
+	}
+
+	assert_int_equal(JSO_SUCCESS, jso_object_get_by_cstr_key(obj, "sv", 2, &value));
+	assert_true(JSO_STRING_FLAGS(JSO_STR_P(value)) & JSO_STRING_FLAG_ARENA);
+	assert_string_equal("esc\"aped", (const char *) JSO_SVAL_P(value));
+
+	/* copying does not change reference count */
+	assert_ptr_equal(JSO_STR_P(value), jso_string_copy(JSO_STR_P(value)));
+	assert_int_equal(0, JSO_STRING_REFCOUNT(JSO_STR_P(value)));
+
+	assert_int_equal(JSO_SUCCESS, jso_object_get_by_cstr_key(obj, "ov", 2, &value));
+	obj = JSO_OBJVAL_P(value);
+	assert_int_equal(2, JSO_OBJECT_COUNT(obj));
+	assert_int_equal(JSO_SUCCESS, jso_object_get_by_cstr_key(obj, "a", 1, &value));
+	assert_int_equal(3, JSO_IVAL_P(value));
+
+	/* freeing is a no-op and the memory is released with the arena */
+	jso_value_free(&result);
+
+	/* errors are not allocated in arena */
+	jso_arena_clear(arena);
+	json = "[\"a\", {\"b\": tru}]";
+	assert_int_equal(JSO_FAILURE, jso_parse_cstr(json, strlen(json), &options, &result));
+	assert_int_equal(JSO_TYPE_ERROR, JSO_TYPE(result));
+	jso_value_free(&result);
+
+	jso_arena_free(arena);
+}
+
+/* A test for parsing strings that reference the parsed input. */
+static void test_jso_parser_parse_cstr_borrow_strings(void **state)
+{
+	(void) state; /* unused */
+
+	jso_value schema_data, result, *value;
+	jso_parser_options options = { .max_depth = 1000, .borrow_strings = JSO_TRUE };
+	const char *schema_json = "{ \"type\": \"object\", \"properties\": {"
+							  " \"a\": { \"type\": \"string\", \"pattern\": \"^[a-z]+$\" },"
+							  " \"b\": { \"$ref\": \"#/properties/a\" } } }";
+	const char *json = "{ \"a\": \"abc\", \"b\": \"esc\\\"aped\", \"\": \"\" }";
+
+	assert_int_equal(JSO_SUCCESS, jso_parse_cstr(json, strlen(json), &options, &result));
+	assert_int_equal(JSO_TYPE_OBJECT, JSO_TYPE(result));
+	jso_object *obj = JSO_OBJVAL(result);
+	assert_int_equal(3, JSO_OBJECT_COUNT(obj));
+
+	/* escape free string points to the input */
+	assert_int_equal(JSO_SUCCESS, jso_object_get_by_cstr_key(obj, "a", 1, &value));
+	jso_string *str = JSO_STR_P(value);
+	assert_true(JSO_STRING_FLAGS(str) & JSO_STRING_FLAG_BORROWED);
+	assert_int_equal(3, JSO_STRING_LEN(str));
+	assert_ptr_equal(json + 8, (const char *) JSO_STRING_VAL(str));
+
+	/* copy is owned and NUL terminated */
+	jso_string *copy = jso_string_copy(str);
+	assert_non_null(copy);
+	assert_ptr_not_equal(str, copy);
+	assert_false(JSO_STRING_FLAGS(copy) & JSO_STRING_FLAG_BORROWED);
+	assert_string_equal("abc", (const char *) JSO_STRING_VAL(copy));
+	assert_true(jso_string_equals(str, copy));
+	jso_string_free(copy);
+
+	/* escaped and empty strings are copied */
+	assert_int_equal(JSO_SUCCESS, jso_object_get_by_cstr_key(obj, "b", 1, &value));
+	assert_false(JSO_STRING_FLAGS(JSO_STR_P(value)) & JSO_STRING_FLAG_BORROWED);
+	assert_string_equal("esc\"aped", (const char *) JSO_SVAL_P(value));
+	assert_int_equal(JSO_SUCCESS, jso_object_get_by_cstr_key(obj, "", 0, &value));
+	assert_false(JSO_STRING_FLAGS(JSO_STR_P(value)) & JSO_STRING_FLAG_BORROWED);
+	jso_value_free(&result);
+
+	/* borrowed schema document and validated document */
+	assert_int_equal(
+			JSO_SUCCESS, jso_parse_cstr(schema_json, strlen(schema_json), &options, &schema_data));
+	jso_schema schema;
+	jso_schema_options schema_options;
+	jso_schema_init(&schema);
+	jso_schema_options_init(&schema_options);
+	schema_options.default_version = JSO_SCHEMA_VERSION_DRAFT_06;
+	assert_int_equal(JSO_SUCCESS, jso_schema_parse_ex(&schema, &schema_data, &schema_options));
+	options.schema = &schema;
+	json = "{ \"a\": \"abc\", \"b\": \"def\" }";
+	assert_int_equal(JSO_SUCCESS, jso_parse_cstr(json, strlen(json), &options, &result));
+	jso_value_free(&result);
+	json = "{ \"a\": \"abc\", \"b\": \"DEF\" }";
+	assert_int_equal(JSO_FAILURE, jso_parse_cstr(json, strlen(json), &options, &result));
+	assert_int_equal(JSO_TYPE_ERROR, JSO_TYPE(result));
+	jso_value_free(&result);
+	jso_schema_clear(&schema);
+	jso_value_free(&schema_data);
+
+	/* strings are not borrowed from the push parser chunks */
+	options.schema = NULL;
+	jso_push_parser *pp = jso_push_parser_create(&options);
+	assert_non_null(pp);
+	json = "[\"abc\"]";
+	assert_int_equal(JSO_SUCCESS, jso_push_parser_feed(pp, json, strlen(json)));
+	assert_int_equal(JSO_SUCCESS, jso_push_parser_finish(pp, &result));
+	assert_int_equal(JSO_SUCCESS, jso_array_index(JSO_ARRVAL(result), 0, &value));
+	assert_false(JSO_STRING_FLAGS(JSO_STR_P(value)) & JSO_STRING_FLAG_BORROWED);
+	jso_value_free(&result);
+	jso_push_parser_free(pp);
+}
+
+/* check that the key has hash set by the scanner and that it is correct */
+static void assert_jso_parser_key_hash(jso_object *obj, const char *key)
+{
+	jso_string *str, *found = NULL;
+	jso_value *val;
+
+	JSO_OBJECT_FOREACH(obj, str, val)
+	{
+		if (jso_string_equals_to_cstr(str, key)) {
+			found = str;
+		}
+	}
+	JSO_OBJECT_FOREACH_END;
+	(void) val;
+
+	assert_non_null(found);
+	assert_true(jso_string_has_hash(found));
+	assert_int_equal(jso_string_hash_update(JSO_STRING_HASH_INIT, (jso_ctype *) key, strlen(key)),
+			jso_string_get_hash(found));
+}
+
+/* object key hook checking that the key hash is already set before adding it to the object */
+static jso_error_type jso_parser_test_object_key(jso_parser *parser, jso_string *key)
+{
+	assert_true(jso_string_has_hash(key));
+	assert_int_equal(
+			jso_string_hash_update(JSO_STRING_HASH_INIT, JSO_STRING_VAL(key), JSO_STRING_LEN(key)),
+			jso_string_get_hash(key));
+	return JSO_ERROR_NONE;
+}
+
+/* A test for parsing object keys with hashes computed by the scanner. */
+static void test_jso_parser_parse_cstr_key_hash(void **state)
+{
+	(void) state; /* unused */
+
+	jso_value result, *value;
+	jso_parser_options options = { .max_depth = 1000 };
+	const char *json = "{ \"plain\": \"value\", \"\": [\"item\", { \"n\\u00e9st\\n\": 1 }],"
+					   " \"utf\u00c5\\ud834\\udd1e\": [[], {}], \"last\\\"\": \"\" }";
+
+	assert_int_equal(JSO_SUCCESS, jso_parse_cstr(json, strlen(json), &options, &result));
+	jso_object *obj = JSO_OBJVAL(result);
+	assert_int_equal(4, JSO_OBJECT_COUNT(obj));
+	assert_jso_parser_key_hash(obj, "plain");
+	assert_jso_parser_key_hash(obj, "");
+	assert_jso_parser_key_hash(obj, "utf\u00c5\xf0\x9d\x84\x9e");
+	assert_jso_parser_key_hash(obj, "last\"");
+
+	/* values are not hashed */
+	assert_int_equal(JSO_SUCCESS, jso_object_get_by_cstr_key(obj, "plain", 5, &value));
+	assert_false(jso_string_has_hash(JSO_STR_P(value)));
+
+	/* keys of the nested object after an array item */
+	assert_int_equal(JSO_SUCCESS, jso_object_get_by_cstr_key(obj, "", 0, &value));
+	assert_int_equal(JSO_SUCCESS, jso_array_index(JSO_ARRVAL_P(value), 0, &value));
+	assert_false(jso_string_has_hash(JSO_STR_P(value)));
+	assert_int_equal(JSO_SUCCESS, jso_object_get_by_cstr_key(obj, "", 0, &value));
+	assert_int_equal(JSO_SUCCESS, jso_array_index(JSO_ARRVAL_P(value), 1, &value));
+	assert_jso_parser_key_hash(JSO_OBJVAL_P(value), "n\u00e9st\n");
+
+	jso_value_free(&result);
+
+	/* keys are hashed when they are passed to hooks */
+	jso_parser parser;
+	jso_parser_hooks hooks = *jso_parser_hooks_decode();
+	hooks.object_key = jso_parser_test_object_key;
+	jso_io *io = jso_io_string_open_from_cstr(json, strlen(json));
+	jso_parser_init_ex(&parser, &hooks);
+	jso_scanner_init(&parser.scanner, io);
+	assert_int_equal(0, jso_yyparse(&parser));
+	jso_scanner_clear(&parser.scanner);
+	jso_value_free(&parser.result);
+	JSO_IO_FREE(io);
+
+	/* keys are recognized in deeply nested objects */
+	char deep_json[1024];
+	memset(deep_json, '[', 300);
+	memcpy(deep_json + 300, "{\"a\": 1}, {\"b\": [{\"c\": 2}]}", 27);
+	memset(deep_json + 327, ']', 300);
+	deep_json[627] = '\0';
+	io = jso_io_string_open_from_cstr(deep_json, strlen(deep_json));
+	jso_parser_init_ex(&parser, &hooks);
+	jso_scanner_init(&parser.scanner, io);
+	assert_int_equal(0, jso_yyparse(&parser));
+	jso_scanner_clear(&parser.scanner);
+	jso_value_free(&parser.result);
+	JSO_IO_FREE(io);
+}
+
+/* Parse long string in all vectorized levels and check that it is the same as scalar result. */
+static void assert_jso_parser_long_string(const char *json, jso_error_type error_type,
+		size_t first_column, size_t last_column, size_t last_line)
+{
+	static const jso_simd_level levels[] = { JSO_SIMD_LEVEL_SCALAR, JSO_SIMD_LEVEL_SWAR,
+		JSO_SIMD_LEVEL_SSE2, JSO_SIMD_LEVEL_AVX2, JSO_SIMD_LEVEL_NEON };
+	jso_simd_level level = jso_simd_get_level();
+	jso_parser_options options = { .max_depth = 1000 };
+	jso_value result, expected;
+
+	assert_int_equal(JSO_SUCCESS, jso_simd_set_level(JSO_SIMD_LEVEL_SCALAR));
+	jso_parse_cstr(json, strlen(json), &options, &expected);
+	if (error_type) {
+		assert_int_equal(JSO_TYPE_ERROR, JSO_TYPE(expected));
+		assert_int_equal(error_type, JSO_ETYPE_P(&expected));
+		assert_int_equal(first_column, JSO_ELOC_P(&expected).first_column);
+		assert_int_equal(last_column, JSO_ELOC_P(&expected).last_column);
+		assert_int_equal(last_line, JSO_ELOC_P(&expected).last_line);
+	}
+
+	for (size_t i = 1; i < sizeof(levels) / sizeof(levels[0]); i++) {
+		if (jso_simd_set_level(levels[i]) == JSO_FAILURE) {
+			continue;
+		}
+		jso_parse_cstr(json, strlen(json), &options, &result);
+		if (error_type) {
+			assert_int_equal(JSO_TYPE_ERROR, JSO_TYPE(result));
+			assert_int_equal(error_type, JSO_ETYPE_P(&result));
+			assert_memory_equal(
+					&JSO_ELOC_P(&expected), &JSO_ELOC_P(&result), sizeof(jso_error_location));
+		} else {
+			assert_true(jso_value_equals(&expected, &result));
+		}
+		jso_value_clear(&result);
+	}
+
+	jso_value_clear(&expected);
+	jso_simd_set_level(level);
+}
+
+/* A test for parsing long strings using vectorized scanning. */
+static void test_jso_parser_parse_cstr_long_string(void **state)
+{
+	(void) state; /* unused */
+
+	char json[256], key[64];
+	jso_value result, *value;
+	jso_parser_options options = { .max_depth = 1000 };
+
+	assert_jso_parser_long_string("{ \"long key with some text\": \"long value with some "
+								  "text, escapes \\n \\u00e9 and UTF-8 \u00e9\u4e2d "
+								  "characters\", \"a\": [\"line\\u000aone\\nline two\"] }",
+			0, 0, 0, 0);
+
+	/* control character after 70 plain characters */
+	memcpy(json, "[\"", 2);
+	memset(json + 2, 'a', 70);
+	memcpy(json + 72, "\x01\"]", 4);
+	assert_jso_parser_long_string(json, JSO_ERROR_CTRL_CHAR, 2, 73, 1);
+
+	/* invalid UTF-8 after multi byte character and new line */
+	memcpy(json, "[\n\"\xc3\xa9", 5);
+	memset(json + 5, 'b', 40);
+	memcpy(json + 45, "\xc3\x28\"]", 5);
+	assert_jso_parser_long_string(json, JSO_ERROR_UTF8, 1, 44, 2);
+
+	/* key hash is computed for the skipped plain characters */
+	memset(key, 'k', 50);
+	key[50] = '\0';
+	snprintf(json, sizeof(json), "{\"%s\": 1}", key);
+	assert_int_equal(JSO_SUCCESS, jso_parse_cstr(json, strlen(json), &options, &result));
+	assert_jso_parser_key_hash(JSO_OBJVAL(result), key);
+	assert_int_equal(
+			JSO_SUCCESS, jso_object_get_by_cstr_key(JSO_OBJVAL(result), key, 50, &value));
+	assert_int_equal(1, JSO_IVAL_P(value));
+	jso_value_clear(&result);
+}
+
+/* A test for parsing long UTF-8 strings using vectorized validation. */
+static void test_jso_parser_parse_cstr_utf8_string(void **state)
+{
+	(void) state; /* unused */
+
+	static const char *invalid[]
+			= { "\xed\xa0\x80", "\xe4\xb8\"", "\x80", "\xf4\x90\x80\x80" };
+	char json[512], key[160];
+	jso_value result, *value;
+	jso_parser_options options = { .max_depth = 1000 };
+
+	/* key and value with CJK characters and escapes */
+	for (size_t i = 0; i < 50; i++) {
+		memcpy(key + i * 3, "\xe4\xb8\xad", 3);
+	}
+	key[150] = '\0';
+	snprintf(json, sizeof(json), "{\"%s\": \"%s\\n%s\"}", key, key + 90, key + 120);
+	assert_jso_parser_long_string(json, 0, 0, 0, 0);
+	assert_int_equal(JSO_SUCCESS, jso_parse_cstr(json, strlen(json), &options, &result));
+	assert_jso_parser_key_hash(JSO_OBJVAL(result), key);
+	assert_int_equal(
+			JSO_SUCCESS, jso_object_get_by_cstr_key(JSO_OBJVAL(result), key, 150, &value));
+	assert_int_equal(JSO_TYPE_STRING, JSO_TYPE_P(value));
+	assert_int_equal(91, JSO_SLEN_P(value));
+	jso_value_clear(&result);
+
+	/* invalid sequence is reported on the exact column after any number of characters */
+	for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++) {
+		for (size_t n = 0; n < 50; n++) {
+			snprintf(json, sizeof(json), "[\"%.*s%s\"]", (int) n * 3, key, invalid[i]);
+			assert_jso_parser_long_string(json, JSO_ERROR_UTF8, 2, 3 + n * 3, 1);
+		}
+	}
+}
+
+/* A test for parsing and validating with custom allocators. */
+static void test_jso_parser_parse_cstr_allocator(void **state)
+{
+	(void) state; /* unused */
+
+	jso_value schema_data, result;
+	jso_mm_counter parser_counter, schema_counter;
+	const jso_allocator *parser_allocator = jso_mm_counter_init(&parser_counter, NULL);
+	const jso_allocator *schema_allocator = jso_mm_counter_init(&schema_counter, NULL);
+	jso_parser_options options = { .max_depth = 1000, .allocator = parser_allocator };
+	const char *schema_json = "{ \"type\": \"object\", \"properties\": {"
+							  " \"a\": { \"type\": \"string\", \"pattern\": \"^[a-z]+$\" },"
+							  " \"b\": { \"$ref\": \"#/properties/a\" } } }";
+	const char *json = "{ \"a\": \"abc\", \"b\": \"def\", \"c\": [1, 2, 3] }";
+
+	/* schema document is allocated by the parser allocator */
+	assert_int_equal(
+			JSO_SUCCESS, jso_parse_cstr(schema_json, strlen(schema_json), &options, &schema_data));
+	size_t schema_data_bytes = parser_counter.stats.used_bytes;
+	assert_true(schema_data_bytes > 0);
+
+	/* schema values are allocated by the schema allocator */
+	jso_schema schema;
+	jso_schema_options schema_options;
+	jso_schema_init(&schema);
+	jso_schema_options_init(&schema_options);
+	schema_options.default_version = JSO_SCHEMA_VERSION_DRAFT_06;
+	schema_options.allocator = schema_allocator;
+	assert_int_equal(JSO_SUCCESS, jso_schema_parse_ex(&schema, &schema_data, &schema_options));
+	assert_int_equal(schema_data_bytes, parser_counter.stats.used_bytes);
+	assert_true(schema_counter.stats.used_bytes > 0);
+	size_t schema_bytes = schema_counter.stats.used_bytes;
+	size_t schema_alloc_calls = schema_counter.stats.alloc_calls;
+
+	/* document is allocated by the parser allocator, reference and validation by schema one */
+	options.schema = &schema;
+	assert_int_equal(JSO_SUCCESS, jso_parse_cstr(json, strlen(json), &options, &result));
+	assert_int_equal(JSO_TYPE_OBJECT, JSO_TYPE(result));
+	assert_true(parser_counter.stats.used_bytes > schema_data_bytes);
+	assert_int_equal(schema_bytes, schema_counter.stats.used_bytes);
+	assert_true(schema_counter.stats.alloc_calls > schema_alloc_calls);
+
+	/* everything is released by the allocators that allocated it */
+	const jso_allocator *previous = jso_mm_enter(parser_allocator);
+	jso_value_free(&result);
+	jso_schema_clear(&schema);
+	jso_value_free(&schema_data);
+	jso_mm_leave(previous);
+	assert_int_equal(0, parser_counter.stats.used_bytes);
+	assert_int_equal(0, schema_counter.stats.used_bytes);
+	assert_true(schema_counter.stats.free_calls > 0);
+}
+
+/* A test for parsing memory mapped files. */
+static void test_jso_parser_parse_mmap(void **state)
+{
+	(void) state; /* unused */
+
+	jso_value result;
+	jso_parser_options options = { .max_depth = 1000 };
+	const char *path = "jso_parser_test_mmap.json";
+	/* the sizes around the page size check that the data are always followed by zero */
+	const size_t sizes[] = { 0, 2, 4095, 4096, 4097, 8192 };
+
+	for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+		FILE *fp = fopen(path, "w");
+		assert_non_null(fp);
+		if (sizes[i] > 0) {
+			fputc('[', fp);
+			for (size_t pos = 2; pos < sizes[i]; pos++) {
+				fputc(' ', fp);
+			}
+			fputc(']', fp);
+		}
+		fclose(fp);
+
+		jso_io *io = jso_io_mmap_open(path);
+		assert_non_null(io);
+		assert_int_equal(sizes[i], JSO_IO_SIZE(io));
+		if (sizes[i] > 0) {
+			assert_int_equal(JSO_SUCCESS, jso_parse_io(io, &options, &result));
+			assert_int_equal(JSO_TYPE_ARRAY, JSO_TYPE(result));
+		} else {
+			assert_int_equal(JSO_FAILURE, jso_parse_io(io, &options, &result));
+			assert_int_equal(JSO_TYPE_ERROR, JSO_TYPE(result));
+		}
+		jso_value_clear(&result);
+		assert_int_equal(JSO_SUCCESS, JSO_IO_FREE(io));
+	}
+	remove(path);
+
+	/* only regular files are mapped */
+	assert_null(jso_io_mmap_open("."));
+	assert_null(jso_io_mmap_open("jso_parser_test_missing.json"));
+}
+
+/* Parse the document in chunks that are split on the supplied positions. */
+static void jso_parser_test_push(
+		const char *json, const size_t *splits, size_t splits_count, jso_value *result)
+{
+	jso_parser_options options = { .max_depth = 1000 };
+	jso_push_parser *pp = jso_push_parser_create(&options);
+	size_t pos = 0, len = strlen(json);
+	char chunk[1024];
+
+	assert_non_null(pp);
+	for (size_t i = 0; i <= splits_count; i++) {
+		size_t end = i < splits_count ? splits[i] : len;
+		/* the chunk is overwritten after feeding to check that it is not referenced later */
+		memcpy(chunk, json + pos, end - pos);
+		jso_push_parser_feed(pp, chunk, end - pos);
+		memset(chunk, 'x', end - pos);
+		pos = end;
+	}
+	jso_push_parser_finish(pp, result);
+	jso_push_parser_free(pp);
+}
+
+/* Check that the push result is the same as the expected one and clear it. */
+static void assert_jso_parser_push_result(jso_value *expected, jso_value *result)
+{
+	if (JSO_TYPE_P(expected) == JSO_TYPE_ERROR) {
+		assert_int_equal(JSO_TYPE_ERROR, JSO_TYPE_P(result));
+		assert_int_equal(JSO_ETYPE_P(expected), JSO_ETYPE_P(result));
+		assert_memory_equal(
+				&JSO_ELOC_P(expected), &JSO_ELOC_P(result), sizeof(jso_error_location));
+	} else {
+		assert_true(jso_value_equals(expected, result));
+	}
+	jso_value_clear(result);
+}
+
+/* Check that the push result is the same as the result of parsing the whole string. */
+static void assert_jso_parser_push(const char *json)
+{
+	jso_parser_options options = { .max_depth = 1000 };
+	jso_value expected, result;
+	size_t len = strlen(json), splits[1024];
+
+	jso_parse_cstr(json, len, &options, &expected);
+
+	/* two chunks split on every position */
+	for (size_t i = 0; i <= len; i++) {
+		splits[0] = i;
+		jso_parser_test_push(json, splits, 1, &result);
+		assert_jso_parser_push_result(&expected, &result);
+	}
+
+	/* single character chunks */
+	for (size_t i = 0; i < len; i++) {
+		splits[i] = i;
+	}
+	jso_parser_test_push(json, splits, len, &result);
+	assert_jso_parser_push_result(&expected, &result);
+
+	jso_value_clear(&expected);
+}
+
+/* A test for parsing input split to chunks by the push parser. */
+static void test_jso_parser_push(void **state)
+{
+	(void) state; /* unused */
+
+	char json[512], key[128];
+	jso_value result;
+	size_t splits[2];
+
+	assert_jso_parser_push("{ \"av\": [1, -12, 3.1, 2.5e-3, 1E+2, 9223372036854775808],"
+						   " \"bv\": true, \"fv\": false, \"ov\": { \"nv\": null },"
+						   "\n \"s\u00e9\\n\": \"\\ud834\\udd1e \\u00e9\\u4e2d \\\"\\/\\t\","
+						   " \"u\": \"\u00c5\xe4\xb8\xad\xf0\x9d\x84\x9e\","
+						   " \"e\": \"\", \"a\": [] }\r\n");
+	assert_jso_parser_push("  12345678  ");
+	assert_jso_parser_push("-0.5e10");
+	assert_jso_parser_push("\"str\"");
+
+	/* errors are reported in the same location */
+	assert_jso_parser_push("[1, tru]");
+	assert_jso_parser_push("[1 2]");
+	assert_jso_parser_push("{\"a\": \"b\x01\"}");
+	assert_jso_parser_push("[\"\\ud834\"]");
+	assert_jso_parser_push("[\"a\xc3\x28\"]");
+	assert_jso_parser_push("[1, 2");
+	assert_jso_parser_push("");
+
+	/* long string and key spanning several chunks */
+	memset(key, 'k', 100);
+	key[100] = '\0';
+	snprintf(json, sizeof(json), "{\"%s\": \"%s\\n%s\"}", key, key, key);
+	assert_jso_parser_push(json);
+	splits[0] = 10;
+	splits[1] = 250;
+	jso_parser_test_push(json, splits, 2, &result);
+	assert_int_equal(JSO_TYPE_OBJECT, JSO_TYPE(result));
+	assert_jso_parser_key_hash(JSO_OBJVAL(result), key);
+	jso_value_clear(&result);
+}
+
+/* A test for releasing the push parser in the middle of the document. */
+static void test_jso_parser_push_free(void **state)
+{
+	(void) state; /* unused */
+
+	jso_mm_counter counter;
+	const jso_allocator *allocator = jso_mm_counter_init(&counter, NULL);
+	jso_parser_options options = { .max_depth = 1000, .allocator = allocator };
+	const char *json = "{\"a\": [\"b\", {\"c\": \"d\"}, 1], \"long key";
+	jso_value result;
+
+	/* values on the parser stack and the pending token are released */
+	jso_push_parser *pp = jso_push_parser_create(&options);
+	assert_int_equal(JSO_SUCCESS, jso_push_parser_feed(pp, json, strlen(json)));
+	assert_true(counter.stats.used_bytes > 0);
+	jso_push_parser_free(pp);
+	assert_int_equal(0, counter.stats.used_bytes);
+
+	/* feeding fails after error and the error is returned by finish */
+	pp = jso_push_parser_create(&options);
+	assert_int_equal(JSO_FAILURE, jso_push_parser_feed(pp, "[1 2]", 5));
+	assert_int_equal(JSO_FAILURE, jso_push_parser_feed(pp, "]", 1));
+	assert_int_equal(JSO_FAILURE, jso_push_parser_finish(pp, &result));
+	assert_int_equal(JSO_TYPE_ERROR, JSO_TYPE(result));
+	assert_int_equal(JSO_ERROR_SYNTAX, JSO_ETYPE_P(&result));
+	assert_int_equal(4, JSO_ELOC_P(&result).first_column);
+	const jso_allocator *previous = jso_mm_enter(allocator);
+	jso_value_clear(&result);
+	jso_mm_leave(previous);
+	jso_push_parser_free(pp);
+	assert_int_equal(0, counter.stats.used_bytes);
+}
+
+/* Check that the structural engine result is the same as the default engine result. */
+static void assert_jso_parser_structural(const char *json)
+{
+	const jso_simd_level levels[] = { JSO_SIMD_LEVEL_SCALAR, jso_simd_get_level() };
+	jso_simd_level level = jso_simd_get_level();
+	jso_mm_counter counter;
+	const jso_allocator *allocator = jso_mm_counter_init(&counter, NULL);
+	jso_parser_options options = { .max_depth = 8, .allocator = allocator };
+	jso_value expected, result;
+	size_t len = strlen(json);
+
+	options.engine = JSO_PARSER_ENGINE_DEFAULT;
+	jso_rc rc = jso_parse_cstr(json, len, &options, &expected);
+
+	/* the partial values are released when the input is parsed again to find the error */
+	options.engine = JSO_PARSER_ENGINE_STRUCTURAL;
+	for (size_t i = 0; i < sizeof(levels) / sizeof(levels[0]); i++) {
+		assert_int_equal(JSO_SUCCESS, jso_simd_set_level(levels[i]));
+		assert_int_equal(rc, jso_parse_cstr(json, len, &options, &result));
+		const jso_allocator *previous = jso_mm_enter(allocator);
+		assert_jso_parser_push_result(&expected, &result);
+		jso_mm_leave(previous);
+	}
+	assert_int_equal(JSO_SUCCESS, jso_simd_set_level(level));
+
+	const jso_allocator *previous = jso_mm_enter(allocator);
+	jso_value_clear(&expected);
+	jso_mm_leave(previous);
+	assert_int_equal(0, counter.stats.used_bytes);
+}
+
+/* A test for parsing using the structural index. */
+static void test_jso_parser_structural(void **state)
+{
+	(void) state; /* unused */
+
+	char json[1024], key[128];
+	jso_value result;
+	jso_parser_options options = { .engine = JSO_PARSER_ENGINE_STRUCTURAL };
+
+	assert_jso_parser_structural("{ \"av\": [1, -12, 3.1, 2.5e-3, 1E+2, 9223372036854775808],"
+								 " \"bv\": true, \"fv\": false, \"ov\": { \"nv\": null },"
+								 "\n \"s\u00e9\\n\": \"\\ud834\\udd1e \\u00e9\\u4e2d \\\"\\/\\t\","
+								 " \"u\": \"\u00c5\xe4\xb8\xad\xf0\x9d\x84\x9e\","
+								 " \"e\": \"\", \"a\": [], \"o\": {} }\r\n");
+	assert_jso_parser_structural("[[1, [2, [3, {\"a\": [[]]}]]], {\"b\":{\"c\":{}}}, \"\\\\\"]");
+	assert_jso_parser_structural("  12345678  ");
+	assert_jso_parser_structural("-0.5e10");
+	assert_jso_parser_structural("\"str\"");
+	assert_jso_parser_structural("null");
+
+	/* errors are reported in the same location */
+	assert_jso_parser_structural("[1, tru]");
+	assert_jso_parser_structural("[truefalse]");
+	assert_jso_parser_structural("[1 2]");
+	assert_jso_parser_structural("[1, 2,]");
+	assert_jso_parser_structural("[1,, 2]");
+	assert_jso_parser_structural("[1] [2]");
+	assert_jso_parser_structural("[1]x");
+	assert_jso_parser_structural("12abc");
+	assert_jso_parser_structural("\"a\"1");
+	assert_jso_parser_structural("{\"a\" 1}");
+	assert_jso_parser_structural("{\"a\": 1,}");
+	assert_jso_parser_structural("{\"a\": 1 \"b\": 2}");
+	assert_jso_parser_structural("{1: 2}");
+	assert_jso_parser_structural("{\"a\": [1, {\"b\": 2]}}");
+	assert_jso_parser_structural("[}");
+	assert_jso_parser_structural("{\"a\": \"b\x01\"}");
+	assert_jso_parser_structural("[\"\\ud834\"]");
+	assert_jso_parser_structural("[\"a\xc3\x28\"]");
+	assert_jso_parser_structural("[\"a\\\"]");
+	assert_jso_parser_structural("[1, 2");
+	assert_jso_parser_structural("[[[[[[[[[1]]]]]]]]]");
+	assert_jso_parser_structural(" \n ");
+	assert_jso_parser_structural("");
+
+	/* long strings cross the blocks and the key has hash */
+	memset(key, 'k', 100);
+	key[100] = '\0';
+	snprintf(json, sizeof(json), "{\"%s\": \"%s\\n\\\"%s\", \"%s\\\\\": 1}", key, key, key, key);
+	assert_jso_parser_structural(json);
+	assert_int_equal(JSO_SUCCESS, jso_parse_cstr(json, strlen(json), &options, &result));
+	assert_int_equal(JSO_TYPE_OBJECT, JSO_TYPE(result));
+	assert_jso_parser_key_hash(JSO_OBJVAL(result), key);
+	jso_value_clear(&result);
+	snprintf(json, sizeof(json), "[\"%s\", \"%s", key, key);
+	assert_jso_parser_structural(json);
+
+	/* the schema is validated in the same order */
+	jso_value schema_data, expected;
+	jso_schema schema;
+	jso_schema_options schema_options;
+	const char *schema_json = "{ \"type\": \"object\", \"properties\": {"
+							  " \"a\": { \"type\": \"array\", \"items\": { \"maximum\": 3 } },"
+							  " \"b\": { \"type\": \"string\", \"minLength\": 2 } } }";
+	const char *schema_docs[] = { "{\"a\": [1, 2, 3], \"b\": \"xy\"}",
+		"{\"a\": [1, 5], \"b\": \"x\"}", "{\"b\": \"x\", \"a\": [1, 5]}", "{\"a\": [1, 5}" };
+
+	assert_int_equal(JSO_SUCCESS,
+			jso_parse_cstr(schema_json, strlen(schema_json), &options, &schema_data));
+	jso_schema_init(&schema);
+	jso_schema_options_init(&schema_options);
+	schema_options.default_version = JSO_SCHEMA_VERSION_DRAFT_06;
+	assert_int_equal(JSO_SUCCESS, jso_schema_parse_ex(&schema, &schema_data, &schema_options));
+	options.schema = &schema;
+	for (size_t i = 0; i < sizeof(schema_docs) / sizeof(schema_docs[0]); i++) {
+		size_t len = strlen(schema_docs[i]);
+		options.engine = JSO_PARSER_ENGINE_DEFAULT;
+		jso_rc rc = jso_parse_cstr(schema_docs[i], len, &options, &expected);
+		assert_int_equal(i == 0 ? JSO_SUCCESS : JSO_FAILURE, rc);
+		options.engine = JSO_PARSER_ENGINE_STRUCTURAL;
+		assert_int_equal(rc, jso_parse_cstr(schema_docs[i], len, &options, &result));
+		if (JSO_TYPE(expected) == JSO_TYPE_ERROR && JSO_ETYPE(expected) == JSO_ERROR_SCHEMA) {
+			assert_string_equal(jso_schema_error_message(JSO_EVAL(expected)->schema_error),
+					jso_schema_error_message(JSO_EVAL(result)->schema_error));
+		}
+		assert_jso_parser_push_result(&expected, &result);
+		jso_value_clear(&expected);
+	}
+	jso_schema_clear(&schema);
+	jso_value_clear(&schema_data);
+}
+
+/* Check that the validation result is the same as the result of parsing. */
+static void assert_jso_parser_validate(const char *json, jso_uint max_depth)
+{
+	jso_value expected, result;
+	jso_mm_counter counter;
+	const jso_allocator *allocator = jso_mm_counter_init(&counter, NULL);
+	jso_parser_options options = { .max_depth = max_depth, .allocator = allocator };
+	size_t len = strlen(json);
+
+	jso_rc rc = jso_parse_cstr(json, len, &options, &expected);
+	size_t alloc_calls = counter.stats.alloc_calls;
+	options.validate = JSO_TRUE;
+	assert_int_equal(rc, jso_parse_cstr(json, len, &options, &result));
+	const jso_allocator *previous = jso_mm_enter(allocator);
+	if (JSO_TYPE(expected) == JSO_TYPE_ARRAY || JSO_TYPE(expected) == JSO_TYPE_OBJECT) {
+		/* only the string IO is allocated for the valid containers */
+		assert_int_equal(alloc_calls + 1, counter.stats.alloc_calls);
+		assert_int_equal(JSO_TYPE(expected), JSO_TYPE(result));
+		assert_null(JSO_ARRVAL(result));
+		jso_value_clear(&result);
+	} else {
+		assert_jso_parser_push_result(&expected, &result);
+	}
+	jso_value_clear(&expected);
+	jso_mm_leave(previous);
+	assert_int_equal(0, counter.stats.used_bytes);
+}
+
+/* A test for checking the input without creating the values. */
+static void test_jso_parser_validate(void **state)
+{
+	(void) state; /* unused */
+
+	char deep[1024];
+
+	assert_jso_parser_validate("{ \"av\": [1, -12, 3.1, 2.5e-3, 1E+2, 9223372036854775808],"
+							   " \"bv\": true, \"fv\": false, \"ov\": { \"nv\": null },"
+							   "\n \"s\u00e9\\n\": \"\\ud834\\udd1e \\u00e9\\u4e2d \\\"\\/\\t\","
+							   " \"e\": \"\", \"a\": [], \"o\": {} }\r\n",
+			0);
+	assert_jso_parser_validate("[[1, [2, [3, {\"a\": [[]]}]]], {\"b\":{\"c\":{}}}, \"\\\\\"]", 0);
+	assert_jso_parser_validate("  12345678  ", 0);
+	assert_jso_parser_validate("\"str\\n\"", 0);
+	assert_jso_parser_validate("null", 0);
+	assert_jso_parser_validate("{}", 0);
+
+	/* errors are the same as for parsing */
+	assert_jso_parser_validate("[1, tru]", 0);
+	assert_jso_parser_validate("[1 2]", 0);
+	assert_jso_parser_validate("[1, 2,]", 0);
+	assert_jso_parser_validate("[1] [2]", 0);
+	assert_jso_parser_validate("\"a\" 1", 0);
+	assert_jso_parser_validate("{\"a\" 1}", 0);
+	assert_jso_parser_validate("{\"a\": 1,}", 0);
+	assert_jso_parser_validate("{\"a\": 1 \"b\": 2}", 0);
+	assert_jso_parser_validate("{1: 2}", 0);
+	assert_jso_parser_validate("{\"a\": [1, {\"b\": 2]}}", 0);
+	assert_jso_parser_validate("[}", 0);
+	assert_jso_parser_validate("{\"a\": \"b\x01\"}", 0);
+	assert_jso_parser_validate("[\"\\ud834\"]", 0);
+	assert_jso_parser_validate("[\"a\\x\"]", 0);
+	assert_jso_parser_validate("[\"a\xc3\x28\"]", 0);
+	assert_jso_parser_validate("[1, 2", 0);
+	assert_jso_parser_validate("[[[1]]]", 2);
+	assert_jso_parser_validate(" \n ", 0);
+
+	/* nesting up to the scanner stack size does not allocate */
+	memset(deep, '[', 250);
+	memset(deep + 250, ']', 250);
+	deep[500] = '\0';
+	assert_jso_parser_validate(deep, 0);
+}
+
+/* A test for parsing more documents by a reusable context. */
+static void test_jso_parser_ctx(void **state)
+{
+	(void) state; /* unused */
+
+	char deep[1024];
+	jso_value expected, result;
+	jso_mm_counter counter;
+	const jso_allocator *allocator = jso_mm_counter_init(&counter, NULL);
+	jso_parser_options options = { .max_depth = 1000, .allocator = allocator };
+	const char *docs[] = { "{\"a\": [1, 2.5, \"x\\n\"], \"b\": {\"c\": null}}", "[1, tru]", deep,
+		"\"str\"", "{\"a\": 1,}", "[true, false]" };
+
+	/* the deep document grows the scanner containers stack */
+	memset(deep, '[', 300);
+	memset(deep + 300, ']', 300);
+	deep[600] = '\0';
+
+	for (int engine = JSO_PARSER_ENGINE_DEFAULT; engine <= JSO_PARSER_ENGINE_STRUCTURAL;
+			engine++) {
+		options.engine = engine;
+		jso_parser_ctx *ctx = jso_parser_ctx_create(&options, JSO_FALSE);
+		assert_non_null(ctx);
+		for (size_t round = 0; round < 2; round++) {
+			for (size_t i = 0; i < sizeof(docs) / sizeof(docs[0]); i++) {
+				size_t len = strlen(docs[i]);
+				jso_rc rc = jso_parse_cstr(docs[i], len, &options, &expected);
+				assert_int_equal(rc, jso_parser_ctx_parse(ctx, docs[i], len, &result));
+				const jso_allocator *previous = jso_mm_enter(allocator);
+				assert_jso_parser_push_result(&expected, &result);
+				jso_value_clear(&expected);
+				jso_mm_leave(previous);
+			}
+		}
+		jso_parser_ctx_free(ctx);
+		assert_int_equal(0, counter.stats.used_bytes);
+	}
+
+	/* the documents in the owned arena do not allocate once the context is warmed up */
+	jso_parser_ctx *ctx = jso_parser_ctx_create(&options, JSO_TRUE);
+	assert_non_null(ctx);
+	assert_int_equal(JSO_SUCCESS, jso_parser_ctx_parse(ctx, docs[2], strlen(docs[2]), &result));
+	assert_int_equal(JSO_SUCCESS, jso_parser_ctx_parse(ctx, docs[0], strlen(docs[0]), &result));
+	size_t alloc_calls = counter.stats.alloc_calls;
+	for (size_t i = 0; i < 10; i++) {
+		assert_int_equal(
+				JSO_SUCCESS, jso_parser_ctx_parse(ctx, docs[0], strlen(docs[0]), &result));
+		assert_int_equal(JSO_TYPE_OBJECT, JSO_TYPE(result));
+	}
+	assert_int_equal(alloc_calls, counter.stats.alloc_calls);
+	jso_parser_ctx_free(ctx);
+	assert_int_equal(0, counter.stats.used_bytes);
+
+	/* the schema validation stack is reused and the errors are not kept between documents */
+	jso_value schema_data;
+	jso_schema schema;
+	jso_schema_options schema_options;
+	const char *schema_json = "{ \"type\": \"object\", \"properties\": {"
+							  " \"a\": { \"type\": \"array\", \"items\": { \"maximum\": 3 } } } }";
+	const char *schema_docs[] = { "{\"a\": [1, 5]}", "{\"a\": [1, 2]}", "{\"a\": [1, 2}",
+		"{\"a\": []}", "{\"a\": [[], 4]}" };
+
+	options.allocator = NULL;
+	options.engine = JSO_PARSER_ENGINE_DEFAULT;
+	assert_int_equal(JSO_SUCCESS,
+			jso_parse_cstr(schema_json, strlen(schema_json), &options, &schema_data));
+	jso_schema_init(&schema);
+	jso_schema_options_init(&schema_options);
+	schema_options.default_version = JSO_SCHEMA_VERSION_DRAFT_06;
+	assert_int_equal(JSO_SUCCESS, jso_schema_parse_ex(&schema, &schema_data, &schema_options));
+	options.schema = &schema;
+	ctx = jso_parser_ctx_create(&options, JSO_FALSE);
+	assert_non_null(ctx);
+	for (size_t i = 0; i < sizeof(schema_docs) / sizeof(schema_docs[0]); i++) {
+		size_t len = strlen(schema_docs[i]);
+		jso_rc rc = jso_parse_cstr(schema_docs[i], len, &options, &expected);
+		assert_int_equal(i % 2 == 1 ? JSO_SUCCESS : JSO_FAILURE, rc);
+		assert_int_equal(rc, jso_parser_ctx_parse(ctx, schema_docs[i], len, &result));
+		if (JSO_TYPE(expected) == JSO_TYPE_ERROR && JSO_ETYPE(expected) == JSO_ERROR_SCHEMA) {
+			assert_string_equal(jso_schema_error_message(JSO_EVAL(expected)->schema_error),
+					jso_schema_error_message(JSO_EVAL(result)->schema_error));
+		}
+		assert_jso_parser_push_result(&expected, &result);
+		jso_value_clear(&expected);
+	}
+	jso_parser_ctx_free(ctx);
+	jso_schema_clear(&schema);
+	jso_value_clear(&schema_data);
+}
+
+/* Check that both engines apply the duplicate keys policy and return the expected document. */
+static void assert_jso_parser_duplicate_keys(
+		const char *json, jso_parser_duplicate_keys duplicate_keys, const char *expected_json)
+{
+	jso_mm_counter counter;
+	const jso_allocator *allocator = jso_mm_counter_init(&counter, NULL);
+	jso_parser_options options = { .allocator = allocator, .duplicate_keys = duplicate_keys };
+	jso_parser_options expected_options = { .max_depth = 0 };
+	jso_value expected, result;
+
+	assert_int_equal(JSO_SUCCESS,
+			jso_parse_cstr(expected_json, strlen(expected_json), &expected_options, &expected));
+	for (int engine = JSO_PARSER_ENGINE_DEFAULT; engine <= JSO_PARSER_ENGINE_STRUCTURAL;
+			engine++) {
+		options.engine = engine;
+		assert_int_equal(JSO_SUCCESS, jso_parse_cstr(json, strlen(json), &options, &result));
+		const jso_allocator *previous = jso_mm_enter(allocator);
+		assert_jso_parser_push_result(&expected, &result);
+		jso_mm_leave(previous);
+	}
+	jso_value_clear(&expected);
+	assert_int_equal(0, counter.stats.used_bytes);
+}
+
+/* A test for parsing the objects with duplicate keys. */
+static void test_jso_parser_duplicate_keys(void **state)
+{
+	(void) state; /* unused */
+
+	jso_value result, expected, *value;
+	jso_parser_options options = { .duplicate_keys = JSO_PARSER_DUPLICATE_KEYS_ERROR };
+	const char *json = "{\"a\": 1, \"b\": [2], \"a\": {\"c\": [3]}, \"a\": \"x\"}";
+
+	assert_jso_parser_duplicate_keys(
+			json, JSO_PARSER_DUPLICATE_KEYS_LAST_WINS, "{\"a\": \"x\", \"b\": [2]}");
+	assert_jso_parser_duplicate_keys(
+			json, JSO_PARSER_DUPLICATE_KEYS_FIRST_WINS, "{\"a\": 1, \"b\": [2]}");
+	assert_jso_parser_duplicate_keys(json, JSO_PARSER_DUPLICATE_KEYS_COLLECT,
+			"{\"a\": [1, {\"c\": [3]}, \"x\"], \"b\": [2]}");
+	/* the same keys in the nested objects are not duplicates */
+	assert_jso_parser_duplicate_keys("{\"a\": {\"a\": {\"a\": 1}}, \"b\": {\"a\": 2}}",
+			JSO_PARSER_DUPLICATE_KEYS_ERROR, "{\"a\": {\"a\": {\"a\": 1}}, \"b\": {\"a\": 2}}");
+
+	/* the last value keeps the position of the first key */
+	options.duplicate_keys = JSO_PARSER_DUPLICATE_KEYS_LAST_WINS;
+	assert_int_equal(JSO_SUCCESS, jso_parse_cstr(json, strlen(json), &options, &result));
+	jso_object *obj = JSO_OBJVAL(result);
+	assert_int_equal(2, JSO_OBJECT_COUNT(obj));
+	assert_string_equal("a", (const char *) JSO_STRING_VAL(obj->ht.first_entry->key));
+	jso_value_clear(&result);
+
+	/* the collected values are distinguished from the array value */
+	options.duplicate_keys = JSO_PARSER_DUPLICATE_KEYS_COLLECT;
+	assert_int_equal(JSO_SUCCESS, jso_parse_cstr(json, strlen(json), &options, &result));
+	assert_int_equal(JSO_SUCCESS, jso_object_get_by_cstr_key(JSO_OBJVAL(result), "a", 1, &value));
+	assert_true(JSO_ARRAY_FLAGS(JSO_ARRVAL_P(value)) & JSO_ARRAY_FLAG_DUPLICATES);
+	assert_int_equal(JSO_SUCCESS, jso_object_get_by_cstr_key(JSO_OBJVAL(result), "b", 1, &value));
+	assert_false(JSO_ARRAY_FLAGS(JSO_ARRVAL_P(value)) & JSO_ARRAY_FLAG_DUPLICATES);
+	jso_value_clear(&result);
+
+	/* the collected values are allocated in arena */
+	jso_arena *arena = jso_arena_alloc(256);
+	options.arena = arena;
+	assert_int_equal(JSO_SUCCESS, jso_parse_cstr(json, strlen(json), &options, &result));
+	assert_int_equal(JSO_SUCCESS, jso_object_get_by_cstr_key(JSO_OBJVAL(result), "a", 1, &value));
+	assert_true(JSO_ARRAY_FLAGS(JSO_ARRVAL_P(value)) & JSO_ARRAY_FLAG_ARENA);
+	assert_int_equal(3, JSO_ARRAY_LEN(JSO_ARRVAL_P(value)));
+	jso_value_free(&result);
+	jso_arena_free(arena);
+	options.arena = NULL;
+
+	/* the error is reported at the duplicate key by both engines */
+	json = "{\"a\": 1,\n \"b\": {\"a\": 2, \"c\": 3,\n  \"a\": [4]}}";
+	options.duplicate_keys = JSO_PARSER_DUPLICATE_KEYS_ERROR;
+	options.engine = JSO_PARSER_ENGINE_DEFAULT;
+	assert_int_equal(JSO_FAILURE, jso_parse_cstr(json, strlen(json), &options, &expected));
+	assert_int_equal(JSO_TYPE_ERROR, JSO_TYPE(expected));
+	assert_int_equal(JSO_ERROR_DUPLICATE_KEY, JSO_ETYPE(expected));
+	assert_int_equal(3, JSO_ELOC(expected).first_line);
+	assert_int_equal(3, JSO_ELOC(expected).first_column);
+	options.engine = JSO_PARSER_ENGINE_STRUCTURAL;
+	assert_int_equal(JSO_FAILURE, jso_parse_cstr(json, strlen(json), &options, &result));
+	assert_jso_parser_push_result(&expected, &result);
+	jso_value_clear(&expected);
+
+	/* the schema validation path applies the same policy */
+	jso_value schema_data;
+	jso_schema schema;
+	jso_schema_options schema_options;
+	const char *schema_json = "{ \"type\": \"object\", \"properties\": {"
+							  " \"a\": { \"type\": \"integer\", \"maximum\": 3 } } }";
+
+	options.engine = JSO_PARSER_ENGINE_DEFAULT;
+	assert_int_equal(JSO_SUCCESS,
+			jso_parse_cstr(schema_json, strlen(schema_json), &options, &schema_data));
+	jso_schema_init(&schema);
+	jso_schema_options_init(&schema_options);
+	schema_options.default_version = JSO_SCHEMA_VERSION_DRAFT_06;
+	assert_int_equal(JSO_SUCCESS, jso_schema_parse_ex(&schema, &schema_data, &schema_options));
+	options.schema = &schema;
+	json = "{\"a\": 1, \"a\": 2}";
+	assert_int_equal(JSO_FAILURE, jso_parse_cstr(json, strlen(json), &options, &result));
+	assert_int_equal(JSO_ERROR_DUPLICATE_KEY, JSO_ETYPE(result));
+	assert_int_equal(10, JSO_ELOC(result).first_column);
+	jso_value_clear(&result);
+	options.duplicate_keys = JSO_PARSER_DUPLICATE_KEYS_FIRST_WINS;
+	assert_int_equal(JSO_SUCCESS, jso_parse_cstr(json, strlen(json), &options, &result));
+	assert_int_equal(JSO_SUCCESS, jso_object_get_by_cstr_key(JSO_OBJVAL(result), "a", 1, &value));
+	assert_int_equal(1, JSO_IVAL_P(value));
+	jso_value_clear(&result);
+	jso_schema_clear(&schema);
+	jso_value_clear(&schema_data);
+}
+
+/* Parse the document projected to the pointers and compare it with the expected document. */
+static void assert_jso_parser_projection(
+		const char *json, const char **paths, size_t paths_count, const char *expected)
+{
+	jso_value result, expected_result;
+	jso_parser_options options = { .max_depth = 1000 };
+	jso_pointer *pointers[8];
+
+	for (size_t i = 0; i < paths_count; i++) {
+		jso_string *path = jso_string_create_from_cstr(paths[i]);
+		pointers[i] = jso_pointer_create(path);
+		jso_string_free(path);
+	}
+	assert_int_equal(JSO_SUCCESS,
+			jso_parse_projection_cstr(
+					json, strlen(json), pointers, paths_count, &options, &result));
+	assert_int_equal(JSO_SUCCESS,
+			jso_parse_cstr(expected, strlen(expected), &options, &expected_result));
+	assert_true(jso_value_equals(&expected_result, &result));
+	jso_value_clear(&result);
+	jso_value_clear(&expected_result);
+	for (size_t i = 0; i < paths_count; i++) {
+		jso_pointer_free(pointers[i]);
+	}
+}
+
+/* A test for parsing only the values referenced by pointers. */
+static void test_jso_parser_projection(void **state)
+{
+	(void) state; /* unused */
+
+	const char *json = "{\"a\": {\"b\": 1, \"c\": [1, 2]}, \"d\": [{\"e\": \"x\"}, [3], {\"e\": "
+					   "\"y\", \"f\": \"z\"}], \"g\": {\"h\": null}, \"a~/\": true}";
+	const char *paths1[] = { "/a/b" };
+	const char *paths2[] = { "/d/2/e", "/g", "/a~0~1" };
+	const char *paths3[] = { "/a", "/a/c/1", "/x/y", "/a/b/c", "/d/x" };
+
+	assert_jso_parser_projection(json, paths1, 1, "{\"a\": {\"b\": 1}}");
+	assert_jso_parser_projection(json, paths2, 3,
+			"{\"d\": [null, null, {\"e\": \"y\"}], \"g\": {\"h\": null}, \"a~/\": true}");
+	assert_jso_parser_projection(
+			json, paths3, 5, "{\"a\": {\"b\": 1, \"c\": [1, 2]}, \"d\": []}");
+	assert_jso_parser_projection("[]", paths1, 1, "[]");
+	assert_jso_parser_projection("\"s\"", paths1, 1, "\"s\"");
+}
+
+/* A test for projection parsing errors. */
+static void test_jso_parser_projection_error(void **state)
+{
+	(void) state; /* unused */
+
+	jso_value result;
+	jso_mm_counter counter;
+	const jso_allocator *allocator = jso_mm_counter_init(&counter, NULL);
+	jso_parser_options options = { .max_depth = 1000, .allocator = allocator };
+	const char *json = "{\"a\": {\"b\": [1, \"x\"], \"c\": [}";
+	jso_string *path = jso_string_create_from_cstr("/a/b");
+	jso_pointer *jp = jso_pointer_create(path);
+
+	/* the partial tree is released and the skipped subtree is checked for nesting */
+	assert_int_equal(JSO_FAILURE,
+			jso_parse_projection_cstr(json, strlen(json), &jp, 1, &options, &result));
+	assert_int_equal(JSO_TYPE_ERROR, JSO_TYPE(result));
+	assert_int_equal(JSO_ERROR_SYNTAX, JSO_ETYPE_P(&result));
+	const jso_allocator *previous = jso_mm_enter(allocator);
+	jso_value_clear(&result);
+	jso_mm_leave(previous);
+	assert_int_equal(0, counter.stats.used_bytes);
+
+	jso_pointer_free(jp);
+	jso_string_free(path);
+}
+
 int main(void)
 {
 	const struct CMUnitTest tests[] = {
 		cmocka_unit_test(test_jso_parser_parse_cstr_simple_object),
 		cmocka_unit_test(test_jso_parser_parse_cstr_nested_object),
+		cmocka_unit_test(test_jso_parser_parse_cstr_numbers),
+		cmocka_unit_test(test_jso_parser_parse_cstr_arena),
+		cmocka_unit_test(test_jso_parser_parse_cstr_allocator),
+		cmocka_unit_test(test_jso_parser_parse_cstr_key_hash),
+		cmocka_unit_test(test_jso_parser_parse_cstr_borrow_strings),
+		cmocka_unit_test(test_jso_parser_parse_cstr_long_string),
+		cmocka_unit_test(test_jso_parser_parse_cstr_utf8_string),
+		cmocka_unit_test(test_jso_parser_parse_mmap),
+		cmocka_unit_test(test_jso_parser_push),
+		cmocka_unit_test(test_jso_parser_push_free),
+		cmocka_unit_test(test_jso_parser_structural),
+		cmocka_unit_test(test_jso_parser_ctx),
+		cmocka_unit_test(test_jso_parser_validate),
+		cmocka_unit_test(test_jso_parser_duplicate_keys),
+		cmocka_unit_test(test_jso_parser_projection),
+		cmocka_unit_test(test_jso_parser_projection_error),
 	};
 
 	return cmocka_run_group_tests(tests, NULL, NULL);
@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "../../src/jso_sax.h"
+#include "../../src/jso.h"
+#include "../../src/io/jso_io_string.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+/* context collecting the events as a text */
+typedef struct _jso_sax_test_ctx {
+	char events[512];
+	size_t len;
+	/* key that triggers the action */
+	const char *key;
+	/* action returned for the key or the container following it */
+	jso_sax_action key_action;
+	jso_sax_action container_action;
+	jso_bool container_next;
+} jso_sax_test_ctx;
+
+static void jso_sax_test_event(jso_sax_test_ctx *tctx, const char *fmt, ...)
+{
+	va_list args;
+	va_start(args, fmt);
+	tctx->len += vsnprintf(tctx->events + tctx->len, sizeof(tctx->events) - tctx->len, fmt, args);
+	va_end(args);
+}
+
+static jso_sax_action jso_sax_test_container(jso_sax_test_ctx *tctx, const char *event)
+{
+	jso_sax_test_event(tctx, "%s", event);
+	if (tctx->container_next) {
+		tctx->container_next = JSO_FALSE;
+		return tctx->container_action;
+	}
+	return JSO_SAX_CONTINUE;
+}
+
+static jso_sax_action jso_sax_test_object_start(void *ctx)
+{
+	return jso_sax_test_container(ctx, "{");
+}
+
+static jso_sax_action jso_sax_test_object_key(void *ctx, const jso_ctype *key, size_t len)
+{
+	jso_sax_test_ctx *tctx = ctx;
+	jso_sax_test_event(tctx, "k(%.*s)", (int) len, (const char *) key);
+	if (tctx->key != NULL && strlen(tctx->key) == len && !memcmp(tctx->key, key, len)) {
+		tctx->container_next = JSO_TRUE;
+		return tctx->key_action;
+	}
+	return JSO_SAX_CONTINUE;
+}
+
+static jso_sax_action jso_sax_test_object_end(void *ctx)
+{
+	jso_sax_test_event(ctx, "}");
+	return JSO_SAX_CONTINUE;
+}
+
+static jso_sax_action jso_sax_test_array_start(void *ctx)
+{
+	return jso_sax_test_container(ctx, "[");
+}
+
+static jso_sax_action jso_sax_test_array_end(void *ctx)
+{
+	jso_sax_test_event(ctx, "]");
+	return JSO_SAX_CONTINUE;
+}
+
+static jso_sax_action jso_sax_test_null_value(void *ctx)
+{
+	jso_sax_test_event(ctx, "n");
+	return JSO_SAX_CONTINUE;
+}
+
+static jso_sax_action jso_sax_test_bool_value(void *ctx, jso_bool bval)
+{
+	jso_sax_test_event(ctx, "b(%d)", (int) bval);
+	return JSO_SAX_CONTINUE;
+}
+
+static jso_sax_action jso_sax_test_int_value(void *ctx, jso_int ival)
+{
+	jso_sax_test_event(ctx, "i(%ld)", (long) ival);
+	return JSO_SAX_CONTINUE;
+}
+
+static jso_sax_action jso_sax_test_double_value(void *ctx, jso_double dval)
+{
+	jso_sax_test_event(ctx, "d(%g)", dval);
+	return JSO_SAX_CONTINUE;
+}
+
+static jso_sax_action jso_sax_test_string_value(void *ctx, const jso_ctype *str, size_t len)
+{
+	jso_sax_test_event(ctx, "s(%.*s)", (int) len, (const char *) str);
+	return JSO_SAX_CONTINUE;
+}
+
+static const jso_sax_callbacks jso_sax_test_callbacks = {
+	.object_start = jso_sax_test_object_start,
+	.object_key = jso_sax_test_object_key,
+	.object_end = jso_sax_test_object_end,
+	.array_start = jso_sax_test_array_start,
+	.array_end = jso_sax_test_array_end,
+	.null_value = jso_sax_test_null_value,
+	.bool_value = jso_sax_test_bool_value,
+	.int_value = jso_sax_test_int_value,
+	.double_value = jso_sax_test_double_value,
+	.string_value = jso_sax_test_string_value,
+};
+
+/* parse the JSON and check the collected events */
+static void assert_jso_sax_events(
+		const char *json, jso_sax_test_ctx *tctx, jso_rc rc, const char *events)
+{
+	jso_value error;
+	jso_parser_options options = { .max_depth = 1000 };
+
+	tctx->len = 0;
+	tctx->events[0] = '\0';
+	tctx->container_next = JSO_FALSE;
+	assert_int_equal(rc,
+			jso_sax_parse_cstr(
+					json, strlen(json), &jso_sax_test_callbacks, tctx, &options, &error));
+	assert_string_equal(events, tctx->events);
+	if (rc == JSO_FAILURE) {
+		jso_value_clear(&error);
+	}
+}
+
+/* parse the JSON and check the error */
+static void assert_jso_sax_error(const char *json, jso_uint max_depth, jso_error_type type,
+		size_t first_column, size_t first_line)
+{
+	jso_value error;
+	jso_sax_test_ctx tctx = { .len = 0 };
+	jso_parser_options options = { .max_depth = max_depth };
+
+	assert_int_equal(JSO_FAILURE,
+			jso_sax_parse_cstr(
+					json, strlen(json), &jso_sax_test_callbacks, &tctx, &options, &error));
+	assert_int_equal(JSO_TYPE_ERROR, JSO_TYPE(error));
+	assert_int_equal(type, JSO_EVAL(error)->type);
+	assert_int_equal(first_column, JSO_EVAL(error)->loc.first_column);
+	assert_int_equal(first_line, JSO_EVAL(error)->loc.first_line);
+	jso_value_clear(&error);
+}
+
+/* A test for delivering all events. */
+static void test_jso_sax_events(void **state)
+{
+	(void) state; /* unused */
+
+	jso_sax_test_ctx tctx = { .key = NULL };
+
+	assert_jso_sax_events("{\"a\": [1, -2.5, \"x\", true, false, null, {}, []], \"b\": \"\"}",
+			&tctx, JSO_SUCCESS, "{k(a)[i(1)d(-2.5)s(x)b(1)b(0)n{}[]]k(b)s()}");
+	assert_jso_sax_events("\"a\\tb\\u00e9\"", &tctx, JSO_SUCCESS, "s(a\tb\xc3\xa9)");
+	assert_jso_sax_events("{\"k\\\"ey\": {\"\\n\": 1}}", &tctx, JSO_SUCCESS,
+			"{k(k\"ey){k(\n)i(1)}}");
+	assert_jso_sax_events("12", &tctx, JSO_SUCCESS, "i(12)");
+	assert_jso_sax_events("[1, 2", &tctx, JSO_FAILURE, "[i(1)i(2)");
+}
+
+/* A test for skipping subtrees. */
+static void test_jso_sax_skip(void **state)
+{
+	(void) state; /* unused */
+
+	jso_sax_test_ctx tctx = { .key = "skip", .key_action = JSO_SAX_SKIP };
+	const char *json = "{\"a\": 1, \"skip\": {\"b\": [\"]}\\\"\", {\"c\": 2}]}, \"d\": [3]}";
+
+	/* skip from the key does not deliver the value */
+	assert_jso_sax_events(json, &tctx, JSO_SUCCESS, "{k(a)i(1)k(skip)k(d)[i(3)]}");
+	assert_jso_sax_events("{\"skip\": 5, \"d\": 6}", &tctx, JSO_SUCCESS, "{k(skip)k(d)i(6)}");
+
+	/* skip from the container start delivers only the start */
+	tctx.key_action = JSO_SAX_CONTINUE;
+	tctx.container_action = JSO_SAX_SKIP;
+	assert_jso_sax_events(json, &tctx, JSO_SUCCESS, "{k(a)i(1)k(skip){k(d)[i(3)]}");
+
+	/* unterminated skipped container */
+	assert_jso_sax_events("{\"skip\": [[1]", &tctx, JSO_FAILURE, "{k(skip)[");
+}
+
+/* A test for aborting parsing. */
+static void test_jso_sax_abort(void **state)
+{
+	(void) state; /* unused */
+
+	jso_value error;
+	jso_parser_options options = { .max_depth = 1000 };
+	jso_sax_test_ctx tctx = { .key = "stop", .key_action = JSO_SAX_ABORT };
+	const char *json = "{\"a\": 1, \"stop\": 2, \"b\": 3}";
+
+	assert_jso_sax_events(json, &tctx, JSO_FAILURE, "{k(a)i(1)k(stop)");
+
+	tctx.key_action = JSO_SAX_CONTINUE;
+	tctx.container_action = JSO_SAX_ABORT;
+	json = "{\"stop\": [1], \"b\": 3}";
+	assert_jso_sax_events(json, &tctx, JSO_FAILURE, "{k(stop)[");
+
+	tctx.container_next = JSO_FALSE;
+	assert_int_equal(JSO_FAILURE,
+			jso_sax_parse_cstr(
+					json, strlen(json), &jso_sax_test_callbacks, &tctx, &options, &error));
+	assert_int_equal(JSO_ERROR_ABORT, JSO_EVAL(error)->type);
+	jso_value_clear(&error);
+}
+
+/* A test for parsing errors. */
+static void test_jso_sax_error(void **state)
+{
+	(void) state; /* unused */
+
+	assert_jso_sax_error("[1 2]", 0, JSO_ERROR_SYNTAX, 4, 1);
+	assert_jso_sax_error("{\"a\" 1}", 0, JSO_ERROR_SYNTAX, 6, 1);
+	assert_jso_sax_error("{1: 2}", 0, JSO_ERROR_SYNTAX, 2, 1);
+	assert_jso_sax_error("[1, 2}", 0, JSO_ERROR_SYNTAX, 6, 1);
+	assert_jso_sax_error("{\"a\": 1]", 0, JSO_ERROR_SYNTAX, 8, 1);
+	assert_jso_sax_error("[1,]", 0, JSO_ERROR_SYNTAX, 4, 1);
+	assert_jso_sax_error("1 2", 0, JSO_ERROR_SYNTAX, 3, 1);
+	assert_jso_sax_error("[\n\"a\\x\"]", 0, JSO_ERROR_ESCAPE, 1, 2);
+	assert_jso_sax_error("[[[1]]]", 2, JSO_ERROR_DEPTH, 3, 1);
+}
+
+/* A test for parsing without any allocation. */
+static void test_jso_sax_allocator(void **state)
+{
+	(void) state; /* unused */
+
+	jso_value error;
+	jso_mm_counter counter;
+	jso_sax_test_ctx tctx = { .key = NULL };
+	const jso_allocator *allocator = jso_mm_counter_init(&counter, NULL);
+	jso_parser_options options = { .max_depth = 1000, .allocator = allocator };
+	const char *json = "{\"a\": [1, 2.5, \"xyz\", {\"b\": null}], \"c\": \"\"}";
+	jso_io *io = jso_io_string_open_from_cstr(json, strlen(json));
+
+	assert_int_equal(JSO_SUCCESS,
+			jso_sax_parse_io(io, &jso_sax_test_callbacks, &tctx, &options, &error));
+	assert_int_equal(0, counter.stats.alloc_calls);
+	assert_int_equal(0, counter.stats.realloc_calls);
+	JSO_IO_FREE(io);
+
+	/* strings with escapes are copied to the reused buffer that is released at the end */
+	json = "[\"a\\nb\", \"c\\td\"]";
+	io = jso_io_string_open_from_cstr(json, strlen(json));
+	assert_int_equal(JSO_SUCCESS,
+			jso_sax_parse_io(io, &jso_sax_test_callbacks, &tctx, &options, &error));
+	assert_int_equal(1, counter.stats.alloc_calls + counter.stats.realloc_calls);
+	assert_int_equal(0, counter.stats.used_bytes);
+	JSO_IO_FREE(io);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_jso_sax_events),
+		cmocka_unit_test(test_jso_sax_skip),
+		cmocka_unit_test(test_jso_sax_abort),
+		cmocka_unit_test(test_jso_sax_error),
+		cmocka_unit_test(test_jso_sax_allocator),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -22,8 +22,11 @@
  */
 
 #include "../../src/jso_builder.h"
+#include "../../src/jso_parser.h"
 #include "../../src/jso_schema.h"
 #include "../../src/schema/jso_schema_error.h"
+#include "../../src/schema/jso_schema_keyword.h"
+#include "../../src/schema/jso_schema_program.h"
 #include "../../src/jso.h"
 
 #include <stdarg.h>
@@ -194,6 +197,49 @@ static void test_jso_schema_string_with_pattern(void **state)
 	jso_schema_clear(&schema);
 }
 
+/* A test for a pattern matched against a subject that exceeds the JIT stack. */
+static void test_jso_schema_string_with_pattern_long_subject(void **state)
+{
+	(void) state; /* unused */
+
+	jso_schema_validation_result result;
+	jso_builder builder;
+	jso_builder_init(&builder);
+
+	// build schema
+	jso_schema_test_start_schema_object(&builder);
+	jso_builder_object_add_cstr(&builder, "type", "string");
+	jso_builder_object_add_cstr(&builder, "pattern", "^(a|b)*$");
+
+	jso_builder_object_end(&builder);
+
+	jso_schema schema;
+	jso_schema_init(&schema);
+	assert_jso_schema_result_success(jso_schema_parse(&schema, jso_builder_get_value(&builder)));
+	jso_builder_clear_all(&builder);
+
+	jso_value instance;
+	jso_string *sv;
+	char subject[5001];
+	for (size_t i = 0; i < 5000; i++) {
+		subject[i] = i % 2 ? 'b' : 'a';
+	}
+	subject[5000] = '\0';
+
+	sv = jso_string_create_from_cstr(subject);
+	JSO_VALUE_SET_STRING(instance, sv);
+	assert_jso_schema_validation_success(jso_schema_validate(&schema, &instance));
+	jso_value_clear(&instance);
+
+	subject[4999] = 'c';
+	sv = jso_string_create_from_cstr(subject);
+	JSO_VALUE_SET_STRING(instance, sv);
+	assert_jso_schema_validation_failure(jso_schema_validate(&schema, &instance));
+	jso_value_clear(&instance);
+
+	jso_schema_clear(&schema);
+}
+
 /* A test for a simple integer type. */
 static void test_jso_schema_integer(void **state)
 {
@@ -700,6 +746,10 @@ static void test_jso_schema_object_pattern_props(void **state)
 	jso_builder_object_add_object_start(&builder, "^I_");
 	jso_builder_object_add_cstr(&builder, "type", "integer");
 	jso_builder_object_end(&builder);
+	// boolean properties with captured group
+	jso_builder_object_add_object_start(&builder, "^(B)_");
+	jso_builder_object_add_cstr(&builder, "type", "boolean");
+	jso_builder_object_end(&builder);
 	// end properties and root object
 	jso_builder_object_end(&builder);
 	jso_builder_object_end(&builder);
@@ -712,10 +762,17 @@ static void test_jso_schema_object_pattern_props(void **state)
 	jso_builder_object_start(&builder);
 	jso_builder_object_add_int(&builder, "I_val", 10);
 	jso_builder_object_add_cstr(&builder, "S_val", "Pennsylvania");
+	jso_builder_object_add_bool(&builder, "B_val", true);
 	assert_jso_schema_validation_success(
 			jso_schema_validate(&schema, jso_builder_get_value(&builder)));
 	jso_builder_clear_all(&builder);
 
+	jso_builder_object_start(&builder);
+	jso_builder_object_add_int(&builder, "B_val", 1);
+	assert_jso_schema_validation_failure(
+			jso_schema_validate(&schema, jso_builder_get_value(&builder)));
+	jso_builder_clear_all(&builder);
+
 	jso_builder_object_start(&builder);
 	jso_builder_object_add_cstr(&builder, "I_val", "10");
 	jso_builder_object_add_cstr(&builder, "S_val", "Pennsylvania");
@@ -726,6 +783,158 @@ static void test_jso_schema_object_pattern_props(void **state)
 	jso_schema_clear(&schema);
 }
 
+/* A test for pattern properties matched against a key that exceeds the JIT stack. */
+static void test_jso_schema_object_pattern_props_long_key(void **state)
+{
+	(void) state; /* unused */
+
+	jso_schema_validation_result result;
+	jso_builder builder;
+	jso_builder_init(&builder);
+
+	// build schema
+	jso_schema_test_start_schema_object(&builder);
+	jso_builder_object_add_cstr(&builder, "type", "object");
+	// pattern properties
+	jso_builder_object_add_object_start(&builder, "patternProperties");
+	jso_builder_object_add_object_start(&builder, "^(a|b)*$");
+	jso_builder_object_add_cstr(&builder, "type", "integer");
+	jso_builder_object_end(&builder);
+	// end properties and root object
+	jso_builder_object_end(&builder);
+	jso_builder_object_end(&builder);
+
+	jso_schema schema;
+	jso_schema_init(&schema);
+	assert_jso_schema_result_success(jso_schema_parse(&schema, jso_builder_get_value(&builder)));
+	jso_builder_clear_all(&builder);
+
+	char key[5001];
+	for (size_t i = 0; i < 5000; i++) {
+		key[i] = i % 2 ? 'b' : 'a';
+	}
+	key[5000] = '\0';
+
+	jso_builder_object_start(&builder);
+	jso_builder_object_add_int(&builder, key, 10);
+	assert_jso_schema_validation_success(
+			jso_schema_validate(&schema, jso_builder_get_value(&builder)));
+	jso_builder_clear_all(&builder);
+
+	jso_builder_object_start(&builder);
+	jso_builder_object_add_cstr(&builder, key, "10");
+	assert_jso_schema_validation_failure(
+			jso_schema_validate(&schema, jso_builder_get_value(&builder)));
+	jso_builder_clear_all(&builder);
+
+	jso_schema_clear(&schema);
+}
+
+/* A test for an object type with pattern properties using different pattern prefixes. */
+static void test_jso_schema_object_pattern_props_prefixes(void **state)
+{
+	(void) state; /* unused */
+
+	jso_schema_validation_result result;
+	jso_builder builder;
+	jso_builder_init(&builder);
+
+	// build schema of array with object items
+	jso_schema_test_start_schema_object(&builder);
+	jso_builder_object_add_cstr(&builder, "type", "array");
+	jso_builder_object_add_object_start(&builder, "items");
+	jso_builder_object_add_cstr(&builder, "type", "object");
+	jso_builder_object_add_object_start(&builder, "patternProperties");
+	// literal prefix
+	jso_builder_object_add_object_start(&builder, "^S_");
+	jso_builder_object_add_cstr(&builder, "type", "string");
+	jso_builder_object_end(&builder);
+	// escaped literal prefix
+	jso_builder_object_add_object_start(&builder, "^a\\.b");
+	jso_builder_object_add_cstr(&builder, "type", "integer");
+	jso_builder_object_end(&builder);
+	// quantified character is not in prefix
+	jso_builder_object_add_object_start(&builder, "^xy?z");
+	jso_builder_object_add_cstr(&builder, "type", "boolean");
+	jso_builder_object_end(&builder);
+	// alternation without anchor in the second branch
+	jso_builder_object_add_object_start(&builder, "^foo|bar");
+	jso_builder_object_add_cstr(&builder, "type", "null");
+	jso_builder_object_end(&builder);
+	// not anchored pattern
+	jso_builder_object_add_object_start(&builder, "_id$");
+	jso_builder_object_add_cstr(&builder, "type", "integer");
+	jso_builder_object_end(&builder);
+	// end pattern properties
+	jso_builder_object_end(&builder);
+	jso_builder_object_add_bool(&builder, "additionalProperties", false);
+	// end items and root object
+	jso_builder_object_end(&builder);
+	jso_builder_object_end(&builder);
+
+	jso_schema schema;
+	jso_schema_init(&schema);
+	assert_jso_schema_result_success(jso_schema_parse(&schema, jso_builder_get_value(&builder)));
+	jso_builder_clear_all(&builder);
+
+	// the same keys are repeated in items
+	jso_builder_array_start(&builder);
+	for (int i = 0; i < 2; i++) {
+		jso_builder_array_add_object_start(&builder);
+		jso_builder_object_add_cstr(&builder, "S_name", "Pennsylvania");
+		jso_builder_object_add_int(&builder, "a.bc", 1);
+		jso_builder_object_add_bool(&builder, "xz", true);
+		jso_builder_object_add_bool(&builder, "xyz", false);
+		jso_builder_object_add_null(&builder, "foo1");
+		jso_builder_object_add_null(&builder, "abar");
+		jso_builder_object_add_int(&builder, "user_id", 5);
+		jso_builder_object_end(&builder);
+	}
+	assert_jso_schema_validation_success(
+			jso_schema_validate(&schema, jso_builder_get_value(&builder)));
+	jso_builder_clear_all(&builder);
+
+	// the memoized key is still validated
+	jso_builder_array_start(&builder);
+	jso_builder_array_add_object_start(&builder);
+	jso_builder_object_add_cstr(&builder, "S_name", "Pennsylvania");
+	jso_builder_object_end(&builder);
+	jso_builder_array_add_object_start(&builder);
+	jso_builder_object_add_int(&builder, "S_name", 1);
+	jso_builder_object_end(&builder);
+	assert_jso_schema_validation_failure(
+			jso_schema_validate(&schema, jso_builder_get_value(&builder)));
+	jso_builder_clear_all(&builder);
+
+	// the escaped dot does not match any character
+	jso_builder_array_start(&builder);
+	jso_builder_array_add_object_start(&builder);
+	jso_builder_object_add_int(&builder, "aXbc", 1);
+	jso_builder_object_end(&builder);
+	assert_jso_schema_validation_failure(
+			jso_schema_validate(&schema, jso_builder_get_value(&builder)));
+	jso_builder_clear_all(&builder);
+
+	// all matching patterns are applied
+	jso_builder_array_start(&builder);
+	jso_builder_array_add_object_start(&builder);
+	jso_builder_object_add_cstr(&builder, "S_id", "Pennsylvania");
+	jso_builder_object_end(&builder);
+	assert_jso_schema_validation_failure(
+			jso_schema_validate(&schema, jso_builder_get_value(&builder)));
+	jso_builder_clear_all(&builder);
+
+	jso_builder_array_start(&builder);
+	jso_builder_array_add_object_start(&builder);
+	jso_builder_object_add_bool(&builder, "xyyz", true);
+	jso_builder_object_end(&builder);
+	assert_jso_schema_validation_failure(
+			jso_schema_validate(&schema, jso_builder_get_value(&builder)));
+	jso_builder_clear_all(&builder);
+
+	jso_schema_clear(&schema);
+}
+
 /* A test for an object type with additional properties with false value. */
 static void test_jso_schema_object_additional_props_false(void **state)
 {
@@ -2569,12 +2778,150 @@ static void test_jso_schema_refs_with_defs(void **state)
 	jso_schema_clear(&schema);
 }
 
+/* A test for the instance path of the validation error. */
+static void test_jso_schema_error_path(void **state)
+{
+	(void) state; /* unused */
+
+	const char *schema_json = "{\"type\":\"object\",\"properties\":{"
+							  "\"list\":{\"type\":\"array\",\"items\":{\"type\":\"object\","
+							  "\"properties\":{\"a/b\":{\"type\":\"string\"}}}},"
+							  "\"n\":{\"allOf\":[{\"minimum\":0}]}}}";
+	struct {
+		const char *json;
+		const char *path;
+	} instances[] = {
+		{ "{\"list\":[{\"a/b\":\"x\"},{\"a/b\":1}]}", "/list/1/a~1b" },
+		{ "{\"list\":{}}", "/list" },
+		{ "{\"n\":-1}", "/n" },
+		{ "\"x\"", "" },
+	};
+	jso_parser_options parser_options = { .max_depth = 100 };
+	jso_schema_options options;
+	jso_value schema_data, instance;
+	jso_schema schema;
+
+	assert_int_equal(JSO_SUCCESS,
+			jso_parse_cstr(schema_json, strlen(schema_json), &parser_options, &schema_data));
+	jso_schema_options_init(&options);
+	options.default_version = JSO_SCHEMA_VERSION_DRAFT_06;
+	jso_schema_init(&schema);
+	assert_int_equal(JSO_SUCCESS, jso_schema_parse_ex(&schema, &schema_data, &options));
+
+	for (size_t i = 0; i < sizeof(instances) / sizeof(instances[0]); i++) {
+		assert_int_equal(JSO_SUCCESS,
+				jso_parse_cstr(instances[i].json, strlen(instances[i].json), &parser_options,
+						&instance));
+		assert_int_equal(JSO_SCHEMA_VALIDATION_INVALID, jso_schema_validate(&schema, &instance));
+		jso_value_clear(&instance);
+		/* the path is copied so it stays valid after the instance is freed */
+		assert_string_equal(instances[i].path, JSO_SCHEMA_ERROR_PATH(&schema));
+	}
+
+	jso_schema_clear(&schema);
+	jso_value_clear(&schema_data);
+}
+
+/* A test for the compiled schema validating the same way as the interpreted schema. */
+static void test_jso_schema_compiled_same_as_interpreted(void **state)
+{
+	(void) state; /* unused */
+
+	const char *schema_json = "{\"type\":\"object\",\"required\":[\"id\",\"tags\"],"
+							  "\"properties\":{"
+							  "\"id\":{\"$ref\":\"#/definitions/id\"},"
+							  "\"score\":{\"type\":\"number\",\"minimum\":0,"
+							  "\"exclusiveMaximum\":10,\"multipleOf\":2},"
+							  "\"name\":{\"type\":\"string\",\"minLength\":2,\"maxLength\":8,"
+							  "\"pattern\":\"^[a-z]+$\"},"
+							  "\"tags\":{\"type\":\"array\",\"minItems\":1,\"uniqueItems\":true,"
+							  "\"contains\":{\"const\":\"main\"}},"
+							  "\"kind\":{\"enum\":[\"a\",\"b\",1]}},"
+							  "\"definitions\":{"
+							  "\"id\":{\"$ref\":\"#/definitions/positive\"},"
+							  "\"positive\":{\"type\":\"integer\",\"exclusiveMinimum\":0,"
+							  "\"maximum\":1000}}}";
+	struct {
+		const char *json;
+		jso_bool valid;
+	} instances[] = {
+		{ "{\"id\":5,\"tags\":[\"main\"]}", true },
+		{ "{\"id\":0,\"tags\":[\"main\"]}", false },
+		{ "{\"id\":1001,\"tags\":[\"main\"]}", false },
+		{ "{\"id\":2.5,\"tags\":[\"main\"]}", false },
+		{ "{\"id\":\"5\",\"tags\":[\"main\"]}", false },
+		{ "{\"id\":1,\"tags\":[]}", false },
+		{ "{\"id\":1,\"tags\":[\"main\",\"main\"]}", false },
+		{ "{\"id\":1,\"tags\":[\"other\"]}", false },
+		{ "{\"id\":1}", false },
+		{ "{\"id\":1,\"tags\":[\"main\"],\"score\":8,\"name\":\"abc\"}", true },
+		{ "{\"id\":1,\"tags\":[\"main\"],\"score\":10,\"name\":\"abc\"}", false },
+		{ "{\"id\":1,\"tags\":[\"main\"],\"score\":3,\"name\":\"abc\"}", false },
+		{ "{\"id\":1,\"tags\":[\"main\"],\"name\":\"A1\"}", false },
+		{ "{\"id\":1,\"tags\":[\"main\"],\"name\":\"a\"}", false },
+		{ "{\"id\":1,\"tags\":[\"main\"],\"name\":\"abcdefghij\"}", false },
+		{ "{\"id\":1,\"tags\":[\"main\"],\"kind\":\"c\"}", false },
+		{ "{\"id\":1,\"tags\":[\"main\"],\"kind\":1}", true },
+		{ "5", false },
+	};
+	jso_parser_options parser_options = { .max_depth = 100 };
+	jso_schema_options options;
+	jso_value schema_data, instance;
+	jso_schema compiled, interpreted;
+	jso_value *id_value;
+
+	assert_int_equal(JSO_SUCCESS,
+			jso_parse_cstr(schema_json, strlen(schema_json), &parser_options, &schema_data));
+
+	jso_schema_options_init(&options);
+	options.default_version = JSO_SCHEMA_VERSION_DRAFT_06;
+	jso_schema_init(&compiled);
+	assert_int_equal(JSO_SUCCESS, jso_schema_parse_ex(&compiled, &schema_data, &options));
+	options.skip_compile = true;
+	jso_schema_init(&interpreted);
+	assert_int_equal(JSO_SUCCESS, jso_schema_parse_ex(&interpreted, &schema_data, &options));
+
+	assert_non_null(compiled.root->program);
+	assert_null(interpreted.root->program);
+
+	// the reference only property jumps to the final target of the references chain
+	jso_object *props = JSO_SCHEMA_KEYWORD_DATA_OBJ_SCHEMA_OBJ(
+			JSO_SCHEMA_VALUE_DATA_OBJ_P(compiled.root)->properties);
+	assert_int_equal(JSO_SUCCESS, jso_object_get_by_cstr_key(props, "id", 2, &id_value));
+	assert_int_equal(JSO_SCHEMA_VALUE_TYPE_INTEGER,
+			JSO_SCHEMA_VALUE_TYPE_P(jso_schema_program_target(JSO_SVVAL_P(id_value))));
+
+	for (size_t i = 0; i < sizeof(instances) / sizeof(instances[0]); i++) {
+		assert_int_equal(JSO_SUCCESS,
+				jso_parse_cstr(instances[i].json, strlen(instances[i].json), &parser_options,
+						&instance));
+		jso_schema_validation_result compiled_result = jso_schema_validate(&compiled, &instance);
+		jso_schema_validation_result interpreted_result
+				= jso_schema_validate(&interpreted, &instance);
+		jso_schema_validation_result expected = instances[i].valid
+				? JSO_SCHEMA_VALIDATION_VALID
+				: JSO_SCHEMA_VALIDATION_INVALID;
+		assert_int_equal(expected, compiled_result);
+		assert_int_equal(interpreted_result, compiled_result);
+		assert_int_equal(interpreted.error.code, compiled.error.code);
+		assert_int_equal(JSO_SCHEMA_ERROR_TYPE(&interpreted), JSO_SCHEMA_ERROR_TYPE(&compiled));
+		jso_schema_clear_error(&compiled);
+		jso_schema_clear_error(&interpreted);
+		jso_value_free(&instance);
+	}
+
+	jso_schema_clear(&compiled);
+	jso_schema_clear(&interpreted);
+	jso_value_free(&schema_data);
+}
+
 int main(void)
 {
 	const struct CMUnitTest tests[] = {
 		cmocka_unit_test(test_jso_schema_boolean),
 		cmocka_unit_test(test_jso_schema_string_with_lengths),
 		cmocka_unit_test(test_jso_schema_string_with_pattern),
+		cmocka_unit_test(test_jso_schema_string_with_pattern_long_subject),
 		cmocka_unit_test(test_jso_schema_integer),
 		cmocka_unit_test(test_jso_schema_integer_range_simple),
 		cmocka_unit_test(test_jso_schema_integer_range_exclusive),
@@ -2585,6 +2932,8 @@ int main(void)
 		cmocka_unit_test(test_jso_schema_object_props),
 		cmocka_unit_test(test_jso_schema_object_props_bool),
 		cmocka_unit_test(test_jso_schema_object_pattern_props),
+		cmocka_unit_test(test_jso_schema_object_pattern_props_long_key),
+		cmocka_unit_test(test_jso_schema_object_pattern_props_prefixes),
 		cmocka_unit_test(test_jso_schema_object_additional_props_false),
 		cmocka_unit_test(test_jso_schema_object_additional_props_type),
 		cmocka_unit_test(test_jso_schema_object_all_props_non_overlap),
@@ -2617,6 +2966,8 @@ int main(void)
 		cmocka_unit_test(test_jso_schema_root_true),
 		cmocka_unit_test(test_jso_schema_root_false),
 		cmocka_unit_test(test_jso_schema_refs_with_defs),
+		cmocka_unit_test(test_jso_schema_error_path),
+		cmocka_unit_test(test_jso_schema_compiled_same_as_interpreted),
 	};
 
 	return cmocka_run_group_tests(tests, NULL, NULL);
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include "../../src/jso.h"
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+/* A test case that allocates memory from arena. */
+static void test_jso_arena_malloc(void **state)
+{
+	(void) state; /* unused */
+
+	jso_arena *arena = jso_arena_alloc(128);
+
+	char *p1 = jso_arena_malloc(arena, 3);
+	char *p2 = jso_arena_malloc(arena, 10);
+	char *p3 = jso_arena_malloc(arena, 8);
+	assert_non_null(p1);
+	assert_non_null(p2);
+	assert_non_null(p3);
+	assert_int_equal(0, (uintptr_t) p1 % JSO_ARENA_ALIGNMENT);
+	assert_ptr_equal(p1 + 8, p2);
+	assert_ptr_equal(p2 + 16, p3);
+	memcpy(p1, "ab", 3);
+	memcpy(p2, "abcdefghi", 10);
+
+	/* new block is allocated when the current one is full */
+	assert_non_null(jso_arena_malloc(arena, 64));
+	assert_null(arena->block->prev);
+	char *p4 = jso_arena_malloc(arena, 48);
+	assert_non_null(p4);
+	assert_non_null(arena->block->prev);
+	assert_string_equal("ab", p1);
+	assert_string_equal("abcdefghi", p2);
+
+	/* big allocations get their own block and the current block is still used */
+	jso_arena_block *block = arena->block;
+	char *p5 = jso_arena_malloc(arena, 1024);
+	assert_non_null(p5);
+	assert_ptr_equal(block, arena->block);
+	memset(p5, 'x', 1024);
+
+	jso_arena_free(arena);
+}
+
+/* A test case that reallocates memory from arena. */
+static void test_jso_arena_realloc(void **state)
+{
+	(void) state; /* unused */
+
+	jso_arena *arena = jso_arena_alloc(128);
+
+	/* the last allocation is extended in place */
+	char *p1 = jso_arena_realloc(arena, NULL, 8);
+	memcpy(p1, "abcdefg", 8);
+	char *p2 = jso_arena_realloc(arena, p1, 32);
+	assert_ptr_equal(p1, p2);
+	assert_string_equal("abcdefg", p2);
+
+	/* other allocations are copied */
+	char *p3 = jso_arena_malloc(arena, 8);
+	char *p4 = jso_arena_realloc(arena, p2, 48);
+	assert_ptr_not_equal(p2, p4);
+	assert_ptr_not_equal(p3, p4);
+	assert_string_equal("abcdefg", p4);
+
+	/* copying to the new block */
+	char *p5 = jso_arena_realloc(arena, p4, 96);
+	assert_ptr_not_equal(p4, p5);
+	assert_string_equal("abcdefg", p5);
+
+	jso_arena_free(arena);
+}
+
+/* A test case that uses arena as an allocator. */
+static void test_jso_arena_allocator(void **state)
+{
+	(void) state; /* unused */
+
+	jso_value val, *pval;
+	jso_arena *arena = jso_arena_alloc(0);
+
+	const jso_allocator *previous = jso_arena_enter(arena);
+	assert_ptr_equal(jso_arena_get_allocator(arena), jso_mm_get_allocator());
+	jso_array *arr = jso_array_alloc();
+	for (jso_int i = 0; i < 100; i++) {
+		JSO_VALUE_SET_INT(val, i);
+		assert_int_equal(JSO_SUCCESS, jso_array_append(arr, &val));
+	}
+	jso_array_free(arr);
+	jso_arena_leave(previous);
+	assert_ptr_equal(jso_mm_get_default_allocator(), jso_mm_get_allocator());
+
+	assert_int_equal(100, JSO_ARRAY_LEN(arr));
+	assert_int_equal(JSO_SUCCESS, jso_array_index(arr, 99, &pval));
+	assert_int_equal(99, JSO_IVAL_P(pval));
+
+	jso_arena_free(arena);
+}
+
+/* A test case that clears arena. */
+static void test_jso_arena_clear(void **state)
+{
+	(void) state; /* unused */
+
+	jso_arena *arena = jso_arena_alloc(64);
+
+	char *p1 = jso_arena_malloc(arena, 16);
+	jso_arena_block *first = arena->block;
+	for (int i = 0; i < 10; i++) {
+		assert_non_null(jso_arena_malloc(arena, 24));
+	}
+	assert_ptr_not_equal(first, arena->block);
+
+	jso_arena_clear(arena);
+	assert_ptr_equal(first, arena->block);
+	assert_null(arena->block->prev);
+	assert_ptr_equal(p1, jso_arena_malloc(arena, 16));
+
+	jso_arena_free(arena);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_jso_arena_malloc),
+		cmocka_unit_test(test_jso_arena_realloc),
+		cmocka_unit_test(test_jso_arena_allocator),
+		cmocka_unit_test(test_jso_arena_clear),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -136,6 +136,67 @@ static void test_jso_array_index(void **state)
 	jso_array_free(arr);
 }
 
+/* A test case for array reserve. */
+static void test_jso_array_reserve(void **state)
+{
+	(void) state; /* unused */
+
+	jso_value val1, val2, *val;
+	JSO_VALUE_SET_INT(val1, 1);
+	JSO_VALUE_SET_INT(val2, 2);
+
+	jso_array *arr = jso_array_alloc();
+	assert_int_equal(0, JSO_ARRAY_CAPACITY(arr));
+
+	assert_int_equal(JSO_SUCCESS, jso_array_reserve(arr, 100));
+	assert_int_equal(100, JSO_ARRAY_CAPACITY(arr));
+	assert_int_equal(0, JSO_ARRAY_LEN(arr));
+
+	jso_array_append(arr, &val1);
+	jso_array_append(arr, &val2);
+
+	/* reserve never shrinks */
+	assert_int_equal(JSO_SUCCESS, jso_array_reserve(arr, 1));
+	assert_int_equal(100, JSO_ARRAY_CAPACITY(arr));
+	assert_int_equal(2, JSO_ARRAY_LEN(arr));
+
+	assert_int_equal(JSO_SUCCESS, jso_array_index(arr, 1, &val));
+	assert_int_equal(2, JSO_IVAL_P(val));
+
+	jso_array_free(arr);
+}
+
+/* A test case for growing and indexing large array. */
+static void test_jso_array_grow(void **state)
+{
+	(void) state; /* unused */
+
+	jso_value tmp, *val;
+	jso_int i;
+
+	jso_array *arr = jso_array_alloc();
+	for (i = 0; i < 100000; i++) {
+		JSO_VALUE_SET_INT(tmp, i);
+		assert_int_equal(JSO_SUCCESS, jso_array_append(arr, &tmp));
+	}
+	assert_int_equal(100000, JSO_ARRAY_LEN(arr));
+	assert_true(JSO_ARRAY_CAPACITY(arr) >= 100000);
+
+	assert_int_equal(JSO_SUCCESS, jso_array_index(arr, 98000, &val));
+	assert_int_equal(98000, JSO_IVAL_P(val));
+	assert_int_equal(JSO_FAILURE, jso_array_index(arr, 100000, &val));
+
+	i = 0;
+	JSO_ARRAY_FOREACH(arr, val)
+	{
+		assert_int_equal(i++, JSO_IVAL_P(val));
+	}
+	JSO_ARRAY_FOREACH_END;
+	assert_int_equal(100000, i);
+
+	jso_array_free(arr);
+}
+
 /* A test case that tests applying function for all array items. */
 static void jso_test_array_apply_callback(size_t idx, jso_value *val)
 {
@@ -277,6 +338,67 @@ static void test_jso_array_is_unique(void **state)
 	jso_array_free(arr);
 }
 
+/* Create object with two members added in the supplied order. */
+static jso_object *jso_array_test_create_object(jso_int ival, const char *sval, bool reversed)
+{
+	jso_value val1, val2;
+	JSO_VALUE_SET_INT(val1, ival);
+	JSO_VALUE_SET_STRING(val2, jso_string_create_from_cstr(sval));
+
+	jso_object *obj = jso_object_alloc();
+	if (reversed) {
+		jso_object_add(obj, jso_string_create_from_cstr("name"), &val2);
+		jso_object_add(obj, jso_string_create_from_cstr("id"), &val1);
+	} else {
+		jso_object_add(obj, jso_string_create_from_cstr("id"), &val1);
+		jso_object_add(obj, jso_string_create_from_cstr("name"), &val2);
+	}
+
+	return obj;
+}
+
+/* A test to check uniqueness of larger arrays that uses hash set */
+static void test_jso_array_is_unique_hashed(void **state)
+{
+	(void) state; /* unused */
+
+	jso_value val, *item;
+	jso_array *arr = jso_array_alloc();
+	for (jso_int i = 0; i < 1000; i++) {
+		JSO_VALUE_SET_OBJECT(val, jso_array_test_create_object(i, "item", false));
+		jso_array_append(arr, &val);
+	}
+	assert_true(jso_array_is_unique(arr));
+
+	/* same members in a different order */
+	JSO_VALUE_SET_OBJECT(val, jso_array_test_create_object(500, "item", true));
+	assert_int_equal(JSO_SUCCESS, jso_array_index(arr, 500, &item));
+	assert_int_equal(jso_value_hash(item), jso_value_hash(&val));
+	jso_array_append(arr, &val);
+	assert_false(jso_array_is_unique(arr));
+
+	jso_array_free(arr);
+
+	arr = jso_array_alloc();
+	for (jso_int i = 0; i < 100; i++) {
+		JSO_VALUE_SET_INT(val, i);
+		jso_array_append(arr, &val);
+	}
+	/* integer and double are different types */
+	JSO_VALUE_SET_DOUBLE(val, 1.0);
+	jso_array_append(arr, &val);
+	JSO_VALUE_SET_DOUBLE(val, 0.0);
+	jso_array_append(arr, &val);
+	assert_true(jso_array_is_unique(arr));
+
+	/* negative zero is equal to zero */
+	JSO_VALUE_SET_DOUBLE(val, -0.0);
+	jso_array_append(arr, &val);
+	assert_false(jso_array_is_unique(arr));
+
+	jso_array_free(arr);
+}
+
 /* A test to check whether array copying works by increasing reference */
 static void test_jso_array_copy(void **state)
 {
@@ -311,11 +433,14 @@ int main(void)
 		cmocka_unit_test(test_jso_array_push),
 		cmocka_unit_test(test_jso_array_pop),
 		cmocka_unit_test(test_jso_array_index),
+		cmocka_unit_test(test_jso_array_reserve),
+		cmocka_unit_test(test_jso_array_grow),
 		cmocka_unit_test(test_jso_array_apply),
 		cmocka_unit_test(test_jso_array_apply_with_args),
 		cmocka_unit_test(test_jso_array_equals),
 		cmocka_unit_test(test_jso_array_are_all_items_of_type),
 		cmocka_unit_test(test_jso_array_is_unique),
+		cmocka_unit_test(test_jso_array_is_unique_hashed),
 		cmocka_unit_test(test_jso_array_copy),
 	};
 
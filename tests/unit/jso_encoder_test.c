@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "../../src/jso.h"
+#include "../../src/jso_encoder.h"
+#include "../../src/jso_parser.h"
+#include "../../src/io/jso_io_file.h"
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+/* encode the value to a temporary file and return the allocated output */
+static char *jso_test_encoder_encode(jso_value *val, jso_encoder_options *options)
+{
+	FILE *fp = tmpfile();
+	assert_non_null(fp);
+	jso_io *io = jso_io_file_open_stream(fp);
+	assert_non_null(io);
+	assert_int_equal(JSO_SUCCESS, jso_encode(val, io, options));
+
+	long size = ftell(fp);
+	assert_true(size >= 0);
+	char *output = malloc((size_t) size + 1);
+	rewind(fp);
+	assert_int_equal((size_t) size, fread(output, 1, (size_t) size, fp));
+	output[size] = '\0';
+
+	JSO_IO_FREE(io);
+
+	return output;
+}
+
+/* parse the JSON, encode it back and check the output */
+static void jso_test_encoder_check(
+		const char *json, const char *expected, jso_encoder_options *options)
+{
+	jso_parser_options parser_options = { .max_depth = 1000 };
+	jso_value val;
+
+	assert_int_equal(JSO_SUCCESS, jso_parse_cstr(json, strlen(json), &parser_options, &val));
+	char *output = jso_test_encoder_encode(&val, options);
+	assert_string_equal(expected, output);
+	free(output);
+	jso_value_clear(&val);
+}
+
+/* A test case that checks encoding of all types. */
+static void test_jso_encoder_encode_types(void **state)
+{
+	(void) state; /* unused */
+
+	jso_encoder_options options = { .max_depth = JSO_ENCODER_DEPTH_UNLIMITED };
+
+	jso_test_encoder_check("null", "null", &options);
+	jso_test_encoder_check("[true,false,-12,0.1,1.5e300]", "[true,false,-12,0.1,1.5e+300]",
+			&options);
+	jso_test_encoder_check("{\"a\":{\"b\":[]},\"c\":\"d\"}", "{\"a\":{\"b\":[]},\"c\":\"d\"}",
+			&options);
+
+	options.pretty = true;
+	jso_test_encoder_check("{\"a\":[1,{}]}", "{\n    \"a\": [\n        1,\n        {}\n    ]\n}",
+			&options);
+}
+
+/* A test case that checks the double formatting modes. */
+static void test_jso_encoder_encode_double_mode(void **state)
+{
+	(void) state; /* unused */
+
+	jso_encoder_options options = { .max_depth = JSO_ENCODER_DEPTH_UNLIMITED };
+
+	options.double_mode = JSO_ENCODER_DOUBLE_MODE_SHORTEST;
+	jso_test_encoder_check("[48.23,1e-7]", "[48.23,1e-7]", &options);
+	options.double_mode = JSO_ENCODER_DOUBLE_MODE_PRECISION;
+	options.double_precision = 3;
+	jso_test_encoder_check("[48.23,1e-7]", "[48.2,1e-7]", &options);
+	options.double_mode = JSO_ENCODER_DOUBLE_MODE_LEGACY;
+	jso_test_encoder_check("[48.23,1e-7]", "[48.229999999999997,9.9999999999999995e-08]", &options);
+}
+
+/* A test case that checks escaping of strings. */
+static void test_jso_encoder_encode_string_escape(void **state)
+{
+	(void) state; /* unused */
+
+	jso_encoder_options options = { .max_depth = JSO_ENCODER_DEPTH_UNLIMITED };
+
+	jso_test_encoder_check("\"a\\\"b\\\\c/d\\b\\f\\n\\r\\t\\u0001\\u001fé\"",
+			"\"a\\\"b\\\\c\\/d\\b\\f\\n\\r\\t\\u0001\\u001fé\"", &options);
+	jso_test_encoder_check("\"\\u00e9\\u4e2d\"", "\"é中\"", &options);
+}
+
+/* A test case that checks the output that is bigger than the encoder buffer. */
+static void test_jso_encoder_encode_big(void **state)
+{
+	(void) state; /* unused */
+
+	jso_encoder_options options = { .max_depth = JSO_ENCODER_DEPTH_UNLIMITED };
+	size_t count = 3 * JSO_ENCODER_BUFFER_SIZE / 7;
+	size_t len = 2 + count * 8 + 1;
+	char *json = malloc(len), *expected = malloc(len + count), *p = json, *e = expected;
+
+	/* many small values where the buffer is flushed at all positions */
+	*p++ = '[';
+	*e++ = '[';
+	for (size_t i = 0; i < count; i++) {
+		memcpy(p, i ? ",\"a/bc\"" : "\"a/bcd\"", 7);
+		memcpy(e, i ? ",\"a\\/bc\"" : "\"a\\/bcd\"", 8);
+		p += 7;
+		e += 8;
+	}
+	*p++ = ']';
+	*e++ = ']';
+	*p = '\0';
+	*e = '\0';
+	jso_test_encoder_check(json, expected, &options);
+
+	/* a single string that is bigger than the buffer */
+	p = json;
+	e = expected;
+	*p++ = '"';
+	*e++ = '"';
+	for (size_t i = 0; i < 7 * count; i++) {
+		*p++ = i % 1000 == 999 ? '/' : 'x';
+		if (i % 1000 == 999) {
+			*e++ = '\\';
+		}
+		*e++ = i % 1000 == 999 ? '/' : 'x';
+	}
+	*p++ = '"';
+	*e++ = '"';
+	*p = '\0';
+	*e = '\0';
+	jso_test_encoder_check(json, expected, &options);
+
+	free(json);
+	free(expected);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_jso_encoder_encode_types),
+		cmocka_unit_test(test_jso_encoder_encode_double_mode),
+		cmocka_unit_test(test_jso_encoder_encode_string_escape),
+		cmocka_unit_test(test_jso_encoder_encode_big),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -87,6 +87,43 @@ static void test_jso_ht_set(void **state)
 	jso_string_free(key4);
 }
 
+/* A test case that adds item to hash table only if its key does not exist. */
+static void test_jso_ht_add_new(void **state)
+{
+	(void) state; /* unused */
+
+	jso_value val1, val2, val3, *val;
+	JSO_VALUE_SET_INT(val1, 1);
+	JSO_VALUE_SET_INT(val2, 2);
+	JSO_VALUE_SET_INT(val3, 3);
+
+	jso_string *key1 = jso_string_create_from_cstr("key");
+	jso_string *key2 = jso_string_create_from_cstr("second key");
+	jso_string *key3 = jso_string_create_from_cstr("key");
+
+	jso_ht *ht = jso_ht_alloc();
+
+	assert_int_equal(JSO_SUCCESS, jso_ht_add_new(ht, key1, &val1, &val));
+	assert_null(val);
+	assert_int_equal(JSO_SUCCESS, jso_ht_add_new(ht, key2, &val2, &val));
+	assert_null(val);
+	assert_int_equal(JSO_SUCCESS, jso_ht_add_new(ht, key3, &val3, &val));
+	assert_non_null(val);
+	assert_int_equal(1, JSO_IVAL_P(val));
+
+	/* the existing value can be updated in place */
+	JSO_VALUE_SET_INT(*val, 4);
+	assert_int_equal(2, ht->count);
+	assert_int_equal(JSO_SUCCESS, jso_ht_get(ht, key3, &val));
+	assert_int_equal(4, JSO_IVAL_P(val));
+
+	jso_ht_free(ht);
+
+	// check the key3 is not owned by the hash table
+	assert_true(jso_string_equals_to_cstr(key3, "key"));
+	jso_string_free(key3);
+}
+
 /* A test case that gets item from hash table. */
 static void test_jso_ht_get(void **state)
 {
@@ -304,16 +341,115 @@ static void test_jso_ht_resize(void **state)
 	jso_ht_free(ht);
 }
 
+/* A test case that removes items from hash table. */
+static void test_jso_ht_remove(void **state)
+{
+	(void) state; /* unused */
+
+	jso_value val1, val2, val3, val4, *val = NULL;
+	JSO_VALUE_SET_INT(val1, 1);
+	JSO_VALUE_SET_INT(val2, 2);
+	JSO_VALUE_SET_INT(val3, 3);
+	JSO_VALUE_SET_INT(val4, 4);
+
+	jso_string *key1 = jso_string_create_from_cstr("key");
+	jso_string *key2 = jso_string_create_from_cstr("second key");
+	jso_string *key3 = jso_string_create_from_cstr("third key");
+	jso_string *key4 = jso_string_create_from_cstr("second key");
+	jso_string *rkey = jso_string_create_from_cstr("second key");
+
+	jso_ht *ht = jso_ht_alloc();
+
+	// remove should fail on empty hash table
+	assert_true(jso_ht_remove(ht, rkey) == JSO_FAILURE);
+
+	jso_ht_set(ht, key1, &val1, false);
+	jso_ht_set(ht, key2, &val2, false);
+	jso_ht_set(ht, key3, &val3, false);
+
+	assert_true(jso_ht_remove(ht, rkey) == JSO_SUCCESS);
+	assert_int_equal(2, ht->count);
+	assert_false(jso_ht_has(ht, rkey));
+	assert_true(jso_ht_remove(ht, rkey) == JSO_FAILURE);
+	// lookup after the tombstone must still find the key
+	assert_true(jso_ht_get_by_cstr_key(ht, "third key", &val) == JSO_SUCCESS);
+	assert_int_equal(3, JSO_IVAL_P(val));
+
+	// re-added key is appended to the end
+	jso_ht_set(ht, key4, &val4, false);
+	assert_int_equal(3, ht->count);
+
+	jso_int i = 1;
+	jso_string *key;
+	JSO_HT_FOREACH(ht, key, val)
+	{
+		switch (i++) {
+			case 1:
+				assert_true(jso_string_equals_to_cstr(key, "key"));
+				assert_int_equal(1, JSO_IVAL_P(val));
+				break;
+			case 2:
+				assert_true(jso_string_equals_to_cstr(key, "third key"));
+				assert_int_equal(3, JSO_IVAL_P(val));
+				break;
+			case 3:
+				assert_true(jso_string_equals_to_cstr(key, "second key"));
+				assert_int_equal(4, JSO_IVAL_P(val));
+				break;
+		}
+	}
+	JSO_HT_FOREACH_END;
+	assert_int_equal(4, i);
+
+	// remove the first and the last entry
+	assert_true(jso_ht_remove(ht, rkey) == JSO_SUCCESS);
+	jso_string_free(rkey);
+	rkey = jso_string_create_from_cstr("key");
+	assert_true(jso_ht_remove(ht, rkey) == JSO_SUCCESS);
+	assert_int_equal(1, ht->count);
+	assert_int_equal(3, ht->tombstones);
+	i = 0;
+	JSO_HT_FOREACH(ht, key, val)
+	{
+		assert_true(jso_string_equals_to_cstr(key, "third key"));
+		i++;
+	}
+	JSO_HT_FOREACH_END;
+	assert_int_equal(1, i);
+
+	// repeated inserts and removes purge tombstones without growing
+	size_t capacity = ht->capacity;
+	for (jso_int j = 0; j < 100; j++) {
+		jso_value jval;
+		char buf[16];
+		JSO_VALUE_SET_INT(jval, j);
+		snprintf(buf, sizeof(buf), "k%d", (int) j);
+		jso_string *jkey = jso_string_create_from_cstr(buf);
+		assert_true(jso_ht_set(ht, jkey, &jval, false) == JSO_SUCCESS);
+		assert_true(jso_ht_has(ht, jkey));
+		assert_true(jso_ht_remove(ht, jkey) == JSO_SUCCESS);
+	}
+	assert_int_equal(1, ht->count);
+	assert_int_equal(capacity, ht->capacity);
+	assert_true(jso_ht_get_by_cstr_key(ht, "third key", &val) == JSO_SUCCESS);
+	assert_int_equal(3, JSO_IVAL_P(val));
+
+	jso_ht_free(ht);
+	jso_string_free(rkey);
+}
+
 int main(void)
 {
 	// clang-format off
 	const struct CMUnitTest tests[] = {
 		cmocka_unit_test(test_jso_ht_set),
+		cmocka_unit_test(test_jso_ht_add_new),
 		cmocka_unit_test(test_jso_ht_get),
 		cmocka_unit_test(test_jso_ht_get_by_cstr_key),
 		cmocka_unit_test(test_jso_ht_has),
 		cmocka_unit_test(test_jso_ht_clone),
 		cmocka_unit_test(test_jso_ht_resize),
+		cmocka_unit_test(test_jso_ht_remove),
 	};
 	// clang-format on
 
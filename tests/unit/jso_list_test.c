@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "../../src/jso.h"
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+/* A test case that tests appending list item. */
+static void test_jso_list_append(void **state)
+{
+	(void) state; /* unused */
+
+	jso_value val1, val2, val3, *val;
+	JSO_VALUE_SET_INT(val1, 1);
+	JSO_VALUE_SET_INT(val2, 2);
+	JSO_VALUE_SET_INT(val3, 3);
+
+	jso_list *list = jso_list_alloc();
+	jso_list_append(list, &val1);
+	jso_list_append(list, &val2);
+	jso_list_append(list, &val3);
+
+	jso_int i = 1;
+	JSO_LIST_FOREACH(list, val)
+	{
+		assert_int_equal(i++, JSO_IVAL_P(val));
+	}
+	JSO_LIST_FOREACH_END;
+
+	jso_list_free(list);
+}
+
+/* A test case that tests pushing list item. */
+static void test_jso_list_push(void **state)
+{
+	(void) state; /* unused */
+
+	jso_value val1, val2, val3, *val;
+	JSO_VALUE_SET_INT(val1, 1);
+	JSO_VALUE_SET_INT(val2, 2);
+	JSO_VALUE_SET_INT(val3, 3);
+
+	jso_list *list = jso_list_alloc();
+	jso_list_push(list, &val1);
+	jso_list_push(list, &val2);
+	jso_list_push(list, &val3);
+
+	jso_int i = 3;
+	JSO_LIST_FOREACH(list, val)
+	{
+		assert_int_equal(i--, JSO_IVAL_P(val));
+	}
+	JSO_LIST_FOREACH_END;
+
+	jso_list_free(list);
+}
+
+/* A test case that tests poping list item. */
+static void test_jso_list_pop(void **state)
+{
+	(void) state; /* unused */
+
+	jso_value val1, val2, val3, *val;
+	JSO_VALUE_SET_INT(val1, 1);
+	JSO_VALUE_SET_INT(val2, 2);
+	JSO_VALUE_SET_INT(val3, 3);
+
+	jso_list *list = jso_list_alloc();
+	jso_list_push(list, &val1);
+	jso_list_push(list, &val2);
+	jso_list_push(list, &val3);
+
+	jso_int i = 2;
+	jso_list_pop(list);
+	assert_int_equal(2, JSO_LIST_LEN(list));
+	JSO_LIST_FOREACH(list, val)
+	{
+		assert_int_equal(i--, JSO_IVAL_P(val));
+	}
+	JSO_LIST_FOREACH_END;
+
+	jso_list_free(list);
+}
+
+/* A test case for list index. */
+static void test_jso_list_index(void **state)
+{
+	(void) state; /* unused */
+
+	jso_value val1, val2, val3, *val;
+	JSO_VALUE_SET_INT(val1, 1);
+	JSO_VALUE_SET_INT(val2, 2);
+	JSO_VALUE_SET_INT(val3, 3);
+
+	jso_list *list = jso_list_alloc();
+	assert_int_equal(JSO_FAILURE, jso_list_index(list, 0, &val));
+
+	jso_list_append(list, &val1);
+	jso_list_append(list, &val2);
+	jso_list_append(list, &val3);
+
+	assert_int_equal(JSO_FAILURE, jso_list_index(list, 3, &val));
+	assert_int_equal(JSO_FAILURE, jso_list_index(list, 6, &val));
+
+	assert_int_equal(JSO_SUCCESS, jso_list_index(list, 0, &val));
+	assert_int_equal(1, JSO_IVAL_P(val));
+	assert_int_equal(JSO_SUCCESS, jso_list_index(list, 1, &val));
+	assert_int_equal(2, JSO_IVAL_P(val));
+	assert_int_equal(JSO_SUCCESS, jso_list_index(list, 2, &val));
+	assert_int_equal(3, JSO_IVAL_P(val));
+
+	jso_list_free(list);
+}
+
+/* A test case that tests applying function for all list items. */
+static void jso_test_list_apply_callback(size_t idx, jso_value *val)
+{
+	assert_int_equal(idx + 1, JSO_IVAL_P(val));
+}
+
+static void test_jso_list_apply(void **state)
+{
+	(void) state; /* unused */
+
+	jso_value val1, val2, val3;
+	JSO_VALUE_SET_INT(val1, 1);
+	JSO_VALUE_SET_INT(val2, 2);
+	JSO_VALUE_SET_INT(val3, 3);
+
+	jso_list *list = jso_list_alloc();
+	jso_list_append(list, &val1);
+	jso_list_append(list, &val2);
+	jso_list_append(list, &val3);
+
+	jso_list_apply(list, jso_test_list_apply_callback);
+
+	jso_list_free(list);
+}
+
+/* A test case that tests applying function with args for all list items. */
+static void jso_test_list_apply_with_args_callback(size_t idx, jso_value *val, void *arg)
+{
+	int *expected_val = (int *) arg;
+	assert_int_equal(*expected_val, JSO_IVAL_P(val));
+	*expected_val = *expected_val - 1;
+}
+
+static void test_jso_list_apply_with_args(void **state)
+{
+	(void) state; /* unused */
+
+	jso_value val1, val2, val3;
+	JSO_VALUE_SET_INT(val1, 1);
+	JSO_VALUE_SET_INT(val2, 2);
+	JSO_VALUE_SET_INT(val3, 3);
+
+	jso_list *list = jso_list_alloc();
+	jso_list_push(list, &val1);
+	jso_list_push(list, &val2);
+	jso_list_push(list, &val3);
+
+	jso_int i = 3;
+	jso_list_apply_with_arg(list, jso_test_list_apply_with_args_callback, &i);
+	assert_int_equal(0, i);
+
+	jso_list_free(list);
+}
+
+/* A test case that tests whether two list are equal. */
+static void test_jso_list_equals(void **state)
+{
+	(void) state; /* unused */
+
+	jso_value val11, val21, val31, val41, val12, val22, val32, val42;
+	JSO_VALUE_SET_INT(val11, 1);
+	JSO_VALUE_SET_INT(val21, 2);
+	JSO_VALUE_SET_INT(val31, 3);
+	JSO_VALUE_SET_INT(val41, 3);
+	JSO_VALUE_SET_INT(val12, 1);
+	JSO_VALUE_SET_INT(val22, 2);
+	JSO_VALUE_SET_INT(val32, 3);
+	JSO_VALUE_SET_INT(val42, 4);
+
+	jso_list *list1 = jso_list_alloc();
+	jso_list_push(list1, &val11);
+	jso_list_push(list1, &val21);
+	jso_list_push(list1, &val31);
+
+	jso_list *list2 = jso_list_alloc();
+	jso_list_push(list2, &val12);
+	jso_list_push(list2, &val22);
+
+	assert_false(jso_list_equals(list1, list2));
+
+	jso_list_push(list2, &val32);
+	assert_true(jso_list_equals(list1, list2));
+
+	jso_list_push(list1, &val41);
+	jso_list_push(list2, &val42);
+	assert_false(jso_list_equals(list1, list2));
+
+	jso_list_free(list1);
+	jso_list_free(list2);
+}
+
+/* A test to check whether all items in list have the supplied type. */
+static void test_jso_list_are_all_items_of_type(void **state)
+{
+	(void) state; /* unused */
+
+	jso_value val1, val2, val3, val4;
+	JSO_VALUE_SET_INT(val1, 1);
+	JSO_VALUE_SET_INT(val2, 2);
+	JSO_VALUE_SET_INT(val3, 3);
+	JSO_VALUE_SET_BOOL(val4, true);
+
+	jso_list *list = jso_list_alloc();
+	jso_list_push(list, &val1);
+	jso_list_push(list, &val2);
+	jso_list_push(list, &val3);
+
+	assert_true(jso_list_are_all_items_of_type(list, JSO_TYPE_INT));
+	assert_false(jso_list_are_all_items_of_type(list, JSO_TYPE_DOUBLE));
+
+	jso_list_push(list, &val4);
+	assert_false(jso_list_are_all_items_of_type(list, JSO_TYPE_INT));
+
+	jso_list_free(list);
+}
+
+/* A test to check whether all items in list are unique */
+static void test_jso_list_is_unique(void **state)
+{
+	(void) state; /* unused */
+
+	jso_value val1, val2, val3, val4;
+	JSO_VALUE_SET_INT(val1, 1);
+	JSO_VALUE_SET_INT(val2, 2);
+	JSO_VALUE_SET_INT(val3, 3);
+	JSO_VALUE_SET_BOOL(val4, true);
+
+	jso_list *list = jso_list_alloc();
+	jso_list_push(list, &val1);
+	jso_list_push(list, &val2);
+	jso_list_push(list, &val3);
+	jso_list_push(list, &val4);
+
+	assert_true(jso_list_is_unique(list));
+
+	jso_list_push(list, &val1);
+	assert_false(jso_list_is_unique(list));
+
+	jso_list_free(list);
+}
+
+/* A test to check whether list copying works by increasing reference */
+static void test_jso_list_copy(void **state)
+{
+	(void) state; /* unused */
+
+	jso_value val1, val2, val3;
+	JSO_VALUE_SET_INT(val1, 1);
+	JSO_VALUE_SET_INT(val2, 2);
+	JSO_VALUE_SET_INT(val3, 3);
+
+	jso_list *list = jso_list_alloc();
+	jso_list_push(list, &val1);
+	jso_list_push(list, &val2);
+	jso_list_push(list, &val3);
+
+	assert_int_equal(0, JSO_LIST_REFCOUNT(list));
+	assert_ptr_equal(list, jso_list_copy(list));
+	assert_int_equal(1, JSO_LIST_REFCOUNT(list));
+	assert_ptr_equal(list, jso_list_copy(list));
+	assert_int_equal(2, JSO_LIST_REFCOUNT(list));
+	jso_list_free(list);
+	assert_int_equal(1, JSO_LIST_REFCOUNT(list));
+	jso_list_free(list);
+	assert_int_equal(0, JSO_LIST_REFCOUNT(list));
+	jso_list_free(list);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_jso_list_append),
+		cmocka_unit_test(test_jso_list_push),
+		cmocka_unit_test(test_jso_list_pop),
+		cmocka_unit_test(test_jso_list_index),
+		cmocka_unit_test(test_jso_list_apply),
+		cmocka_unit_test(test_jso_list_apply_with_args),
+		cmocka_unit_test(test_jso_list_equals),
+		cmocka_unit_test(test_jso_list_are_all_items_of_type),
+		cmocka_unit_test(test_jso_list_is_unique),
+		cmocka_unit_test(test_jso_list_copy),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
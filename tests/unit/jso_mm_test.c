@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include "../../src/jso.h"
+#include "../../src/io/jso_io_memory.h"
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+/* A test case that counts allocations. */
+static void test_jso_mm_counter(void **state)
+{
+	(void) state; /* unused */
+
+	jso_mm_counter counter;
+	const jso_allocator *allocator = jso_mm_counter_init(&counter, NULL);
+	const jso_mm_stats *stats = jso_mm_counter_get_stats(&counter);
+
+	assert_ptr_equal(jso_mm_counter_get_allocator(&counter), allocator);
+	assert_ptr_equal(jso_mm_get_default_allocator(), counter.parent);
+
+	char *p1 = jso_allocator_malloc(allocator, 10);
+	char *p2 = jso_allocator_calloc(allocator, 4, 8);
+	assert_non_null(p1);
+	assert_non_null(p2);
+	assert_int_equal(0, (uintptr_t) p2 % sizeof(max_align_t));
+	for (int i = 0; i < 32; i++) {
+		assert_int_equal(0, p2[i]);
+	}
+	memcpy(p1, "abcdefghi", 10);
+	assert_int_equal(2, stats->alloc_calls);
+	assert_int_equal(42, stats->total_bytes);
+	assert_int_equal(42, stats->used_bytes);
+	assert_int_equal(42, stats->peak_bytes);
+
+	p1 = jso_allocator_realloc(allocator, p1, 100);
+	assert_non_null(p1);
+	assert_string_equal("abcdefghi", p1);
+	assert_int_equal(1, stats->realloc_calls);
+	assert_int_equal(142, stats->total_bytes);
+	assert_int_equal(132, stats->used_bytes);
+	assert_int_equal(132, stats->peak_bytes);
+
+	jso_allocator_free(allocator, p1);
+	assert_int_equal(1, stats->free_calls);
+	assert_int_equal(32, stats->used_bytes);
+	assert_int_equal(132, stats->peak_bytes);
+
+	jso_mm_counter_reset(&counter);
+	assert_int_equal(0, stats->alloc_calls);
+	assert_int_equal(0, stats->realloc_calls);
+	assert_int_equal(0, stats->free_calls);
+	assert_int_equal(0, stats->total_bytes);
+	assert_int_equal(32, stats->used_bytes);
+	assert_int_equal(32, stats->peak_bytes);
+
+	/* realloc of NULL allocates */
+	p1 = jso_allocator_realloc(allocator, NULL, 8);
+	assert_non_null(p1);
+	assert_int_equal(0, stats->alloc_calls);
+	assert_int_equal(1, stats->realloc_calls);
+	assert_int_equal(40, stats->used_bytes);
+
+	jso_allocator_free(allocator, p1);
+	jso_allocator_free(allocator, p2);
+	jso_allocator_free(allocator, NULL);
+	assert_int_equal(3, stats->free_calls);
+	assert_int_equal(0, stats->used_bytes);
+	assert_int_equal(40, stats->peak_bytes);
+}
+
+/* A test case that switches thread and global allocators. */
+static void test_jso_mm_allocator_switch(void **state)
+{
+	(void) state; /* unused */
+
+	jso_mm_counter global_counter, thread_counter;
+	const jso_allocator *global_allocator = jso_mm_counter_init(&global_counter, NULL);
+	const jso_allocator *thread_allocator = jso_mm_counter_init(&thread_counter, NULL);
+	const jso_allocator *default_allocator = jso_mm_get_default_allocator();
+
+	assert_ptr_equal(default_allocator, jso_mm_set_global_allocator(global_allocator));
+	assert_ptr_equal(global_allocator, jso_mm_get_global_allocator());
+	assert_ptr_equal(global_allocator, jso_mm_get_allocator());
+	jso_free(jso_malloc(16));
+	assert_int_equal(1, global_counter.stats.alloc_calls);
+
+	/* thread allocator has priority */
+	const jso_allocator *previous = jso_mm_enter(thread_allocator);
+	assert_ptr_equal(thread_allocator, jso_mm_get_allocator());
+	jso_string *str = jso_string_create_from_cstr("test");
+	assert_int_equal(1, thread_counter.stats.alloc_calls);
+	assert_int_equal(0, global_counter.stats.used_bytes);
+
+	/* NULL keeps the current allocator */
+	const jso_allocator *nested = jso_mm_enter(NULL);
+	assert_ptr_equal(thread_allocator, jso_mm_get_allocator());
+	jso_mm_leave(nested);
+
+	jso_string_free(str);
+	assert_int_equal(0, thread_counter.stats.used_bytes);
+	jso_mm_leave(previous);
+	assert_ptr_equal(global_allocator, jso_mm_get_allocator());
+
+	/* the previously set allocator is returned so restoring it keeps using the global one */
+	previous = jso_mm_set_allocator(thread_allocator);
+	assert_null(previous);
+	assert_ptr_equal(thread_allocator, jso_mm_set_allocator(previous));
+	assert_ptr_equal(global_allocator, jso_mm_get_allocator());
+
+	assert_ptr_equal(global_allocator, jso_mm_set_global_allocator(NULL));
+	assert_ptr_equal(default_allocator, jso_mm_get_allocator());
+}
+
+/* A test case that checks that IO uses the allocator it was opened with. */
+static void test_jso_mm_io_allocator(void **state)
+{
+	(void) state; /* unused */
+
+	jso_mm_counter counter;
+	const jso_allocator *allocator = jso_mm_counter_init(&counter, NULL);
+
+	const jso_allocator *previous = jso_mm_enter(allocator);
+	jso_io *io = jso_io_memory_open_ex(16, 0);
+	jso_mm_leave(previous);
+
+	assert_non_null(io);
+	assert_ptr_equal(allocator, JSO_IO_ALLOCATOR(io));
+	assert_int_equal(2, counter.stats.alloc_calls);
+	assert_int_equal(sizeof(jso_io) + 17, counter.stats.used_bytes);
+
+	/* freeing uses the IO allocator even if it is not current */
+	JSO_IO_FREE(io);
+	assert_int_equal(2, counter.stats.free_calls);
+	assert_int_equal(0, counter.stats.used_bytes);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_jso_mm_counter),
+		cmocka_unit_test(test_jso_mm_allocator_switch),
+		cmocka_unit_test(test_jso_mm_io_allocator),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
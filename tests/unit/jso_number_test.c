@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "../../src/jso.h"
+#include "../../src/jso_number.h"
+
+#include <limits.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+/* parse the number and check that it is integer with the expected value */
+static void assert_jso_number_parse_int(const char *str, jso_int expected)
+{
+	jso_number num;
+	assert_ptr_equal(&num, jso_number_parse(&num, str, strlen(str)));
+	assert_true(num.is_int);
+	assert_int_equal(expected, num.ival);
+}
+
+/* parse the number and check that it is double equal to the result of strtod */
+static void assert_jso_number_parse_double(const char *str)
+{
+	jso_number num;
+	double expected = strtod(str, NULL);
+	assert_ptr_equal(&num, jso_number_parse(&num, str, strlen(str)));
+	assert_false(num.is_int);
+	assert_memory_equal(&expected, &num.dval, sizeof(double));
+}
+
+/* A test case that tests parsing of integers. */
+static void test_jso_number_parse_int(void **state)
+{
+	(void) state; /* unused */
+
+	jso_number num;
+
+	assert_jso_number_parse_int("0", 0);
+	assert_jso_number_parse_int("-0", 0);
+	assert_jso_number_parse_int("7", 7);
+	assert_jso_number_parse_int("-42", -42);
+	assert_jso_number_parse_int("1234567890", 1234567890);
+#if LONG_MAX == INT64_MAX
+	assert_jso_number_parse_int("9223372036854775807", INT64_MAX);
+	assert_jso_number_parse_int("-9223372036854775808", INT64_MIN);
+	assert_jso_number_parse_double("9223372036854775808");
+	assert_jso_number_parse_double("-9223372036854775809");
+#else
+	assert_jso_number_parse_int("2147483647", INT32_MAX);
+	assert_jso_number_parse_int("-2147483648", INT32_MIN);
+	assert_jso_number_parse_double("2147483648");
+	assert_jso_number_parse_double("-2147483649");
+#endif
+	assert_jso_number_parse_double("10000000000000000000");
+	assert_jso_number_parse_double("-123456789012345678901234567890");
+
+	/* only the supplied length is parsed */
+	jso_number_parse(&num, "12345", 3);
+	assert_true(num.is_int);
+	assert_int_equal(123, num.ival);
+}
+
+/* A test case that tests parsing of doubles. */
+static void test_jso_number_parse_double(void **state)
+{
+	(void) state; /* unused */
+
+	static const char *numbers[] = {
+		"0.0",
+		"-0.0",
+		"0.1",
+		"-1.5",
+		"3.141592653589793",
+		"1e10",
+		"1E+10",
+		"-2.5e-3",
+		"123.456e7",
+		"0.000001234",
+		"1e23",
+		"9007199254740993.0",
+		"2.2250738585072011e-308",
+		"2.2250738585072014e-308",
+		"4.9406564584124654e-324",
+		"2.4703282292062327e-324",
+		"2.4703282292062328e-324",
+		"1.7976931348623157e308",
+		"1.7976931348623159e308",
+		"1e-400",
+		"-1e400",
+		"7.038531e-26",
+		"8.98846567431158e307",
+		"1.00000000000000011102230246251565404236316680908203125",
+		"1.00000000000000011102230246251565404236316680908203124",
+		"3.14159265358979323846264338327950288419716939937510582",
+		"0.0000000000000000000000000000000000000000001e300",
+		"12345678901234567890123456789e-30",
+	};
+
+	for (size_t i = 0; i < sizeof(numbers) / sizeof(numbers[0]); i++) {
+		assert_jso_number_parse_double(numbers[i]);
+	}
+}
+
+/* A test case that tests formatting of doubles to the shortest representation. */
+static void test_jso_number_format_double(void **state)
+{
+	(void) state; /* unused */
+
+	static const struct {
+		double val;
+		const char *expected;
+	} numbers[] = {
+		{ 0.0, "0" },
+		{ -0.0, "-0" },
+		{ 1.0, "1" },
+		{ -1.5, "-1.5" },
+		{ 0.1, "0.1" },
+		{ 0.3, "0.3" },
+		{ 0.1 + 0.2, "0.30000000000000004" },
+		{ 48.23, "48.23" },
+		{ 100.0, "100" },
+		{ 0.0001, "0.0001" },
+		{ 0.00001, "1e-5" },
+		{ 1.25e-7, "1.25e-7" },
+		{ 1e16, "10000000000000000" },
+		{ 1e17, "1e+17" },
+		{ 9007199254740993.0, "9007199254740992" },
+		{ 123456789012345678.0, "1.2345678901234568e+17" },
+		{ 5e-324, "5e-324" },
+		{ 2.2250738585072014e-308, "2.2250738585072014e-308" },
+		{ -1.7976931348623157e308, "-1.7976931348623157e+308" },
+	};
+	char buf[JSO_NUMBER_DOUBLE_BUFFER_SIZE];
+
+	for (size_t i = 0; i < sizeof(numbers) / sizeof(numbers[0]); i++) {
+		size_t len = jso_number_format_double(buf, numbers[i].val);
+		assert_string_equal(numbers[i].expected, buf);
+		assert_int_equal(strlen(numbers[i].expected), len);
+	}
+
+	/* the shortest representation converts back to the same value */
+	jso_uint64 bits = 0x123456789abcdefULL;
+	for (int i = 0; i < 10000; i++) {
+		double val, result;
+		bits = bits * 6364136223846793005ULL + 1442695040888963407ULL;
+		memcpy(&val, &bits, sizeof(double));
+		if (val != val || val - val != 0) {
+			continue;
+		}
+		size_t len = jso_number_format_double(buf, val);
+		assert_int_equal(strlen(buf), len);
+		result = strtod(buf, NULL);
+		assert_memory_equal(&val, &result, sizeof(double));
+	}
+}
+
+/* A test case that tests formatting of doubles with precision. */
+static void test_jso_number_format_double_precision(void **state)
+{
+	(void) state; /* unused */
+
+	char buf[JSO_NUMBER_DOUBLE_BUFFER_SIZE];
+
+	assert_int_equal(6, jso_number_format_double_precision(buf, 123456.789, 6));
+	assert_string_equal("123457", buf);
+	assert_int_equal(10, jso_number_format_double_precision(buf, 123456.789, 10));
+	assert_string_equal("123456.789", buf);
+	assert_int_equal(19, jso_number_format_double_precision(buf, 0.1, 17));
+	assert_string_equal("0.10000000000000001", buf);
+	assert_int_equal(19, jso_number_format_double_precision(buf, 0.1 + 0.2, 17));
+	assert_string_equal("0.30000000000000004", buf);
+	assert_int_equal(6, jso_number_format_double_precision(buf, 1234.5, 2));
+	assert_string_equal("1.2e+3", buf);
+	assert_int_equal(7, jso_number_format_double_precision(buf, -0.000012, 3));
+	assert_string_equal("-1.2e-5", buf);
+	assert_int_equal(1, jso_number_format_double_precision(buf, 0.0, 5));
+	assert_string_equal("0", buf);
+	/* precision is limited */
+	assert_int_equal(1, jso_number_format_double_precision(buf, 7.0, 0));
+	assert_string_equal("7", buf);
+	assert_int_equal(3, jso_number_format_double_precision(buf, 2.5, 100));
+	assert_string_equal("2.5", buf);
+}
+
+/* A test case that tests creating number string from double. */
+static void test_jso_number_string_from_double(void **state)
+{
+	(void) state; /* unused */
+
+	jso_number_string nstr;
+
+	jso_number_string_from_double(&nstr, 48.23);
+	assert_string_equal("48.23", JSO_NUMBER_STRING_VAL(nstr));
+	assert_int_equal(5, JSO_NUMBER_STRING_LEN(nstr));
+	assert_false(JSO_NUMBER_STRING_IS_NEGATIVE(nstr));
+
+	jso_number_string_from_double(&nstr, -0.000125);
+	assert_string_equal("-0.000125", JSO_NUMBER_STRING_VAL(nstr));
+	assert_int_equal(9, JSO_NUMBER_STRING_LEN(nstr));
+	assert_true(JSO_NUMBER_STRING_IS_NEGATIVE(nstr));
+
+	jso_number_string_from_double(&nstr, 1e20);
+	assert_string_equal("100000000000000000000", JSO_NUMBER_STRING_VAL(nstr));
+	assert_false(nstr.exp_notation);
+
+	/* values that do not fit to the buffer use exponent */
+	jso_number_string_from_double(&nstr, -1.7976931348623157e308);
+	assert_string_equal("-1.7976931348623157e+308", JSO_NUMBER_STRING_VAL(nstr));
+	assert_int_equal(24, JSO_NUMBER_STRING_LEN(nstr));
+	assert_true(nstr.exp_notation);
+
+	jso_number_string_from_double(&nstr, -HUGE_VAL);
+	assert_string_equal("-INF", JSO_NUMBER_STRING_VAL(nstr));
+	assert_true(JSO_NUMBER_STRING_IS_INFINITY(nstr));
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_jso_number_parse_int),
+		cmocka_unit_test(test_jso_number_parse_double),
+		cmocka_unit_test(test_jso_number_format_double),
+		cmocka_unit_test(test_jso_number_format_double_precision),
+		cmocka_unit_test(test_jso_number_string_from_double),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -151,6 +151,34 @@ static void test_jso_object_has(void **state)
 	jso_string_free(key4);
 }
 
+/* A test case that removes element from object. */
+static void test_jso_object_remove(void **state)
+{
+	(void) state; /* unused */
+
+	jso_value val1, val2, *val = NULL;
+	JSO_VALUE_SET_INT(val1, 1);
+	JSO_VALUE_SET_STRING(val2, jso_string_create_from_cstr("value"));
+
+	jso_string *key1 = jso_string_create_from_cstr("key");
+	jso_string *key2 = jso_string_create_from_cstr("second key");
+	jso_string *key3 = jso_string_create_from_cstr("second key");
+
+	jso_object *obj = jso_object_alloc();
+	jso_object_add(obj, key1, &val1);
+	jso_object_add(obj, key2, &val2);
+
+	assert_true(jso_object_remove(obj, key3) == JSO_SUCCESS);
+	assert_int_equal(1, JSO_OBJECT_COUNT(obj));
+	assert_false(jso_object_has(obj, key3));
+	assert_true(jso_object_remove(obj, key3) == JSO_FAILURE);
+	assert_true(jso_object_get_by_cstr_key(obj, "key", 3, &val) == JSO_SUCCESS);
+	assert_int_equal(1, JSO_IVAL_P(val));
+
+	jso_object_free(obj);
+	jso_string_free(key3);
+}
+
 /* A test case that resizes hash table. */
 static void test_jso_object_resize(void **state)
 {
@@ -378,6 +406,7 @@ int main(void)
 		cmocka_unit_test(test_jso_object_add),
 		cmocka_unit_test(test_jso_object_get),
 		cmocka_unit_test(test_jso_object_has),
+		cmocka_unit_test(test_jso_object_remove),
 		cmocka_unit_test(test_jso_object_resize),
 		cmocka_unit_test(test_jso_object_apply),
 		cmocka_unit_test(test_jso_object_apply_with_arg),
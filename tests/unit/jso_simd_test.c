@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) 2025 Jakub Zelenka. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "../../src/jso.h"
+#include "../../src/jso_simd.h"
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+static const jso_simd_level jso_test_simd_levels[] = {
+	JSO_SIMD_LEVEL_SCALAR,
+	JSO_SIMD_LEVEL_SWAR,
+	JSO_SIMD_LEVEL_SSE2,
+	JSO_SIMD_LEVEL_AVX2,
+	JSO_SIMD_LEVEL_NEON,
+};
+
+/* A test case that checks the automatically selected level. */
+static void test_jso_simd_level(void **state)
+{
+	(void) state; /* unused */
+
+	jso_simd_level level = jso_simd_get_level();
+	assert_true(level != JSO_SIMD_LEVEL_SCALAR);
+	assert_int_equal(JSO_SUCCESS, jso_simd_set_level(JSO_SIMD_LEVEL_SCALAR));
+	assert_int_equal(JSO_SIMD_LEVEL_SCALAR, jso_simd_get_level());
+	assert_int_equal(JSO_SUCCESS, jso_simd_set_level(JSO_SIMD_LEVEL_SWAR));
+	assert_int_equal(JSO_SIMD_LEVEL_SWAR, jso_simd_get_level());
+	assert_int_equal(JSO_SUCCESS, jso_simd_set_level(level));
+}
+
+/* A test case that checks string span in all supported levels. */
+static void test_jso_simd_string_span(void **state)
+{
+	(void) state; /* unused */
+
+	const jso_ctype specials[] = { '"', '\\', 0x00, 0x0a, 0x1f, 0x80, 0xc3, 0xff };
+	jso_simd_level level = jso_simd_get_level();
+	jso_ctype buf[100];
+
+	for (size_t l = 0; l < sizeof(jso_test_simd_levels) / sizeof(jso_simd_level); l++) {
+		if (jso_simd_set_level(jso_test_simd_levels[l]) == JSO_FAILURE) {
+			continue;
+		}
+		for (size_t i = 0; i < sizeof(buf); i++) {
+			buf[i] = (jso_ctype) (0x20 + i % 0x60);
+			if (buf[i] == '"' || buf[i] == '\\') {
+				buf[i] = 'x';
+			}
+		}
+		/* plain string is limited by the length */
+		for (size_t len = 0; len <= sizeof(buf); len++) {
+			assert_int_equal(len, jso_simd_string_span(buf, len));
+		}
+		/* every special character stops the span on any position */
+		for (size_t s = 0; s < sizeof(specials); s++) {
+			for (size_t pos = 0; pos < sizeof(buf); pos++) {
+				jso_ctype orig = buf[pos];
+				buf[pos] = specials[s];
+				assert_int_equal(pos, jso_simd_string_span(buf, sizeof(buf)));
+				/* the following special characters do not change the result */
+				if (pos + 1 < sizeof(buf)) {
+					jso_ctype next = buf[pos + 1];
+					buf[pos + 1] = 0;
+					assert_int_equal(pos, jso_simd_string_span(buf, sizeof(buf)));
+					buf[pos + 1] = next;
+				}
+				assert_int_equal(pos, jso_simd_string_span(buf, pos + 1));
+				assert_int_equal(pos, jso_simd_string_span(buf, pos));
+				buf[pos] = orig;
+			}
+		}
+	}
+
+	assert_int_equal(JSO_SUCCESS, jso_simd_set_level(level));
+}
+
+/* A test case that checks escape span in all supported levels. */
+static void test_jso_simd_escape_span(void **state)
+{
+	(void) state; /* unused */
+
+	const jso_ctype specials[] = { '"', '\\', '/', 0x00, 0x0a, 0x1f };
+	jso_simd_level level = jso_simd_get_level();
+	jso_ctype buf[100];
+
+	for (size_t l = 0; l < sizeof(jso_test_simd_levels) / sizeof(jso_simd_level); l++) {
+		if (jso_simd_set_level(jso_test_simd_levels[l]) == JSO_FAILURE) {
+			continue;
+		}
+		/* the non ASCII characters do not need to be escaped */
+		for (size_t i = 0; i < sizeof(buf); i++) {
+			buf[i] = (jso_ctype) (0x20 + i * 7 % 0xe0);
+			if (buf[i] == '"' || buf[i] == '\\' || buf[i] == '/') {
+				buf[i] = 0xff;
+			}
+		}
+		for (size_t len = 0; len <= sizeof(buf); len++) {
+			assert_int_equal(len, jso_simd_escape_span(buf, len));
+		}
+		/* every special character stops the span on any position */
+		for (size_t s = 0; s < sizeof(specials); s++) {
+			for (size_t pos = 0; pos < sizeof(buf); pos++) {
+				jso_ctype orig = buf[pos];
+				buf[pos] = specials[s];
+				assert_int_equal(pos, jso_simd_escape_span(buf, sizeof(buf)));
+				assert_int_equal(pos, jso_simd_escape_span(buf, pos + 1));
+				assert_int_equal(pos, jso_simd_escape_span(buf, pos));
+				buf[pos] = orig;
+			}
+		}
+	}
+
+	assert_int_equal(JSO_SUCCESS, jso_simd_set_level(level));
+}
+
+/* valid characters used for building the UTF-8 test strings */
+static const char *jso_test_simd_utf8_chars[] = {
+	"a",
+	"\xc2\x80",
+	"\xdf\xbf",
+	"\xe0\xa0\x80",
+	"\xe4\xb8\xad",
+	"\xe6\x96\x87",
+	"\xed\x9f\xbf",
+	"\xef\xbf\xbf",
+	"\xf0\x90\x80\x80",
+	"\xf4\x8f\xbf\xbf",
+};
+
+/* invalid sequences (the last ones are truncated characters) */
+static const char *jso_test_simd_utf8_invalid[] = {
+	"\x80",
+	"\xbf",
+	"\xc0\x80",
+	"\xc1\xbf",
+	"\xe0\x80\x80",
+	"\xed\xa0\x80",
+	"\xf0\x80\x80\x80",
+	"\xf4\x90\x80\x80",
+	"\xf5\x80\x80\x80",
+	"\xff",
+	"\xc2\x80\x80",
+	"\xc2" "a",
+	"\xe4\xb8" "a",
+	"\xf0\x90\x80" "a",
+	"\xc2\"",
+	"\xe4\xb8\\",
+	"\xf0\x90\x80\n",
+};
+
+/* create UTF-8 string from pseudo random valid characters and return its length */
+static size_t jso_test_simd_utf8_fill(jso_ctype *buf, size_t size, unsigned int seed)
+{
+	size_t len = 0;
+	for (;;) {
+		seed = seed * 1103515245 + 12345;
+		const char *c = jso_test_simd_utf8_chars[(seed >> 16)
+				% (sizeof(jso_test_simd_utf8_chars) / sizeof(jso_test_simd_utf8_chars[0]))];
+		size_t clen = strlen(c);
+		if (len + clen > size) {
+			return len;
+		}
+		memcpy(buf + len, c, clen);
+		len += clen;
+	}
+}
+
+/* check that the span of the level is a valid prefix of the exact span and return the exact one */
+static size_t jso_test_simd_utf8_check(const jso_ctype *buf, size_t len, jso_simd_level level)
+{
+	assert_int_equal(JSO_SUCCESS, jso_simd_set_level(JSO_SIMD_LEVEL_SCALAR));
+	size_t exact = jso_simd_string_span_utf8(buf, len);
+	assert_int_equal(JSO_SUCCESS, jso_simd_set_level(level));
+	size_t span = jso_simd_string_span_utf8(buf, len);
+	assert_true(span <= exact);
+	assert_true(exact - span <= 64);
+	assert_true(span == exact || (buf[span] & 0xc0) != 0x80);
+	return exact;
+}
+
+/* A test case that checks UTF-8 string span in all supported levels. */
+static void test_jso_simd_string_span_utf8(void **state)
+{
+	(void) state; /* unused */
+
+	jso_simd_level level = jso_simd_get_level();
+	jso_ctype buf[200];
+	size_t len;
+
+	for (unsigned int seed = 0; seed < 20; seed++) {
+		len = jso_test_simd_utf8_fill(buf, sizeof(buf) - 8, seed);
+		for (size_t l = 0; l < sizeof(jso_test_simd_levels) / sizeof(jso_simd_level); l++) {
+			if (jso_simd_set_level(jso_test_simd_levels[l]) == JSO_FAILURE) {
+				continue;
+			}
+			/* valid string is limited by the length or by the truncated character */
+			for (size_t end = 0; end <= len; end++) {
+				if (jso_test_simd_utf8_check(buf, end, jso_test_simd_levels[l]) == end) {
+					assert_int_equal(end, jso_simd_string_span_utf8(buf, end));
+				}
+			}
+			/* invalid sequence on any character boundary stops the span before its end */
+			for (size_t i = 0;
+					i < sizeof(jso_test_simd_utf8_invalid) / sizeof(jso_test_simd_utf8_invalid[0]);
+					i++) {
+				const char *invalid = jso_test_simd_utf8_invalid[i];
+				size_t invalid_len = strlen(invalid);
+				for (size_t pos = 0; pos < len; pos++) {
+					if ((buf[pos] & 0xc0) == 0x80) {
+						continue;
+					}
+					jso_ctype copy[sizeof(buf)];
+					memcpy(copy, buf, pos);
+					memcpy(copy + pos, invalid, invalid_len);
+					memcpy(copy + pos + invalid_len, buf + pos, len - pos);
+					size_t exact = jso_test_simd_utf8_check(
+							copy, len + invalid_len, jso_test_simd_levels[l]);
+					assert_true(exact >= pos);
+					assert_true(exact < pos + invalid_len);
+				}
+			}
+			/* special character stops the span */
+			for (size_t pos = 0; pos < len; pos++) {
+				if ((buf[pos] & 0xc0) == 0x80) {
+					continue;
+				}
+				jso_ctype orig = buf[pos];
+				buf[pos] = '"';
+				assert_int_equal(pos, jso_simd_string_span_utf8(buf, len));
+				buf[pos] = orig;
+			}
+		}
+	}
+
+	assert_int_equal(JSO_SUCCESS, jso_simd_set_level(level));
+}
+
+/* get structural characters of the block by checking the characters one by one */
+static jso_uint64 jso_test_simd_structural_check(
+		jso_simd_structural_state *state, const jso_ctype *block)
+{
+	jso_uint64 mask = 0;
+
+	for (size_t i = 0; i < JSO_SIMD_BLOCK_SIZE; i++) {
+		jso_ctype c = block[i];
+		jso_bool quote = c == '"' && !state->escaped;
+		if (state->in_string) {
+			if (quote) {
+				state->in_string = 0;
+				state->scalar = 0;
+			}
+		} else if (strchr("{}[]:,", c) != NULL) {
+			mask |= (jso_uint64) 1 << i;
+			state->scalar = 0;
+		} else if (strchr(" \t\n\r", c) != NULL) {
+			state->scalar = 0;
+		} else {
+			if (!state->scalar) {
+				mask |= (jso_uint64) 1 << i;
+			}
+			state->in_string = quote;
+			state->scalar = !quote;
+		}
+		state->escaped = c == '\\' && !state->escaped;
+	}
+
+	return mask;
+}
+
+/* A test case that checks structural characters in all supported levels. */
+static void test_jso_simd_structural_block(void **state)
+{
+	(void) state; /* unused */
+
+	const char chars[] = "\"\\ \n{]:,a1";
+	jso_simd_level level = jso_simd_get_level();
+	jso_ctype buf[JSO_SIMD_BLOCK_SIZE * 4];
+	unsigned int seed = 1;
+
+	for (size_t l = 0; l < sizeof(jso_test_simd_levels) / sizeof(jso_simd_level); l++) {
+		if (jso_simd_set_level(jso_test_simd_levels[l]) == JSO_FAILURE) {
+			continue;
+		}
+		for (size_t n = 0; n < 1000; n++) {
+			jso_simd_structural_state block_state = { 0 }, check_state = { 0 };
+			/* the escapes and strings cross the blocks boundaries */
+			for (size_t i = 0; i < sizeof(buf); i++) {
+				seed = seed * 1103515245 + 12345;
+				buf[i] = (jso_ctype) chars[(seed >> 16) % (sizeof(chars) - 1)];
+			}
+			for (size_t i = 0; i < sizeof(buf); i += JSO_SIMD_BLOCK_SIZE) {
+				jso_uint64 expected = jso_test_simd_structural_check(&check_state, buf + i);
+				assert_int_equal(expected, jso_simd_structural_block(&block_state, buf + i));
+				assert_int_equal(check_state.in_string ? ~(jso_uint64) 0 : 0,
+						block_state.in_string);
+			}
+		}
+		/* the quote after the odd long backslash series is escaped */
+		jso_simd_structural_state block_state = { 0 };
+		memset(buf, '\\', sizeof(buf));
+		buf[sizeof(buf) - JSO_SIMD_BLOCK_SIZE + 1] = '"';
+		for (size_t i = 0; i < sizeof(buf); i += JSO_SIMD_BLOCK_SIZE) {
+			assert_int_equal(i == 0 ? 1 : 0, jso_simd_structural_block(&block_state, buf + i));
+		}
+		assert_int_equal(0, block_state.in_string);
+	}
+
+	assert_int_equal(JSO_SUCCESS, jso_simd_set_level(level));
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_jso_simd_level),
+		cmocka_unit_test(test_jso_simd_string_span),
+		cmocka_unit_test(test_jso_simd_string_span_utf8),
+		cmocka_unit_test(test_jso_simd_escape_span),
+		cmocka_unit_test(test_jso_simd_structural_block),
+	};
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -121,6 +121,25 @@ static void test_jso_string_has_hash(void **state)
 	jso_string_free(str);
 }
 
+/* A test to check whether hash is computed and cached. */
+static void test_jso_string_hash(void **state)
+{
+	(void) state; /* unused */
+
+	jso_string *str = jso_string_create_from_cstr("abc");
+
+	assert_false(jso_string_has_hash(str));
+	assert_int_equal(0x1a47e90b, jso_string_hash(str));
+	assert_true(jso_string_has_hash(str));
+	assert_int_equal(0x1a47e90b, jso_string_get_hash(str));
+
+	/* incremental hashing gives the same result */
+	jso_uint32 hash = jso_string_hash_update(JSO_STRING_HASH_INIT, (jso_ctype *) "ab", 2);
+	assert_int_equal(0x1a47e90b, jso_string_hash_update(hash, (jso_ctype *) "c", 1));
+
+	jso_string_free(str);
+}
+
 int main(void)
 {
 	const struct CMUnitTest tests[] = {
@@ -130,6 +149,7 @@ int main(void)
 		cmocka_unit_test(test_jso_string_copy),
 		cmocka_unit_test(test_jso_string_get_hash),
 		cmocka_unit_test(test_jso_string_has_hash),
+		cmocka_unit_test(test_jso_string_hash),
 	};
 
 	return cmocka_run_group_tests(tests, NULL, NULL);
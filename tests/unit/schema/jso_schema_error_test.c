@@ -115,6 +115,107 @@ static void test_jso_schema_error_free(void **state)
 	jso_schema_clear(&schema);
 }
 
+/* record error of the position with the supplied operands */
+static jso_schema_error_type jso_schema_error_test_record_pos(jso_schema *schema,
+		jso_schema_validation_position *pos, jso_schema_error_code code, ...)
+{
+	va_list args;
+	va_start(args, code);
+	jso_schema_error_type type = jso_schema_error_record(schema, pos, code, args);
+	va_end(args);
+
+	return type;
+}
+
+/* record error with the supplied operands */
+static jso_schema_error_type jso_schema_error_test_record(
+		jso_schema *schema, jso_schema_error_code code, ...)
+{
+	va_list args;
+	va_start(args, code);
+	jso_schema_error_type type = jso_schema_error_record(schema, NULL, code, args);
+	va_end(args);
+
+	return type;
+}
+
+/* A test for recording error and rendering its message. */
+static void test_jso_schema_error_record(void **state)
+{
+	(void) state; /* unused */
+
+	jso_schema schema;
+	jso_schema_init(&schema);
+
+	char key[] = "key";
+	assert_int_equal(JSO_SCHEMA_ERROR_VALIDATION_KEYWORD,
+			jso_schema_error_test_record(&schema, JSO_SCHEMA_ERROR_CODE_REQUIRED,
+					jso_schema_error_operand_string(key, 3)));
+	/* the message is not rendered until requested and the string is copied */
+	assert_null(schema.error.message);
+	key[0] = 'x';
+	assert_int_equal(JSO_SCHEMA_ERROR_CODE_REQUIRED, JSO_SCHEMA_ERROR_CODE(&schema));
+	assert_string_equal("", JSO_SCHEMA_ERROR_PATH(&schema));
+	assert_string_equal("required", jso_schema_error_code_keyword(JSO_SCHEMA_ERROR_CODE(&schema)));
+	assert_string_equal("Object does not have required property with key key",
+			JSO_SCHEMA_ERROR_MESSAGE(&schema));
+
+	/* the message buffer is reused by the next error */
+	jso_number num = { .dval = 1.5, .is_int = false };
+	jso_schema_error_test_record(&schema, JSO_SCHEMA_ERROR_CODE_EXCLUSIVE_MAXIMUM,
+			jso_schema_error_operand_number(&num), jso_schema_error_operand_cstr("greater than"),
+			jso_schema_error_operand_int(-1));
+	assert_string_equal("Value 1.5 is greater than exclusive maximum value -1",
+			JSO_SCHEMA_ERROR_MESSAGE(&schema));
+
+	/* the operands are not recorded if the detail is skipped */
+	schema.skip_error_detail = true;
+	jso_schema_error_test_record(&schema, JSO_SCHEMA_ERROR_CODE_MAX_LENGTH,
+			jso_schema_error_operand_uint(10), jso_schema_error_operand_uint(5));
+	assert_int_equal(JSO_SCHEMA_ERROR_CODE_MAX_LENGTH, JSO_SCHEMA_ERROR_CODE(&schema));
+	assert_string_equal(
+			"String length ? is greater than maximum length ?", JSO_SCHEMA_ERROR_MESSAGE(&schema));
+
+	jso_schema_clear_error(&schema);
+	assert_int_equal(JSO_SCHEMA_ERROR_CODE_NONE, JSO_SCHEMA_ERROR_CODE(&schema));
+	assert_null(JSO_SCHEMA_ERROR_MESSAGE(&schema));
+
+	jso_schema_clear(&schema);
+}
+
+/* A test for recording the instance path of the error position. */
+static void test_jso_schema_error_record_path(void **state)
+{
+	(void) state; /* unused */
+
+	jso_schema schema;
+	jso_schema_init(&schema);
+
+	jso_string *key_str = jso_string_create_from_cstr("a/b~c");
+	jso_virt_string *key = jso_string_to_virt_string(key_str);
+	jso_schema_validation_position root = { .depth = 0, .object_key = key };
+	jso_schema_validation_position composed = { .depth = 0, .parent = &root, .object_key = key };
+	jso_schema_validation_position item = { .depth = 1, .parent = &composed, .count = 3 };
+	jso_schema_validation_position value = { .depth = 2, .parent = &item };
+
+	jso_schema_error_test_record_pos(&schema, &value, JSO_SCHEMA_ERROR_CODE_MIN_LENGTH,
+			jso_schema_error_operand_uint(1), jso_schema_error_operand_uint(2));
+	assert_string_equal("/a~1b~0c/3", JSO_SCHEMA_ERROR_PATH(&schema));
+	assert_int_equal(2, schema.error.depth);
+
+	jso_schema_error_test_record_pos(&schema, &root, JSO_SCHEMA_ERROR_CODE_MIN_LENGTH,
+			jso_schema_error_operand_uint(1), jso_schema_error_operand_uint(2));
+	assert_string_equal("", JSO_SCHEMA_ERROR_PATH(&schema));
+
+	/* the path is not recorded if the detail is skipped */
+	schema.skip_error_detail = true;
+	jso_schema_error_test_record_pos(&schema, &value, JSO_SCHEMA_ERROR_CODE_MIN_LENGTH);
+	assert_string_equal("", JSO_SCHEMA_ERROR_PATH(&schema));
+
+	jso_string_free(key_str);
+	jso_schema_clear(&schema);
+}
+
 int main(void)
 {
 	const struct CMUnitTest tests[] = {
@@ -122,6 +223,8 @@ int main(void)
 		cmocka_unit_test(test_jso_schema_error_format_short),
 		cmocka_unit_test(test_jso_schema_error_format_long),
 		cmocka_unit_test(test_jso_schema_error_free),
+		cmocka_unit_test(test_jso_schema_error_record),
+		cmocka_unit_test(test_jso_schema_error_record_path),
 	};
 
 	return cmocka_run_group_tests(tests, NULL, NULL);
@@ -105,6 +105,7 @@ static void test_jso_schema_keyword_get_any_when_success(void **state)
 	jso_schema_keyword keyword;
 
 	jso_schema_init(&schema);
+	JSO_VALUE_SET_INT(val, 1);
 
 	expect_function_call(__wrap_jso_schema_data_get_value_fast);
 	expect_value(__wrap_jso_schema_data_get_value_fast, schema, &schema);
@@ -973,7 +974,8 @@ static void test_jso_schema_keyword_get_string_when_success(void **state)
 	jso_value data, val;
 	jso_schema_value parent;
 	jso_schema_keyword keyword;
-	jso_string str;
+	/* owned string so the copy only increments the reference count */
+	jso_string str = { .refcount = 1 };
 
 	jso_schema_init(&schema);
 
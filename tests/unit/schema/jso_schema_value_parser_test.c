@@ -3090,7 +3090,7 @@ static void test_jso_schema_value_parse_type_object_when_all_good_draft4(void **
 	jso_schema schema;
 	jso_value data, tval;
 	jso_schema_value parent, value;
-	jso_schema_value_object objval;
+	jso_schema_value_object objval = { 0 };
 
 	jso_schema_init(&schema);
 	schema.version = JSO_SCHEMA_VERSION_DRAFT_04;
@@ -3214,7 +3214,7 @@ static void test_jso_schema_value_parse_type_object_when_all_good_draft6(void **
 	jso_schema schema;
 	jso_value data, tval;
 	jso_schema_value parent, value;
-	jso_schema_value_object objval;
+	jso_schema_value_object objval = { 0 };
 
 	jso_schema_init(&schema);
 	schema.version = JSO_SCHEMA_VERSION_DRAFT_06;
@@ -3348,7 +3348,7 @@ static void test_jso_schema_value_parse_type_object_when_deps_setting_fails(void
 	jso_schema schema;
 	jso_value data, tval;
 	jso_schema_value parent, value;
-	jso_schema_value_object objval;
+	jso_schema_value_object objval = { 0 };
 
 	jso_schema_init(&schema);
 	schema.version = JSO_SCHEMA_VERSION_DRAFT_04;
@@ -3476,7 +3476,7 @@ static void test_jso_schema_value_parse_type_object_when_pattern_props_setting_f
 	jso_schema schema;
 	jso_value data, tval;
 	jso_schema_value parent, value;
-	jso_schema_value_object objval;
+	jso_schema_value_object objval = { 0 };
 
 	jso_schema_init(&schema);
 
@@ -3580,7 +3580,7 @@ static void test_jso_schema_value_parse_type_object_when_props_setting_fails(voi
 	jso_schema schema;
 	jso_value data, tval;
 	jso_schema_value parent, value;
-	jso_schema_value_object objval;
+	jso_schema_value_object objval = { 0 };
 
 	jso_schema_init(&schema);
 
@@ -3673,7 +3673,7 @@ static void test_jso_schema_value_parse_type_object_when_addition_props_setting_
 	jso_schema schema;
 	jso_value data, tval;
 	jso_schema_value parent, value;
-	jso_schema_value_object objval;
+	jso_schema_value_object objval = { 0 };
 
 	jso_schema_init(&schema);
 
@@ -3755,7 +3755,7 @@ static void test_jso_schema_value_parse_type_object_when_max_props_setting_fails
 	jso_schema schema;
 	jso_value data, tval;
 	jso_schema_value parent, value;
-	jso_schema_value_object objval;
+	jso_schema_value_object objval = { 0 };
 
 	jso_schema_init(&schema);
 
@@ -3823,7 +3823,7 @@ static void test_jso_schema_value_parse_type_object_when_min_props_setting_fails
 	jso_schema schema;
 	jso_value data, tval;
 	jso_schema_value parent, value;
-	jso_schema_value_object objval;
+	jso_schema_value_object objval = { 0 };
 
 	jso_schema_init(&schema);
 
@@ -3993,7 +3993,7 @@ static void test_jso_schema_value_parse_missing_type_when_all_good(void **state)
 	jso_schema_value_number numval;
 	jso_schema_value_string strval;
 	jso_schema_value_array arrval;
-	jso_schema_value_object objval;
+	jso_schema_value_object objval = { 0 };
 	jso_schema_array typed_of_arr;
 
 	jso_schema_init(&schema);